@@ -0,0 +1,261 @@
+/**
+ * Benchmark cases. Every case has a `setup(ctx)` that returns the function to
+ * time; that function resolves to the number of rows it processed. Cases that
+ * need an optional extension return `null` from `supported(ctx)` when usable,
+ * or a reason string when they have to be skipped. Cases that open resources of
+ * their own release them in an optional `teardown(ctx)`, run after timing.
+ */
+
+var fs = require('fs');
+var os = require('os');
+var path = require('path');
+var duckdb = require('../lib/duckdb');
+
+function promisify(obj, method) {
+    var args = Array.prototype.slice.call(arguments, 2);
+    return new Promise(function (resolve, reject) {
+        args.push(function (err, res) {
+            if (err) {
+                reject(err);
+            } else {
+                resolve(res);
+            }
+        });
+        obj[method].apply(obj, args);
+    });
+}
+
+function table(ctx) {
+    return 'bench_' + ctx.schema_name;
+}
+
+var POINT_QUERIES = 10000;
+
+// parameters of POINT_QUERIES lookups by rowid spread over the table
+function pointQueries(ctx) {
+    var sql = 'SELECT * FROM ' + table(ctx) + ' WHERE rowid = ?';
+    var stride = Math.max(1, Math.floor(ctx.rows / POINT_QUERIES));
+    var queries = [];
+    for (var i = 0; i < POINT_QUERIES; i++) {
+        queries.push({ sql: sql, params: [(i * stride) % ctx.rows] });
+    }
+    return queries;
+}
+
+var SCAN_LOOKUP_ROUNDS = 4;
+var SCAN_LOOKUP_QUERIES = 250;
+
+// rounds of point lookups into a small table interleaved with full scans of a table that does not fit in memory,
+// on a database file of its own so that the buffer pool evicts persistent blocks under the given policy
+function scanLookup(policy) {
+    var file = null;
+    var db = null;
+    var con = null;
+    return {
+        setup: async function (ctx) {
+            file = path.join(os.tmpdir(), 'bench_' + ctx.schema_name + '_' + policy + '.db');
+            fs.rmSync(file, { force: true });
+            fs.rmSync(file + '.wal', { force: true });
+            db = new duckdb.Database(file, { buffer_eviction_policy: policy });
+            con = db.connect();
+            var big = table(ctx);
+            var hot_rows = Math.max(1, Math.floor(ctx.rows / 50));
+            await promisify(con, 'run', ctx.schema.create(ctx.rows));
+            await promisify(con, 'run', 'CREATE TABLE hot AS SELECT * FROM ' + big + ' LIMIT ' + hot_rows);
+            await promisify(con, 'run', 'CHECKPOINT');
+            var size = await promisify(con, 'all', 'SELECT (total_blocks * block_size)::BIGINT AS bytes FROM pragma_database_size()');
+            await promisify(con, 'run', "SET memory_limit = '" + Math.floor(Number(size[0].bytes) / 2) + "b'");
+            return async function () {
+                for (var round = 0; round < SCAN_LOOKUP_ROUNDS; round++) {
+                    for (var i = 0; i < SCAN_LOOKUP_QUERIES; i++) {
+                        await promisify(con, 'all', 'SELECT * FROM hot WHERE rowid = ?', (i * 7919) % hot_rows);
+                    }
+                    await promisify(con, 'all', 'SELECT max(COLUMNS(*)) FROM ' + big);
+                }
+                return SCAN_LOOKUP_ROUNDS * (SCAN_LOOKUP_QUERIES + ctx.rows);
+            };
+        },
+        teardown: async function () {
+            if (!db) {
+                return;
+            }
+            await promisify(con, 'close');
+            await promisify(db, 'close');
+            fs.rmSync(file, { force: true });
+            fs.rmSync(file + '.wal', { force: true });
+            file = db = con = null;
+        }
+    };
+}
+
+var cases = {
+    all: {
+        setup: function (ctx) {
+            var sql = 'SELECT * FROM ' + table(ctx);
+            return function () {
+                return promisify(ctx.con, 'all', sql).then(function (rows) {
+                    return rows.length;
+                });
+            };
+        }
+    },
+    each: {
+        setup: function (ctx) {
+            var sql = 'SELECT * FROM ' + table(ctx);
+            return function () {
+                return new Promise(function (resolve, reject) {
+                    var count = 0;
+                    ctx.con.each(sql, function (err, row) {
+                        if (err) {
+                            reject(err);
+                        }
+                        count++;
+                    }, function (err) {
+                        if (err) {
+                            reject(err);
+                        } else {
+                            resolve(count);
+                        }
+                    });
+                });
+            };
+        }
+    },
+    eachChunk: {
+        setup: function (ctx) {
+            var sql = 'SELECT * FROM ' + table(ctx);
+            return function () {
+                return new Promise(function (resolve, reject) {
+                    var count = 0;
+                    ctx.con.eachChunk(sql, function (err, rows) {
+                        if (err) {
+                            reject(err);
+                        } else {
+                            count += rows.length;
+                        }
+                    }, function (err) {
+                        if (err) {
+                            reject(err);
+                        } else {
+                            resolve(count);
+                        }
+                    });
+                });
+            };
+        }
+    },
+    stream: {
+        setup: function (ctx) {
+            var sql = 'SELECT * FROM ' + table(ctx);
+            return async function () {
+                var count = 0;
+                for await (var row of ctx.con.stream(sql)) {
+                    count++;
+                }
+                return count;
+            };
+        }
+    },
+    arrowIPCAll: {
+        supported: function (ctx) {
+            return ctx.arrow ? null : 'arrow extension not available';
+        },
+        setup: function (ctx) {
+            var sql = 'SELECT * FROM ' + table(ctx);
+            return function () {
+                return promisify(ctx.con, 'arrowIPCAll', sql).then(function () {
+                    return ctx.rows;
+                });
+            };
+        }
+    },
+    register_buffer: {
+        supported: function (ctx) {
+            return ctx.arrow ? null : 'arrow extension not available';
+        },
+        setup: async function (ctx) {
+            var ipc = await promisify(ctx.con, 'arrowIPCAll', 'SELECT * FROM ' + table(ctx));
+            var name = 'bench_ipc_' + ctx.schema_name;
+            return async function () {
+                await promisify(ctx.con, 'register_buffer', name, ipc, true);
+                var res = await promisify(ctx.con, 'all', 'SELECT count(*)::INTEGER AS c FROM ' + name);
+                await promisify(ctx.con, 'unregister_buffer', name);
+                return res[0].c;
+            };
+        }
+    },
+    prepared_insert: {
+        supported: function (ctx) {
+            return ctx.schema.row ? null : 'schema has no parameter generator';
+        },
+        setup: function (ctx) {
+            var schema = ctx.schema;
+            var target = table(ctx) + '_insert';
+            var columns = schema.types.map(function (type, idx) {
+                return 'c' + idx + ' ' + type;
+            });
+            var placeholders = schema.types.map(function () {
+                return '?';
+            });
+            var rows = Math.min(ctx.rows, ctx.insert_rows);
+            var params = [];
+            for (var i = 0; i < rows; i++) {
+                params.push(schema.row(i));
+            }
+            return async function () {
+                await promisify(ctx.con, 'run', 'CREATE OR REPLACE TABLE ' + target + ' (' + columns.join(', ') + ')');
+                await promisify(ctx.con, 'run', 'BEGIN TRANSACTION');
+                var stmt = ctx.con.prepare('INSERT INTO ' + target + ' VALUES (' + placeholders.join(', ') + ')');
+                // only the last run carries a callback, tasks complete in order
+                for (var i = 0; i + 1 < rows; i++) {
+                    stmt.run.apply(stmt, params[i]);
+                }
+                await promisify.apply(null, [stmt, 'run'].concat(params[rows - 1]));
+                await promisify(stmt, 'finalize');
+                await promisify(ctx.con, 'run', 'COMMIT');
+                return rows;
+            };
+        }
+    },
+    point_queries: {
+        setup: function (ctx) {
+            var queries = pointQueries(ctx);
+            return async function () {
+                for (var query of queries) {
+                    await promisify.apply(null, [ctx.con, 'all', query.sql].concat(query.params));
+                }
+                return queries.length;
+            };
+        }
+    },
+    point_queries_pipeline: {
+        setup: function (ctx) {
+            var queries = pointQueries(ctx);
+            return function () {
+                return ctx.con.pipeline(queries).then(function (results) {
+                    return results.length;
+                });
+            };
+        }
+    },
+    scan_lookup_lru: scanLookup('lru'),
+    scan_lookup_two_queue: scanLookup('two_queue'),
+    udf: {
+        supported: function (ctx) {
+            return ctx.schema.udf ? null : 'schema has no UDF column';
+        },
+        setup: function (ctx) {
+            var udf = ctx.schema.udf;
+            var name = 'bench_udf_' + ctx.schema_name;
+            ctx.con.register_udf(name, udf.return_type, udf.fun);
+            var sql = 'SELECT count(' + name + '(' + udf.column + ')) AS c FROM ' + table(ctx);
+            return function () {
+                return promisify(ctx.con, 'all', sql).then(function () {
+                    return ctx.rows;
+                });
+            };
+        }
+    }
+};
+
+module.exports = { cases: cases, promisify: promisify };
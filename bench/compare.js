@@ -0,0 +1,53 @@
+#!/usr/bin/env node
+/**
+ * Compares two benchmark reports produced by bench/index.js and exits with a
+ * non-zero status if any case regressed by more than the threshold.
+ *
+ * Usage: node bench/compare.js baseline.json candidate.json [--threshold 0.1]
+ */
+
+var fs = require('fs');
+
+function load(path) {
+    var report = JSON.parse(fs.readFileSync(path, 'utf8'));
+    var by_id = {};
+    for (var res of report.results) {
+        if (res.rows_per_sec !== undefined) {
+            by_id[res.id] = res;
+        }
+    }
+    return by_id;
+}
+
+var args = process.argv.slice(2);
+var threshold = 0.1;
+var idx = args.indexOf('--threshold');
+if (idx >= 0) {
+    threshold = parseFloat(args[idx + 1]);
+    args.splice(idx, 2);
+}
+if (args.length != 2) {
+    console.error('Usage: node bench/compare.js baseline.json candidate.json [--threshold 0.1]');
+    process.exit(2);
+}
+
+var base = load(args[0]);
+var cand = load(args[1]);
+var regressed = false;
+
+for (var id of Object.keys(base).sort()) {
+    if (!cand[id]) {
+        continue;
+    }
+    var speedup = cand[id].rows_per_sec / base[id].rows_per_sec;
+    var blocked = cand[id].loop.blocked_ms - base[id].loop.blocked_ms;
+    var flag = '';
+    if (speedup < 1 - threshold) {
+        flag = '  REGRESSION';
+        regressed = true;
+    }
+    console.log(id.padEnd(32) + (speedup.toFixed(2) + 'x').padStart(8) +
+        ('loop ' + (blocked >= 0 ? '+' : '') + blocked.toFixed(1) + 'ms').padStart(20) + flag);
+}
+
+process.exit(regressed ? 1 : 0);
@@ -0,0 +1,102 @@
+/**
+ * Measurement helpers for the binding benchmarks: wall time, throughput and
+ * how long the event loop was blocked while a case ran.
+ */
+
+var perf_hooks = require('perf_hooks');
+
+/**
+ * Samples the event loop while a benchmark case runs. A timer is armed every
+ * `interval` ms; any lateness beyond `threshold` ms is counted as time during
+ * which the main thread was blocked (e.g. converting a chunk to JS objects).
+ */
+class LoopMonitor {
+    constructor(interval, threshold) {
+        this.interval = interval || 1;
+        this.threshold = threshold || 5;
+        this.histogram = perf_hooks.monitorEventLoopDelay({ resolution: this.interval });
+        this.timer = null;
+        this.blocked_ms = 0;
+        this.max_block_ms = 0;
+        this.stalls = 0;
+    }
+
+    start() {
+        this.histogram.enable();
+        var self = this;
+        var expected = perf_hooks.performance.now() + this.interval;
+        this.timer = setInterval(function () {
+            var now = perf_hooks.performance.now();
+            var lag = now - expected;
+            if (lag > self.threshold) {
+                self.blocked_ms += lag;
+                self.stalls++;
+            }
+            if (lag > self.max_block_ms) {
+                self.max_block_ms = lag;
+            }
+            expected = now + self.interval;
+        }, this.interval);
+    }
+
+    stop() {
+        clearInterval(this.timer);
+        this.histogram.disable();
+        return {
+            blocked_ms: round(this.blocked_ms),
+            max_block_ms: round(this.max_block_ms),
+            stalls: this.stalls,
+            delay_p50_ms: round(this.histogram.percentile(50) / 1e6),
+            delay_p99_ms: round(this.histogram.percentile(99) / 1e6),
+            delay_max_ms: round(this.histogram.max / 1e6)
+        };
+    }
+}
+
+function round(x) {
+    return Math.round(x * 1000) / 1000;
+}
+
+function median(values) {
+    var sorted = values.slice().sort(function (a, b) { return a - b; });
+    var mid = sorted.length >> 1;
+    return sorted.length % 2 ? sorted[mid] : (sorted[mid - 1] + sorted[mid]) / 2;
+}
+
+/**
+ * Runs `fn` `iterations` times (after `warmup` untimed runs) and reports the
+ * median wall time, rows/sec and the loop statistics of the median run.
+ * `fn` returns a promise resolving to the number of rows it processed.
+ */
+async function measure(fn, iterations, warmup) {
+    for (var w = 0; w < warmup; w++) {
+        await fn();
+    }
+    var runs = [];
+    for (var i = 0; i < iterations; i++) {
+        if (global.gc) {
+            global.gc();
+        }
+        var monitor = new LoopMonitor();
+        monitor.start();
+        var start = perf_hooks.performance.now();
+        var rows = await fn();
+        var elapsed = perf_hooks.performance.now() - start;
+        var loop = monitor.stop();
+        runs.push({ wall_ms: elapsed, rows: rows, loop: loop });
+    }
+    var wall = median(runs.map(function (r) { return r.wall_ms; }));
+    var median_run = runs.reduce(function (best, r) {
+        return Math.abs(r.wall_ms - wall) < Math.abs(best.wall_ms - wall) ? r : best;
+    });
+    return {
+        rows: median_run.rows,
+        iterations: iterations,
+        wall_ms: round(wall),
+        wall_ms_min: round(Math.min.apply(null, runs.map(function (r) { return r.wall_ms; }))),
+        rows_per_sec: Math.round(median_run.rows / (wall / 1000)),
+        loop: median_run.loop
+    };
+}
+
+module.exports = { LoopMonitor: LoopMonitor, measure: measure, median: median };
@@ -0,0 +1,123 @@
+#!/usr/bin/env node
+/**
+ * Benchmarks for the hot paths of the Node binding. Results are printed as JSON
+ * (or written to --out) so that two builds can be compared with bench/compare.js.
+ *
+ * Usage: node --expose-gc bench/index.js [--rows N] [--insert-rows N] [--iterations N]
+ *                                        [--warmup N] [--filter REGEX] [--out FILE]
+ */
+
+var fs = require('fs');
+var os = require('os');
+var duckdb = require('../lib/duckdb');
+var harness = require('./harness');
+var schemas = require('./schemas');
+var registry = require('./cases');
+
+function parseArgs(argv) {
+    var opts = { rows: 1000000, insert_rows: 100000, iterations: 5, warmup: 1, filter: null, out: null };
+    for (var i = 2; i < argv.length; i++) {
+        var key = argv[i];
+        var val = argv[i + 1];
+        switch (key) {
+            case '--rows': opts.rows = parseInt(val); i++; break;
+            case '--insert-rows': opts.insert_rows = parseInt(val); i++; break;
+            case '--iterations': opts.iterations = parseInt(val); i++; break;
+            case '--warmup': opts.warmup = parseInt(val); i++; break;
+            case '--filter': opts.filter = new RegExp(val); i++; break;
+            case '--out': opts.out = val; i++; break;
+            default:
+                throw new Error('Unknown argument ' + key);
+        }
+    }
+    return opts;
+}
+
+async function loadArrow(con) {
+    try {
+        await registry.promisify(con, 'exec', 'INSTALL arrow; LOAD arrow;');
+        return true;
+    } catch (err) {
+        return false;
+    }
+}
+
+async function main() {
+    var opts = parseArgs(process.argv);
+    var db = new duckdb.Database(':memory:');
+    var con = db.connect();
+    var version = (await registry.promisify(con, 'all', 'SELECT version() AS v'))[0].v;
+    var arrow = await loadArrow(con);
+
+    var report = {
+        meta: {
+            duckdb: version,
+            node: process.version,
+            platform: process.platform,
+            arch: process.arch,
+            cpus: os.cpus().length,
+            rows: opts.rows,
+            insert_rows: opts.insert_rows,
+            iterations: opts.iterations,
+            gc_exposed: !!global.gc,
+            timestamp: new Date().toISOString()
+        },
+        results: []
+    };
+
+    for (var schema_name of Object.keys(schemas)) {
+        var schema = schemas[schema_name];
+        var created = false;
+        for (var case_name of Object.keys(registry.cases)) {
+            var id = case_name + '/' + schema_name;
+            if (opts.filter && !opts.filter.test(id)) {
+                continue;
+            }
+            if (!created) {
+                await registry.promisify(con, 'run', schema.create(opts.rows));
+                created = true;
+            }
+            var bench = registry.cases[case_name];
+            var ctx = {
+                db: db,
+                con: con,
+                schema: schema,
+                schema_name: schema_name,
+                rows: opts.rows,
+                insert_rows: opts.insert_rows,
+                arrow: arrow
+            };
+            var skip = bench.supported ? bench.supported(ctx) : null;
+            if (skip) {
+                report.results.push({ id: id, skipped: skip });
+                continue;
+            }
+            process.stderr.write('running ' + id + '\n');
+            try {
+                var fn = await bench.setup(ctx);
+                var res = await harness.measure(fn, opts.iterations, opts.warmup);
+                res.id = id;
+                report.results.push(res);
+            } catch (err) {
+                report.results.push({ id: id, error: err.message });
+            } finally {
+                if (bench.teardown) {
+                    await bench.teardown(ctx);
+                }
+            }
+        }
+    }
+
+    await registry.promisify(con, 'close');
+    var json = JSON.stringify(report, null, 2);
+    if (opts.out) {
+        fs.writeFileSync(opts.out, json);
+    } else {
+        process.stdout.write(json + '\n');
+    }
+}
+
+main().catch(function (err) {
+    console.error(err);
+    process.exit(1);
+});
@@ -0,0 +1,77 @@
+/**
+ * Table shapes the benchmark cases run against. Each schema creates a table
+ * named `bench_<name>` with `rows` rows and describes how to generate a row of
+ * matching JS parameters for insert benchmarks.
+ */
+
+function wideColumns() {
+    var cols = [];
+    for (var i = 0; i < 8; i++) {
+        cols.push('(i + ' + i + ')::INTEGER AS i' + i);
+        cols.push('(i * ' + (i + 1) + ')::BIGINT AS b' + i);
+        cols.push('(i / ' + (i + 3) + ')::DOUBLE AS d' + i);
+        cols.push('(i % 2 = ' + (i % 2) + ') AS f' + i);
+    }
+    return cols;
+}
+
+var schemas = {
+    narrow: {
+        create: function (rows) {
+            return 'CREATE OR REPLACE TABLE bench_narrow AS SELECT i::INTEGER AS id, (i * 0.5)::DOUBLE AS val ' +
+                'FROM range(' + rows + ') t(i)';
+        },
+        types: ['INTEGER', 'DOUBLE'],
+        row: function (i) {
+            return [i, i * 0.5];
+        },
+        udf: { column: 'id', return_type: 'integer', fun: function (x) { return x + 1; } }
+    },
+    wide: {
+        create: function (rows) {
+            return 'CREATE OR REPLACE TABLE bench_wide AS SELECT ' + wideColumns().join(', ') +
+                ' FROM range(' + rows + ') t(i)';
+        },
+        types: (function () {
+            var types = [];
+            for (var i = 0; i < 8; i++) {
+                types.push('INTEGER', 'BIGINT', 'DOUBLE', 'BOOLEAN');
+            }
+            return types;
+        })(),
+        row: function (i) {
+            var row = [];
+            for (var c = 0; c < 8; c++) {
+                row.push(i + c, BigInt(i * (c + 1)), i / (c + 3), i % 2 === c % 2);
+            }
+            return row;
+        },
+        udf: { column: 'd0', return_type: 'double', fun: function (x) { return x * 2; } }
+    },
+    strings: {
+        create: function (rows) {
+            return 'CREATE OR REPLACE TABLE bench_strings AS SELECT i::INTEGER AS id, md5(i::VARCHAR) AS hash, ' +
+                'repeat(chr(97 + (i % 26)::INTEGER), (i % 64)::INTEGER) AS pad, ' +
+                'concat(\'user-\', i, \'@example.com\') AS email FROM range(' + rows + ') t(i)';
+        },
+        types: ['INTEGER', 'VARCHAR', 'VARCHAR', 'VARCHAR'],
+        row: function (i) {
+            return [i, 'hash-' + i, 'x'.repeat(i % 64), 'user-' + i + '@example.com'];
+        },
+        udf: { column: 'email', return_type: 'varchar', fun: function (s) { return s.toUpperCase(); } }
+    },
+    nested: {
+        create: function (rows) {
+            return 'CREATE OR REPLACE TABLE bench_nested AS SELECT i::INTEGER AS id, ' +
+                '[i, i + 1, i + 2]::INTEGER[] AS ints, ' +
+                '{\'a\': i::INTEGER, \'b\': i::VARCHAR} AS s, ' +
+                '[{\'k\': (i % 7)::VARCHAR, \'v\': (i * 0.1)::DOUBLE}] AS tags ' +
+                'FROM range(' + rows + ') t(i)';
+        },
+        types: null, // nested parameters are not bound by the insert benchmark
+        row: null,
+        udf: null
+    }
+};
+
+module.exports = schemas;
@@ -6,9 +6,13 @@
                 "src/duckdb_node.cpp", 
                 "src/database.cpp", 
                 "src/data_chunk.cpp", 
+                "src/json_writer.cpp", 
                 "src/connection.cpp", 
                 "src/statement.cpp", 
                 "src/utils.cpp", 
+                "src/memory_file_system.cpp", 
+                "src/js_file_system.cpp", 
+                "src/pipe_file_system.cpp", 
                 "src/duckdb/ub_src_catalog.cpp", 
                 "src/duckdb/ub_src_catalog_catalog_entry.cpp", 
                 "src/duckdb/ub_src_catalog_catalog_entry_dependency.cpp", 
@@ -4,6 +4,8 @@
  * on Node.JS API
  */
 
+import { Readable, Writable } from "stream";
+
 export type ExceptionType =
     | "Invalid"          // invalid type
     | "Out of Range"     // value out of range error
@@ -83,6 +85,9 @@ export class Connection {
   all(sql: string, ...args: [...any, Callback<TableData>] | []): void;
   arrowIPCAll(sql: string, ...args: [...any, Callback<ArrowArray>] | []): void;
   each(sql: string, ...args: [...any, Callback<RowData>] | []): void;
+  allColumnar(sql: string, ...args: [...any, Callback<ColumnarBatch[]>] | []): void;
+  allJSON(sql: string | JSONOptions, ...args: [...any, Callback<Buffer>] | []): void;
+  eachChunk(sql: string, ...args: [...any, Callback<RowData[]>] | []): void;
   exec(sql: string, ...args: [...any, Callback<void>] | []): void;
 
   prepare(sql: string, ...args: [...any, Callback<Statement>] | []): Statement;
@@ -91,7 +96,8 @@ export class Connection {
   register_udf(
     name: string,
     return_type: string,
-    fun: (...args: any[]) => any
+    fun: (...args: any[]) => any,
+    options?: UdfOptions
   ): void;
 
   register_bulk(
@@ -99,10 +105,21 @@ export class Connection {
     return_type: string,
     fun: (...args: any[]) => any
   ): void;
+  register_udf_module(
+    name: string,
+    return_type: string,
+    module: string,
+    options?: UdfModuleOptions,
+    callback?: Callback<void>
+  ): void;
   unregister_udf(name: string, callback: Callback<any>): void;
 
   stream(sql: any, ...args: any[]): QueryResult;
   arrowIPCStream(sql: any, ...args: any[]): Promise<IpcResultStreamIterator>;
+  exportStream(sql: string, options?: ExportStreamOptions): Readable;
+  createInsertStream(table: string, options?: InsertStreamOptions): InsertStream;
+  pipeline(queries: PipelineQuery[]): Promise<TableData[]>;
+  setPipelining(enabled: boolean): this;
 
   register_buffer(name: string, array: ArrowIterable, force: boolean, callback?: Callback<void>): void;
   unregister_buffer(name: string, callback?: Callback<void>): void;
@@ -110,6 +127,50 @@ export class Connection {
 
 export class QueryResult implements AsyncIterable<RowData> {
   [Symbol.asyncIterator](): AsyncIterator<RowData>;
+  nextJSON(options?: Pick<JSONOptions, "bigint">): Promise<Buffer | null>;
+}
+
+export interface JSONOptions {
+  sql: string;
+  bigint?: "string" | "number";
+  format?: "json" | "ndjson";
+}
+
+export interface ExportStreamOptions {
+  format?: "csv" | "ndjson" | "parquet";
+  // bytes waiting to be read before the writers pause
+  highWaterMark?: number;
+  // further COPY options, e.g. header or compression
+  [option: string]: boolean | number | string | undefined;
+}
+
+export interface InsertStreamOptions {
+  format?: "csv" | "ndjson";
+  // bytes waiting to be parsed before writes wait
+  highWaterMark?: number;
+  // further read_csv or read_ndjson parameters, e.g. header or columns
+  [option: string]: any;
+}
+
+export type PipelineQuery = string | { sql: string; params?: any[] };
+
+export interface InsertStream extends Writable {
+  // set once the stream has finished
+  rowCount?: number;
+}
+
+export interface UdfOptions {
+  // same arguments give the same result: allows constant folding and memoizes results
+  deterministic?: boolean;
+  // maximum number of memoized argument combinations, 10000 by default
+  cacheSize?: number;
+}
+
+export interface UdfModuleOptions extends UdfOptions {
+  // number of worker threads, defaults to the number of CPUs
+  threads?: number;
+  // export of the module to call, defaults to module.exports or its default export
+  exportName?: string;
 }
 
 export class IpcResultStreamIterator implements AsyncIterator<Uint8Array>, AsyncIterable<Uint8Array> {
@@ -120,14 +181,54 @@ export class IpcResultStreamIterator implements AsyncIterator<Uint8Array>, Async
   toArray(): Promise<ArrowArray>;
 }
 
+export interface ColumnarColumn {
+  name?: string;
+  sqlType: string;
+  physicalType: string;
+  validity: Uint8Array;
+  data?: ArrayLike<any>;
+  offsets?: Int32Array;
+  children?: ColumnarColumn[];
+}
+
+export interface ColumnarBatch {
+  rows: number;
+  columns: ColumnarColumn[];
+}
+
 export interface ReplacementScanResult {
   function: string;
   parameters: Array<unknown>;
 }
 
+export interface ReplacementScanColumns {
+  columns: Record<string, Array<unknown> | ArrayBufferView>;
+}
+
+export interface ReplacementScanBatches {
+  batches: ColumnarBatch[];
+}
+
 export type ReplacementScanCallback = (
   table: string
-) => ReplacementScanResult | null;
+) => ReplacementScanResult | ReplacementScanColumns | ReplacementScanBatches | null;
+
+export interface ReplacementScanOptions {
+  cache?: boolean;
+  ttl?: number;
+}
+
+export interface JSFileSystem {
+  read(path: string, offset: number, length: number): Buffer | Uint8Array | Promise<Buffer | Uint8Array>;
+  size(path: string): number | null | Promise<number | null>;
+  glob?(pattern: string): string[] | Promise<string[]>;
+}
+
+export interface JSFileSystemOptions {
+  blockSize?: number;
+  cacheSize?: number;
+  readAhead?: number;
+}
 
 export enum TokenType {
   IDENTIFIER = 0,
@@ -154,6 +255,9 @@ export class Database {
   all(sql: string, ...args: [...any, Callback<TableData>] | []): this;
   arrowIPCAll(sql: string, ...args: [...any, Callback<ArrowArray>] | []): void;
   each(sql: string, ...args: [...any, Callback<RowData>] | []): this;
+  allColumnar(sql: string, ...args: [...any, Callback<ColumnarBatch[]>] | []): this;
+  allJSON(sql: string | JSONOptions, ...args: [...any, Callback<Buffer>] | []): this;
+  eachChunk(sql: string, ...args: [...any, Callback<RowData[]>] | []): this;
   exec(sql: string, ...args: [...any, Callback<void>] | []): void;
 
   prepare(sql: string, ...args: [...any, Callback<Statement>] | []): Statement;
@@ -162,12 +266,23 @@ export class Database {
   register_udf(
     name: string,
     return_type: string,
-    fun: (...args: any[]) => any
+    fun: (...args: any[]) => any,
+    options?: UdfOptions
+  ): void;
+  register_udf_module(
+    name: string,
+    return_type: string,
+    module: string,
+    options?: UdfModuleOptions,
+    callback?: Callback<void>
   ): void;
   unregister_udf(name: string, callback: Callback<any>): void;
 
   stream(sql: any, ...args: any[]): QueryResult;
   arrowIPCStream(sql: any, ...args: any[]): Promise<IpcResultStreamIterator>;
+  exportStream(sql: string, options?: ExportStreamOptions): Readable;
+  createInsertStream(table: string, options?: InsertStreamOptions): InsertStream;
+  pipeline(queries: PipelineQuery[]): Promise<TableData[]>;
 
   serialize(done?: Callback<void>): void;
   parallelize(done?: Callback<void>): void;
@@ -183,10 +298,23 @@ export class Database {
   unregister_buffer(name: string, callback?: Callback<void>): void;
 
   registerReplacementScan(
-    replacementScan: ReplacementScanCallback
+    replacementScan: ReplacementScanCallback,
+    options?: ReplacementScanOptions
   ): Promise<void>;
 
+  invalidateReplacementScans(table?: string): this;
+
   tokenize(text: string): ScriptTokens;
+
+  registerFileBuffer(name: string, buffer: Buffer, callback?: Callback<void>): this;
+  unregisterFileBuffer(name: string, callback?: Callback<void>): this;
+  getFileBuffer(name: string, callback: Callback<Buffer>): this;
+
+  registerFileSystem(
+    prefix: string,
+    fileSystem: JSFileSystem,
+    options?: JSFileSystemOptions
+  ): Promise<void>;
 }
 
 export type GenericTypeInfo = {
@@ -255,8 +383,14 @@ export class Statement {
 
   arrowIPCAll(...args: [...any, Callback<ArrowArray>] | any[]): void;
 
+  allColumnar(...args: [...any, Callback<ColumnarBatch[]>] | any[]): this;
+
+  allJSON(...args: [...any, Callback<Buffer>] | any[]): this;
+
   each(...args: [...any, Callback<RowData>] | any[]): this;
 
+  eachChunk(...args: [...any, Callback<RowData[]>] | any[]): this;
+
   finalize(callback?: Callback<void>): void;
 
   run(...args: [...any, Callback<void>] | any[]): Statement;
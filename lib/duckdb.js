@@ -4,6 +4,12 @@
  */
 
 var duckdb = require('./duckdb-binding.js');
+var Readable = require('stream').Readable;
+var Writable = require('stream').Writable;
+var udf = require('./udf.js');
+var os = require('os');
+var path = require('path');
+var Worker = require('worker_threads').Worker;
 module.exports = exports = duckdb;
 
 /**
@@ -84,6 +90,15 @@ QueryResult.prototype.nextChunk;
  */
 QueryResult.prototype.nextIpcBuffer;
 
+/**
+ * Function to fetch the next chunk of the result as NDJSON, written on a worker thread
+ *
+ * @method
+ * @arg [options] - `{bigint: 'string' | 'number'}`
+ * @return Promise<Buffer | null>
+ */
+QueryResult.prototype.nextJSON;
+
 /**
  * @name asyncIterator
  * @memberof module:duckdb~QueryResult
@@ -132,6 +147,61 @@ Connection.prototype.all = function (sql) {
     return statement.all.apply(statement, arguments);
 }
 
+/**
+ * Run many small queries with as few round trips to the worker threads as possible. All queries are queued at once
+ * with pipelining enabled, so they are executed in batches per worker hop and their results are delivered together.
+ * Every query runs, even after an earlier one failed.
+ * @arg queries - SQL strings or `{sql, params}` objects
+ * @return {Promise<TableData[]>} the rows of every query in order, rejected with the first error
+ */
+Connection.prototype.pipeline = function (queries) {
+    var conn = this;
+    return new Promise(function (resolve, reject) {
+        var results = new Array(queries.length);
+        var remaining = queries.length;
+        var error = null;
+        if (remaining === 0) {
+            resolve(results);
+            return;
+        }
+        var previous = conn.set_pipelining_internal(true);
+        try {
+            queries.forEach(function (query, idx) {
+                var sql = typeof query === 'string' ? query : query.sql;
+                var params = typeof query === 'string' ? [] : (query.params || []);
+                conn.all.apply(conn, [sql].concat(params, [function (err, rows) {
+                    if (err && !error) {
+                        error = err;
+                        error.index = idx;
+                    }
+                    results[idx] = rows;
+                    if (--remaining === 0) {
+                        if (error) {
+                            reject(error);
+                        } else {
+                            resolve(results);
+                        }
+                    }
+                }]));
+            });
+        } finally {
+            conn.set_pipelining_internal(previous);
+        }
+    });
+}
+
+/**
+ * Execute consecutive queued statements of this connection in one worker hop and deliver their callbacks in one turn
+ * of the event loop. Applies to statements, queries and exec calls issued while enabled. Callbacks of a batch are
+ * only called once the whole batch has run.
+ * @arg enabled
+ * @return {Connection}
+ */
+Connection.prototype.setPipelining = function (enabled) {
+    this.set_pipelining_internal(!!enabled);
+    return this;
+}
+
 // Utility class for streaming Apache Arrow IPC
 class IpcResultStreamIterator {
     constructor(stream_result_p) {
@@ -214,129 +284,227 @@ Connection.prototype.each = function (sql) {
 }
 
 /**
+ * Runs a SQL query and returns the result in a columnar, Arrow-like layout: an array of batches
+ * `{rows, columns}`, with per column `name`, `sqlType`, `validity` and a typed `data` array. Lists, maps and
+ * arrays come with an `offsets` Int32Array and their elements as `children[0]`, struct fields are `children`.
+ * Fixed-width `data` arrays and BLOB values are views over the result memory rather than copies, so the result
+ * chunk stays allocated until the last of them is garbage collected.
+ * @arg sql
+ * @param {...*} params
+ * @param callback
+ * @return {void}
+ */
+Connection.prototype.allColumnar = function (sql) {
+    var statement = new Statement(this, sql);
+    return statement.allColumnar.apply(statement, arguments);
+}
+
+/**
+ * Runs a SQL query and triggers the callback once per chunk of result rows (up to 2048 rows), the
+ * next chunk is fetched in the background between callbacks
+ * @arg sql
+ * @param {...*} params
+ * @param callback
+ * @return {void}
+ */
+Connection.prototype.eachChunk = function (sql) {
+    var statement = new Statement(this, sql);
+    return statement.eachChunk.apply(statement, arguments);
+}
+
+// Splits the `{sql, ...options}` form accepted by the JSON methods into the options and the plain arguments
+function jsonArguments(args) {
+    args = Array.prototype.slice.call(args);
+    var options = {};
+    if (typeof args[0] === 'object' && args[0] !== null) {
+        options = args[0];
+        args[0] = options.sql;
+    }
+    return { options: options, args: args };
+}
+
+/**
+ * Run a SQL query and return the result as JSON text in a Buffer, written on a worker thread.
+ * Values map as they would through `JSON.stringify(rows)`: dates become ISO strings, BIGINT and HUGEINT
+ * values numbers (or strings with `bigint: 'string'`).
+ * Pass `{sql, bigint: 'string' | 'number', format: 'json' | 'ndjson'}` instead of the sql string to set options.
+ * @arg sql
+ * @param {...*} params
+ * @param callback - called with a Buffer holding a JSON array, or one object per line for ndjson
+ * @return {void}
+ */
+Connection.prototype.allJSON = function () {
+    var json = jsonArguments(arguments);
+    var statement = new Statement(this, json.args[0]);
+    return statement.all_json_internal.apply(statement, [json.options].concat(json.args));
+}
+
+/**
+ * Pass `{sql, format: 'ndjson', bigint}` instead of the sql string to receive NDJSON Buffers (one per chunk, written
+ * on a worker thread) instead of rows.
  * @arg sql
  * @param {...*} params
  * @yields row chunks
  */
-Connection.prototype.stream = async function* (sql) {
-    const statement = new Statement(this, sql);
-    const queryResult = await statement.stream.apply(statement, arguments);
+Connection.prototype.stream = async function* () {
+    const json = jsonArguments(arguments);
+    const statement = new Statement(this, json.args[0]);
+    const queryResult = await statement.stream.apply(statement, json.args);
+    if (json.options.format === 'ndjson') {
+        let prefetch = queryResult.nextJSON(json.options);
+        while (true) {
+            const buffer = await prefetch;
+            if (!buffer) {
+                return;
+            }
+            prefetch = queryResult.nextJSON(json.options);
+            yield buffer;
+        }
+    }
     for await (const result of queryResult) {
         yield result;
     }
 }
 
+/**
+ * Export the result of a SQL query as a Readable of encoded bytes, written by DuckDB's own COPY writers on worker
+ * threads. Writers pause while `highWaterMark` bytes (default 1 MiB) wait to be read, so exports of any size stream
+ * with bounded memory. Other options are passed on to COPY, e.g. `{format: 'csv', header: false}` or
+ * `{format: 'parquet', compression: 'zstd'}`. The export runs on a connection and a thread of its own, so other
+ * queries proceed while the stream is read. It therefore only sees committed data, not the temporary tables,
+ * settings or uncommitted changes of this connection.
+ * @arg sql
+ * @arg options - `{format: 'csv' | 'ndjson' | 'parquet', highWaterMark, ...copyOptions}`
+ * @return {Readable}
+ */
+Connection.prototype.exportStream = function (sql, options) {
+    options = options || {};
+    var pipe;
+    var readable = new Readable({
+        highWaterMark: options.highWaterMark,
+        read: function () {
+            pipe.resume();
+        },
+        destroy: function (err, callback) {
+            if (completed) {
+                callback(err);
+                return;
+            }
+            // 'close' is emitted once the insert has been rolled back
+            pending = null;
+            done = function () {
+                callback(err);
+            };
+            pipe.cancel();
+        }
+    });
+    pipe = this.export_stream_internal(sql, options, function (err, buffer) {
+        if (err) {
+            readable.destroy(err);
+            return false;
+        }
+        if (buffer === null) {
+            readable.push(null);
+            return false;
+        }
+        return readable.push(buffer);
+    });
+    return readable;
+}
+
+/**
+ * Insert CSV or NDJSON written to the returned Writable into a table, parsed incrementally by DuckDB's own readers on
+ * worker threads. Writes wait while `highWaterMark` bytes (default 1 MiB) have not been parsed yet. Other options are
+ * passed to read_csv or read_ndjson, e.g. `{format: 'csv', header: false, columns: {a: 'INTEGER'}}`. CSV columns are
+ * inserted by position, NDJSON keys by name. The rows are inserted in one statement, which completes before 'finish'
+ * is emitted and is rolled back if the stream errors or is destroyed. The insert runs on a connection and a thread of
+ * its own, so other queries proceed while the stream is written, and it is committed independently of any
+ * transaction open on this connection.
+ * The number of inserted rows is available as `rowCount` on the Writable once it has finished.
+ * @arg table
+ * @arg options - `{format: 'csv' | 'ndjson', highWaterMark, ...readerOptions}`
+ * @return {Writable}
+ */
+Connection.prototype.createInsertStream = function (table, options) {
+    options = options || {};
+    var pending = null;
+    var done = null;
+    var completed = false;
+    var insertError = null;
+    var pipe = this.insert_stream_internal(table, options, function () {
+        var callback = pending;
+        pending = null;
+        if (callback) {
+            callback();
+        }
+    }, function (err, count) {
+        completed = true;
+        insertError = err;
+        writable.rowCount = count;
+        var callback = done || pending;
+        done = pending = null;
+        if (callback) {
+            callback(err);
+        } else if (err) {
+            writable.destroy(err);
+        }
+    });
+    var writable = new Writable({
+        highWaterMark: options.highWaterMark,
+        write: function (chunk, encoding, callback) {
+            if (completed) {
+                callback(insertError || new Error('Insert stream has already completed'));
+            } else if (pipe.write(chunk)) {
+                callback();
+            } else {
+                pending = callback;
+            }
+        },
+        final: function (callback) {
+            if (completed) {
+                callback(insertError);
+                return;
+            }
+            done = callback;
+            pipe.end();
+        },
+        destroy: function (err, callback) {
+            if (completed) {
+                callback(err);
+                return;
+            }
+            // 'close' is emitted once the insert has been rolled back
+            pending = null;
+            done = function () {
+                callback(err);
+            };
+            pipe.cancel();
+        }
+    });
+    return writable;
+}
+
 /**
  * Register a User Defined Function
  *
+ * With `{deterministic: true}`, the function promises to return the same result for the same arguments: it may be
+ * evaluated once for constant arguments while optimizing, and its results are memoized in a cache of up to
+ * `cacheSize` (default 10000) argument combinations, so it is only called for distinct arguments not seen before.
+ * Other UDFs are called for every row.
+ *
  * @arg name
  * @arg return_type
  * @arg fun
+ * @arg options - `{deterministic, cacheSize}`
  * @return {void}
  * @note this follows the wasm udfs somewhat but is simpler because we can pass data much more cleanly
  */
-Connection.prototype.register_udf = function (name, return_type, fun) {
+Connection.prototype.register_udf = function (name, return_type, fun, options) {
+    var vectorized = udf.vectorize(fun);
     // TODO what if this throws an error somewhere? do we need a try/catch?
     return this.register_udf_bulk(name, return_type, function (desc) {
         try {
-            // Build an argument resolver
-            const buildResolver = (arg) => {
-                let validity = arg.validity || null;
-                switch (arg.physicalType) {
-                    case 'STRUCT': {
-                        const tmp = {};
-                        const children = [];
-                        for (let j = 0; j < (arg.children.length || 0); ++j) {
-                            const attr = arg.children[j];
-                            const child = buildResolver(attr);
-                            children.push((row) => {
-                                tmp[attr.name] = child(row);
-                            });
-                        }
-                        if (validity != null) {
-                            return (row) => {
-                                if (!validity[row]) {
-                                    return null;
-                                }
-                                for (const resolver of children) {
-                                    resolver(row);
-                                }
-                                return tmp;
-                            };
-                        } else {
-                            return (row) => {
-                                for (const resolver of children) {
-                                    resolver(row);
-                                }
-                                return tmp;
-                            };
-                        }
-                    }
-                    default: {
-                        if (arg.data === undefined) {
-                            throw new Error(
-                                'malformed data view, expected data buffer for argument of type: ' + arg.physicalType,
-                            );
-                        }
-                        const data = arg.data;
-                        if (validity != null) {
-                            return (row) => (!validity[row] ? null : data[row]);
-                        } else {
-                            return (row) => data[row];
-                        }
-                    }
-                }
-            };
-
-            // Translate argument data
-            const argResolvers = [];
-            for (let i = 0; i < desc.args.length; ++i) {
-                argResolvers.push(buildResolver(desc.args[i]));
-            }
-            const args = [];
-            for (let i = 0; i < desc.args.length; ++i) {
-                args.push(null);
-            }
-
-            // Return type
-            desc.ret.validity = new Uint8Array(desc.rows);
-            switch (desc.ret.physicalType) {
-                case 'INT8':
-                    desc.ret.data = new Int8Array(desc.rows);
-                    break;
-                case 'INT16':
-                    desc.ret.data = new Int16Array(desc.rows);
-                    break;
-                case 'INT32':
-                    desc.ret.data = new Int32Array(desc.rows);
-                    break;
-                case 'DOUBLE':
-                    desc.ret.data = new Float64Array(desc.rows);
-                    break;
-                case 'DATE64':
-                case 'TIME64':
-                case 'TIMESTAMP':
-                case 'INT64':
-                    desc.ret.data = new BigInt64Array(desc.rows);
-                    break;
-                case 'UINT64':
-                    desc.ret.data = new BigUint64Array(desc.rows);
-                    break;
-                case 'BLOB':
-                case 'VARCHAR':
-                    desc.ret.data = new Array(desc.rows);
-                    break;
-            }
-
-            // Call the function
-            for (let i = 0; i < desc.rows; ++i) {
-                for (let j = 0; j < desc.args.length; ++j) {
-                    args[j] = argResolvers[j](i);
-                }
-                const res = fun(...args);
-                desc.ret.data[i] = res;
-                desc.ret.validity[i] = res === undefined || res === null ? 0 : 1;
-            }
+            vectorized(desc);
         } catch (error) { // work around recently fixed napi bug https://github.com/nodejs/node-addon-api/issues/912
             msg = error;
             if (typeof error == 'object' && 'message' in error) {
@@ -344,7 +512,112 @@ Connection.prototype.register_udf = function (name, return_type, fun) {
             }
             throw { name: 'DuckDB-UDF-Exception', message: msg };
         }
-    })
+    }, undefined, options)
+}
+
+// Evaluates UDF vectors in worker threads that load the UDF module, started on demand up to `size` threads
+function UdfWorkerPool(module, options) {
+    this.workerData = { module: module, exportName: options.exportName };
+    this.size = options.threads || os.cpus().length;
+    this.workers = [];
+    this.idle = [];
+    this.queue = [];
+}
+
+UdfWorkerPool.prototype.run = function (desc, complete) {
+    this.queue.push({ desc: desc, complete: complete });
+    this.dispatch();
+}
+
+UdfWorkerPool.prototype.dispatch = function () {
+    while (this.queue.length > 0) {
+        if (this.idle.length == 0 && this.workers.length < this.size) {
+            this.spawn();
+        }
+        if (this.idle.length == 0) {
+            return;
+        }
+        var worker = this.idle.pop();
+        worker.job = this.queue.shift();
+        worker.postMessage(worker.job.desc);
+    }
+}
+
+UdfWorkerPool.prototype.spawn = function () {
+    var pool = this;
+    var worker = new Worker(path.join(__dirname, 'udf_worker.js'), { workerData: this.workerData });
+    // idle workers must not keep the process alive, pending vectors are kept alive by the query
+    worker.unref();
+    var fail = function (err) {
+        pool.workers = pool.workers.filter(function (w) { return w !== worker; });
+        pool.idle = pool.idle.filter(function (w) { return w !== worker; });
+        var job = worker.job;
+        worker.job = null;
+        if (job) {
+            job.complete(err);
+        }
+        pool.dispatch();
+    };
+    worker.on('message', function (message) {
+        var job = worker.job;
+        worker.job = null;
+        pool.idle.push(worker);
+        if (message.error !== undefined) {
+            job.complete(new Error(message.error));
+        } else {
+            job.complete(null, message.ret);
+        }
+        pool.dispatch();
+    });
+    worker.on('error', fail);
+    worker.on('exit', function (code) {
+        fail(new Error('UDF worker exited with code ' + code));
+    });
+    this.workers.push(worker);
+    this.idle.push(worker);
+}
+
+UdfWorkerPool.prototype.terminate = function () {
+    var workers = this.workers;
+    this.size = 0;
+    this.workers = [];
+    this.idle = [];
+    var queue = this.queue;
+    this.queue = [];
+    for (var i = 0; i < queue.length; i++) {
+        queue[i].complete(new Error('UDF was unregistered'));
+    }
+    for (var j = 0; j < workers.length; j++) {
+        workers[j].terminate();
+    }
+}
+
+/**
+ * Register a User Defined Function evaluated in a pool of worker threads, so that CPU-heavy functions use several
+ * cores and leave the event loop free. Each worker loads `module`, which exports the scalar function as
+ * `module.exports`, as its default export or under `options.exportName`. Vectors of rows are handed to idle workers
+ * as DuckDB threads request them, the arguments and results are copied between threads.
+ *
+ * @arg name
+ * @arg return_type
+ * @arg module - path of the module, relative paths are resolved against the working directory
+ * @arg options - `{threads, exportName, deterministic, cacheSize}`, threads defaults to the number of CPUs, see
+ * Connection#register_udf for the others
+ * @param callback
+ * @return {void}
+ */
+Connection.prototype.register_udf_module = function (name, return_type, module, options, callback) {
+    if (typeof options === 'function') {
+        callback = options;
+        options = undefined;
+    }
+    options = options || {};
+    var pool = new UdfWorkerPool(path.resolve(module), options);
+    this.register_udf_bulk(name, return_type, function (desc, complete) {
+        pool.run(desc, complete);
+    }, callback, { async: true, deterministic: options.deterministic, cacheSize: options.cacheSize });
+    this.udf_pools = this.udf_pools || {};
+    this.udf_pools[name] = pool;
 }
 
 /**
@@ -378,13 +651,33 @@ Connection.prototype.register_udf_bulk;
 /**
  * Unregister a User Defined Function
  *
+ * @arg name
+ * @param callback
+ * @return {void}
+ */
+Connection.prototype.unregister_udf = function (name, callback) {
+    var pool = this.udf_pools && this.udf_pools[name];
+    if (pool) {
+        delete this.udf_pools[name];
+    }
+    return this.unregister_udf_internal(name, function () {
+        if (pool) {
+            pool.terminate();
+        }
+        if (callback) {
+            callback.apply(this, arguments);
+        }
+    });
+}
+/**
+ * Internal method. Do not use, call Connection#unregister_udf instead
+ *
  * @method
  * @arg name
- * @arg return_type
  * @param callback
  * @return {void}
  */
-Connection.prototype.unregister_udf;
+Connection.prototype.unregister_udf_internal;
 
 var default_connection = function (o) {
     if (o.default_connection == undefined) {
@@ -416,6 +709,35 @@ Connection.prototype.register_buffer;
  */
 Connection.prototype.unregister_buffer;
 
+/**
+ * Internal method. Do not use, call Connection#exportStream instead
+ * @method
+ * @arg sql
+ * @arg options
+ * @arg deliver
+ * @return {{resume: function(): void, cancel: function(): void}}
+ */
+Connection.prototype.export_stream_internal;
+
+/**
+ * Internal method. Do not use, call Connection#createInsertStream instead
+ * @method
+ * @arg table
+ * @arg options
+ * @arg drain
+ * @arg callback
+ * @return {{write: function(Buffer): boolean, end: function(): void, cancel: function(): void}}
+ */
+Connection.prototype.insert_stream_internal;
+
+/**
+ * Internal method. Do not use, call Connection#setPipelining instead
+ * @method
+ * @arg enabled
+ * @return {boolean} whether pipelining was enabled before
+ */
+Connection.prototype.set_pipelining_internal;
+
 /**
  * Closes connection
  * @method
@@ -530,6 +852,71 @@ Database.prototype.each = function () {
     return this;
 }
 
+/**
+ * Convenience method for Connection#allColumnar
+ * @arg sql
+ * @param {...*} params
+ * @param callback
+ * @return {this}
+ */
+Database.prototype.allColumnar = function () {
+    default_connection(this).allColumnar.apply(this.default_connection, arguments);
+    return this;
+}
+
+/**
+ * Convenience method for Connection#allJSON
+ * @arg sql
+ * @param {...*} params
+ * @param callback
+ * @return {this}
+ */
+Database.prototype.allJSON = function () {
+    default_connection(this).allJSON.apply(this.default_connection, arguments);
+    return this;
+}
+
+/**
+ * Convenience method for Connection#exportStream
+ * @arg sql
+ * @arg options
+ * @return {Readable}
+ */
+Database.prototype.exportStream = function () {
+    return default_connection(this).exportStream.apply(this.default_connection, arguments);
+}
+
+/**
+ * Convenience method for Connection#createInsertStream
+ * @arg table
+ * @arg options
+ * @return {Writable}
+ */
+Database.prototype.createInsertStream = function () {
+    return default_connection(this).createInsertStream.apply(this.default_connection, arguments);
+}
+
+/**
+ * Convenience method for Connection#pipeline using a built-in default connection
+ * @arg queries
+ * @return {Promise<TableData[]>}
+ */
+Database.prototype.pipeline = function () {
+    return default_connection(this).pipeline.apply(this.default_connection, arguments);
+}
+
+/**
+ * Convenience method for Connection#eachChunk
+ * @arg sql
+ * @param {...*} params
+ * @param callback
+ * @return {this}
+ */
+Database.prototype.eachChunk = function () {
+    default_connection(this).eachChunk.apply(this.default_connection, arguments);
+    return this;
+}
+
 
 /**
  * @arg sql
@@ -625,6 +1012,21 @@ Database.prototype.unregister_buffer = function () {
     return this;
 }
 
+/**
+ * Register a UDF evaluated in worker threads
+ *
+ * Convenience method for Connection#register_udf_module
+ * @arg name
+ * @arg return_type
+ * @arg module
+ * @arg options
+ * @return {this}
+ */
+Database.prototype.register_udf_module = function () {
+    default_connection(this).register_udf_module.apply(this.default_connection, arguments);
+    return this;
+}
+
 /**
  * Unregister a UDF
  *
@@ -639,13 +1041,28 @@ Database.prototype.unregister_udf = function () {
 
 /**
  * Register a table replace scan function
+ *
+ * The function is called with the name of an unknown table and returns `null`, a table function call
+ * `{function, parameters}`, or the data itself: `{columns: {name: values}}` with an array or typed array per
+ * column, or `{batches}` as returned by allColumnar. Data is copied into DuckDB once per call.
+ * With `options.cache` (or a `options.ttl` in milliseconds) results are kept per table name, so repeated
+ * binds do not call into JS until they expire or are invalidated.
  * @method
  * @arg fun Replacement scan function
- * @return {this}
+ * @arg options
+ * @return {Promise<void>}
  */
 
 Database.prototype.registerReplacementScan;
 
+/**
+ * Drops cached replacement scan results, for a single table name or all of them
+ * @method
+ * @arg [table]
+ * @return {this}
+ */
+Database.prototype.invalidateReplacementScans;
+
 /**
  * Return positions and types of tokens in given text
  * @method
@@ -654,6 +1071,76 @@ Database.prototype.registerReplacementScan;
  */
 Database.prototype.tokenize;
 
+/**
+ * Register a Buffer as an in-memory file, readable under `mem://<name>` by e.g. read_parquet, read_csv or read_json.
+ * The file is read directly from the Buffer, which must not be modified while registered.
+ * @method
+ * @arg name
+ * @arg buffer
+ * @param callback
+ * @return {this}
+ */
+Database.prototype.registerFileBuffer;
+
+/**
+ * Remove an in-memory file, either registered or written by DuckDB (e.g. COPY ... TO 'mem://<name>')
+ * @method
+ * @arg name
+ * @param callback
+ * @return {this}
+ */
+Database.prototype.unregisterFileBuffer;
+
+/**
+ * Retrieve the contents of an in-memory file, e.g. the output of COPY ... TO 'mem://<name>'
+ * @method
+ * @arg name
+ * @param callback
+ * @return {this}
+ */
+Database.prototype.getFileBuffer;
+
+/**
+ * Register a read-only file system for paths starting with `prefix`, served by (asynchronous) JS callbacks.
+ * Reads are aligned to blocks of `blockSize` bytes, coalesced into a single `read` call and cached, so the
+ * callbacks see few large range requests. The callbacks must not query this database.
+ * @method
+ * @arg prefix - e.g. 'blob://'
+ * @arg fileSystem - object with `read(path, offset, length)` returning a Buffer, `size(path)` returning the
+ * file size or null if the file does not exist and optionally `glob(pattern)` returning matching paths;
+ * each may return a Promise
+ * @arg options - optional `blockSize` (default 1 MiB), `cacheSize` (default 64 MiB) and `readAhead` in blocks
+ * (default 1)
+ * @return {Promise<void>}
+ */
+Database.prototype.registerFileSystem = function (prefix, fileSystem, options) {
+    var dispatch = function (op, path, offset, length, done) {
+        Promise.resolve().then(function () {
+            switch (op) {
+                case 'read':
+                    return fileSystem.read(path, offset, length);
+                case 'size':
+                    return fileSystem.size(path);
+                case 'glob':
+                    return fileSystem.glob ? fileSystem.glob(path) : [];
+            }
+            throw new Error('Unknown file system operation ' + op);
+        }).then(function (result) {
+            done(null, result);
+        }, function (err) {
+            done(err || new Error('File system ' + op + ' failed'));
+        });
+    };
+    return this.register_file_system_internal(prefix, dispatch, options);
+};
+
+/**
+ * Internal method. Do not use, call Database#registerFileSystem instead
+ * @method
+ * @return {Promise<void>}
+ */
+Database.prototype.register_file_system_internal;
+
 /**
  * Not implemented
  */
@@ -692,6 +1179,32 @@ Statement.prototype.all;
  * @return {void}
  */
 Statement.prototype.arrowIPCAll;
+/**
+ * @method
+ * @arg sql
+ * @param {...*} params
+ * @param callback - called with an array of column batches, see Connection#allColumnar
+ * @return {void}
+ */
+Statement.prototype.allColumnar;
+/**
+ * @arg sql
+ * @param {...*} params
+ * @param callback - called with the result as JSON text, see Connection#allJSON
+ * @return {void}
+ */
+Statement.prototype.allJSON = function () {
+    return this.all_json_internal.apply(this, [{}].concat(Array.prototype.slice.call(arguments)));
+}
+/**
+ * Internal method. Do not use, call Connection#allJSON instead
+ * @method
+ * @arg options
+ * @param {...*} params
+ * @param callback
+ * @return {void}
+ */
+Statement.prototype.all_json_internal;
 /**
  * @method
  * @arg sql
@@ -700,6 +1213,15 @@ Statement.prototype.arrowIPCAll;
  * @return {void}
  */
 Statement.prototype.each;
+/**
+ * @method
+ * @arg sql
+ * @param {...*} params
+ * @param callback - called with an array of rows per chunk
+ * @param complete - called with the total number of rows
+ * @return {void}
+ */
+Statement.prototype.eachChunk;
 /**
  * @method
  * @arg sql
@@ -0,0 +1,132 @@
+/**
+ * Vectorized evaluation of scalar JS functions, shared by UDFs running on the main thread and in worker threads
+ */
+
+/**
+ * Wraps a scalar function into one that evaluates a whole vector: reads the arguments of `desc.args` row by row and
+ * writes the results into `desc.ret.data` and `desc.ret.validity`
+ * @arg fun
+ * @return {function(Object): void}
+ */
+function vectorize(fun) {
+    return function (desc) {
+        // Build an argument resolver
+        const buildResolver = (arg) => {
+            let validity = arg.validity || null;
+            switch (arg.physicalType) {
+                case 'STRUCT': {
+                    const children = [];
+                    for (let j = 0; j < (arg.children.length || 0); ++j) {
+                        const attr = arg.children[j];
+                        const child = buildResolver(attr);
+                        children.push((tmp, row) => {
+                            tmp[attr.name] = child(row);
+                        });
+                    }
+                    if (validity != null) {
+                        return (row) => {
+                            if (!validity[row]) {
+                                return null;
+                            }
+                            const tmp = {};
+                            for (const resolver of children) {
+                                resolver(tmp, row);
+                            }
+                            return tmp;
+                        };
+                    } else {
+                        return (row) => {
+                            const tmp = {};
+                            for (const resolver of children) {
+                                resolver(tmp, row);
+                            }
+                            return tmp;
+                        };
+                    }
+                }
+                // lists, maps (lists of key/value structs) and fixed size arrays
+                case 'LIST':
+                case 'ARRAY': {
+                    const offsets = arg.offsets;
+                    const child = buildResolver(arg.children[0]);
+                    return (row) => {
+                        if (validity != null && !validity[row]) {
+                            return null;
+                        }
+                        const begin = offsets[row];
+                        const list = new Array(offsets[row + 1] - begin);
+                        for (let k = 0; k < list.length; ++k) {
+                            list[k] = child(begin + k);
+                        }
+                        return list;
+                    };
+                }
+                default: {
+                    if (arg.data === undefined) {
+                        throw new Error(
+                            'malformed data view, expected data buffer for argument of type: ' + arg.physicalType,
+                        );
+                    }
+                    const data = arg.data;
+                    if (validity != null) {
+                        return (row) => (!validity[row] ? null : data[row]);
+                    } else {
+                        return (row) => data[row];
+                    }
+                }
+            }
+        };
+
+        // Translate argument data
+        const argResolvers = [];
+        for (let i = 0; i < desc.args.length; ++i) {
+            argResolvers.push(buildResolver(desc.args[i]));
+        }
+        const args = [];
+        for (let i = 0; i < desc.args.length; ++i) {
+            args.push(null);
+        }
+
+        // Return type
+        desc.ret.validity = new Uint8Array(desc.rows);
+        switch (desc.ret.physicalType) {
+            case 'INT8':
+                desc.ret.data = new Int8Array(desc.rows);
+                break;
+            case 'INT16':
+                desc.ret.data = new Int16Array(desc.rows);
+                break;
+            case 'INT32':
+                desc.ret.data = new Int32Array(desc.rows);
+                break;
+            case 'DOUBLE':
+                desc.ret.data = new Float64Array(desc.rows);
+                break;
+            case 'DATE64':
+            case 'TIME64':
+            case 'TIMESTAMP':
+            case 'INT64':
+                desc.ret.data = new BigInt64Array(desc.rows);
+                break;
+            case 'UINT64':
+                desc.ret.data = new BigUint64Array(desc.rows);
+                break;
+            case 'BLOB':
+            case 'VARCHAR':
+                desc.ret.data = new Array(desc.rows);
+                break;
+        }
+
+        // Call the function
+        for (let i = 0; i < desc.rows; ++i) {
+            for (let j = 0; j < desc.args.length; ++j) {
+                args[j] = argResolvers[j](i);
+            }
+            const res = fun(...args);
+            desc.ret.data[i] = res;
+            desc.ret.validity[i] = res === undefined || res === null ? 0 : 1;
+        }
+    };
+}
+
+module.exports = { vectorize: vectorize };
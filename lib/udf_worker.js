@@ -0,0 +1,32 @@
+/**
+ * Worker thread evaluating vectors for a UDF registered with Connection#register_udf_module
+ */
+
+var worker_threads = require('worker_threads');
+var udf = require('./udf.js');
+
+var exported = require(worker_threads.workerData.module);
+var exportName = worker_threads.workerData.exportName;
+var fun = exportName ? exported[exportName] : (typeof exported === 'function' ? exported : exported.default);
+if (typeof fun !== 'function') {
+    throw new Error('Module ' + worker_threads.workerData.module + ' does not export a function' +
+        (exportName ? ' named ' + exportName : ''));
+}
+var vectorized = udf.vectorize(fun);
+
+// one vector at a time, the pool only sends the next one once this one has been answered
+worker_threads.parentPort.on('message', function (desc) {
+    try {
+        vectorized(desc);
+    } catch (error) {
+        worker_threads.parentPort.postMessage({
+            error: typeof error == 'object' && error !== null && 'message' in error ? error.message : String(error)
+        });
+        return;
+    }
+    var transfer = [desc.ret.validity.buffer];
+    if (ArrayBuffer.isView(desc.ret.data)) {
+        transfer.push(desc.ret.data.buffer);
+    }
+    worker_threads.parentPort.postMessage({ ret: desc.ret }, transfer);
+});
@@ -4,11 +4,17 @@
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/parser/parsed_data/drop_info.hpp"
 #include "duckdb/parser/expression/cast_expression.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+#include "duckdb/parser/qualified_name.hpp"
+#include "duckdb/parser/parsed_data/create_scalar_function_info.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/main/relation/table_function_relation.hpp"
 
 
+#include <cmath>
 #include <iostream>
+#include <list>
+#include <memory>
 #include <thread>
 
 namespace node_duckdb {
@@ -21,8 +27,12 @@ Napi::FunctionReference Connection::Init(Napi::Env env, Napi::Object exports) {
 		{InstanceMethod("prepare", &Connection::Prepare), InstanceMethod("exec", &Connection::Exec),
 		 InstanceMethod("register_udf_bulk", &Connection::RegisterUdf),
 		 InstanceMethod("register_buffer", &Connection::RegisterBuffer),
-		 InstanceMethod("unregister_udf", &Connection::UnregisterUdf), InstanceMethod("close", &Connection::Close),
-		 InstanceMethod("unregister_buffer", &Connection::UnRegisterBuffer)});
+		 InstanceMethod("unregister_udf_internal", &Connection::UnregisterUdf),
+		 InstanceMethod("close", &Connection::Close),
+		 InstanceMethod("unregister_buffer", &Connection::UnRegisterBuffer),
+		 InstanceMethod("export_stream_internal", &Connection::ExportStream),
+		 InstanceMethod("insert_stream_internal", &Connection::InsertStream),
+		 InstanceMethod("set_pipelining_internal", &Connection::SetPipelining)});
 
 	exports.Set("Connection", t);
 
@@ -112,10 +122,113 @@ struct JSArgs {
 	duckdb::idx_t rows;
 	duckdb::DataChunk *args;
 	duckdb::Vector *result;
-	bool done;
+	// the UDF completes by calling the function passed as its second argument, e.g. once a worker has answered
+	bool asynchronous;
 	duckdb::ErrorData error;
+
+	// called on the main thread once the result vector (or error) has been set
+	void Complete() {
+		std::lock_guard<std::mutex> guard(lock);
+		done = true;
+		cv.notify_one();
+	}
+
+	void Wait() {
+		std::unique_lock<std::mutex> guard(lock);
+		cv.wait(guard, [&] { return done; });
+	}
+
+private:
+	std::mutex lock;
+	std::condition_variable cv;
+	bool done = false;
 };
 
+static std::string UdfErrorMessage(Napi::Value exception_value) {
+	std::string msg;
+	if (exception_value.IsObject() && exception_value.As<Napi::Object>().Has("message")) {
+		msg = exception_value.As<Napi::Object>().Get("message").ToString().Utf8Value();
+	} else if (!exception_value.IsUndefined()) {
+		msg = exception_value.ToString().Utf8Value();
+	}
+	return msg;
+}
+
+// transform the result the JS wrapper has written into `ret` back to a vector
+static void SetUdfResult(JSArgs *jsargs, Napi::Object ret, duckdb::PhysicalType ret_type) {
+	auto return_validity = ret.Get("validity").As<Napi::Uint8Array>();
+	for (duckdb::idx_t row_idx = 0; row_idx < jsargs->rows; row_idx++) {
+		duckdb::FlatVector::SetNull(*jsargs->result, row_idx, !return_validity[row_idx]);
+	}
+
+	switch (jsargs->result->GetType().id()) {
+	case duckdb::LogicalTypeId::TINYINT: {
+		auto data = ret.Get("data").As<Napi::Int8Array>();
+		auto out = duckdb::FlatVector::GetData<int8_t>(*jsargs->result);
+		memcpy(out, data.Data(), jsargs->rows * duckdb::GetTypeIdSize(ret_type));
+		break;
+	}
+	case duckdb::LogicalTypeId::SMALLINT: {
+		auto data = ret.Get("data").As<Napi::Int16Array>();
+		auto out = duckdb::FlatVector::GetData<int16_t>(*jsargs->result);
+		memcpy(out, data.Data(), jsargs->rows * duckdb::GetTypeIdSize(ret_type));
+		break;
+	}
+	case duckdb::LogicalTypeId::INTEGER: {
+		auto data = ret.Get("data").As<Napi::Int32Array>();
+		auto out = duckdb::FlatVector::GetData<int32_t>(*jsargs->result);
+		memcpy(out, data.Data(), jsargs->rows * duckdb::GetTypeIdSize(ret_type));
+		break;
+	}
+	case duckdb::LogicalTypeId::DOUBLE: {
+		auto data = ret.Get("data").As<Napi::Float64Array>();
+		auto out = duckdb::FlatVector::GetData<double>(*jsargs->result);
+		memcpy(out, data.Data(), jsargs->rows * duckdb::GetTypeIdSize(ret_type));
+		break;
+	}
+	case duckdb::LogicalTypeId::TIME:
+	case duckdb::LogicalTypeId::TIMESTAMP:
+	case duckdb::LogicalTypeId::TIMESTAMP_MS:
+	case duckdb::LogicalTypeId::TIMESTAMP_SEC:
+	case duckdb::LogicalTypeId::TIMESTAMP_NS:
+	case duckdb::LogicalTypeId::BIGINT: {
+#if NAPI_VERSION > 5
+		auto data = ret.Get("data").As<Napi::BigInt64Array>();
+#else
+		auto data = ret.Get("data").As<Napi::Float64Array>();
+#endif
+		auto out = duckdb::FlatVector::GetData<int64_t>(*jsargs->result);
+		memcpy(out, data.Data(), jsargs->rows * duckdb::GetTypeIdSize(ret_type));
+		break;
+	}
+	case duckdb::LogicalTypeId::UBIGINT: {
+#if NAPI_VERSION > 5
+		auto data = ret.Get("data").As<Napi::BigUint64Array>();
+#else
+		auto data = ret.Get("data").As<Napi::Float64Array>();
+#endif
+		auto out = duckdb::FlatVector::GetData<uint64_t>(*jsargs->result);
+		memcpy(out, data.Data(), jsargs->rows * duckdb::GetTypeIdSize(ret_type));
+		break;
+	}
+	case duckdb::LogicalTypeId::BLOB:
+	case duckdb::LogicalTypeId::VARCHAR: {
+		auto data = ret.Get("data").As<Napi::Array>();
+		auto out = duckdb::FlatVector::GetData<duckdb::string_t>(*jsargs->result);
+		for (size_t i = 0; i < data.Length(); ++i) {
+			// Use the AddString method to save the memory into the StringHeap if it can't be inlined
+			out[i] = duckdb::StringVector::AddString(*jsargs->result, data.Get(i).ToString());
+		}
+		break;
+	}
+	default: {
+		for (duckdb::idx_t row_idx = 0; row_idx < jsargs->rows; row_idx++) {
+			duckdb::FlatVector::SetNull(*jsargs->result, row_idx, false);
+		}
+	}
+	}
+}
+
 void DuckDBNodeUDFLauncher(Napi::Env env, Napi::Function jsudf, std::nullptr_t *, JSArgs *jsargs) {
 	try { // if we dont catch exceptions here we terminate node if one happens ^^
 		Napi::EscapableHandleScope scope(env);
@@ -136,6 +249,48 @@ void DuckDBNodeUDFLauncher(Napi::Env env, Napi::Function jsudf, std::nullptr_t *
 		ret.Set("physicalType", TypeIdToString(ret_type));
 		descr.Set("ret", ret);
 
+		if (jsargs->asynchronous) {
+			// the arguments have been copied into JS, only the result vector is written once the UDF completes.
+			// jsargs is gone as soon as it is completed, so only the first completion may touch it
+			auto settled = std::make_shared<bool>(false);
+			auto complete = Napi::Function::New(env, [jsargs, ret_type, settled](const Napi::CallbackInfo &info) {
+				if (*settled) {
+					return;
+				}
+				*settled = true;
+				try {
+					if (info.Length() > 0 && !info[0].IsNull() && !info[0].IsUndefined()) {
+						throw duckdb::IOException("UDF Execution Error: " + UdfErrorMessage(info[0]));
+					}
+					if (info.Length() < 2 || !info[1].IsObject()) {
+						throw duckdb::IOException("UDF Execution Error: no result");
+					}
+					SetUdfResult(jsargs, info[1].As<Napi::Object>(), ret_type);
+				} catch (const std::exception &e) {
+					jsargs->error = duckdb::ErrorData(e);
+				}
+				jsargs->Complete();
+			});
+			bool failed = false;
+			std::string msg;
+			try {
+				jsudf({descr, complete});
+				if (env.IsExceptionPending()) {
+					failed = true;
+					msg = UdfErrorMessage(env.GetAndClearPendingException().Value());
+				}
+			} catch (const std::exception &e) {
+				failed = true;
+				msg = e.what();
+			}
+			if (failed && !*settled) {
+				*settled = true;
+				jsargs->error = duckdb::ErrorData(duckdb::IOException("UDF Execution Error: " + msg));
+				jsargs->Complete();
+			}
+			return;
+		}
+
 		// actually call the UDF, or rather its vectorized wrapper from duckdb.js/Connection.prototype.register wrapper
 		jsudf({descr});
 
@@ -144,137 +299,287 @@ void DuckDBNodeUDFLauncher(Napi::Env env, Napi::Function jsudf, std::nullptr_t *
 			auto exception = env.GetAndClearPendingException();
 			std::string msg = exception.Message();
 			if (msg.empty()) {
-				auto exception_value = exception.Value();
-				if (exception_value.IsObject() && exception_value.Has("message")) {
-					msg = exception_value.Get("message").ToString().Utf8Value();
-				}
+				msg = UdfErrorMessage(exception.Value());
 			}
 			throw duckdb::IOException("UDF Execution Error: " + msg);
 		}
 
-		// transform the result back to a vector
-		auto return_validity = ret.ToObject().Get("validity").As<Napi::Uint8Array>();
-		for (duckdb::idx_t row_idx = 0; row_idx < jsargs->rows; row_idx++) {
-			duckdb::FlatVector::SetNull(*jsargs->result, row_idx, !return_validity[row_idx]);
-		}
-
-		switch (jsargs->result->GetType().id()) {
-		case duckdb::LogicalTypeId::TINYINT: {
-			auto data = ret.Get("data").As<Napi::Int8Array>();
-			auto out = duckdb::FlatVector::GetData<int8_t>(*jsargs->result);
-			memcpy(out, data.Data(), jsargs->rows * duckdb::GetTypeIdSize(ret_type));
-			break;
-		}
-		case duckdb::LogicalTypeId::SMALLINT: {
-			auto data = ret.Get("data").As<Napi::Int16Array>();
-			auto out = duckdb::FlatVector::GetData<int16_t>(*jsargs->result);
-			memcpy(out, data.Data(), jsargs->rows * duckdb::GetTypeIdSize(ret_type));
-			break;
-		}
-		case duckdb::LogicalTypeId::INTEGER: {
-			auto data = ret.Get("data").As<Napi::Int32Array>();
-			auto out = duckdb::FlatVector::GetData<int32_t>(*jsargs->result);
-			memcpy(out, data.Data(), jsargs->rows * duckdb::GetTypeIdSize(ret_type));
-			break;
-		}
-		case duckdb::LogicalTypeId::DOUBLE: {
-			auto data = ret.Get("data").As<Napi::Float64Array>();
-			auto out = duckdb::FlatVector::GetData<double>(*jsargs->result);
-			memcpy(out, data.Data(), jsargs->rows * duckdb::GetTypeIdSize(ret_type));
-			break;
-		}
-		case duckdb::LogicalTypeId::TIME:
-		case duckdb::LogicalTypeId::TIMESTAMP:
-		case duckdb::LogicalTypeId::TIMESTAMP_MS:
-		case duckdb::LogicalTypeId::TIMESTAMP_SEC:
-		case duckdb::LogicalTypeId::TIMESTAMP_NS:
-		case duckdb::LogicalTypeId::BIGINT: {
-#if NAPI_VERSION > 5
-			auto data = ret.Get("data").As<Napi::BigInt64Array>();
-#else
-			auto data = ret.Get("data").As<Napi::Float64Array>();
-#endif
-			auto out = duckdb::FlatVector::GetData<int64_t>(*jsargs->result);
-			memcpy(out, data.Data(), jsargs->rows * duckdb::GetTypeIdSize(ret_type));
-			break;
+		SetUdfResult(jsargs, ret, ret_type);
+	} catch (const duckdb::Exception &e) {
+		jsargs->error = duckdb::ErrorData(e);
+	} catch (const std::exception &e) {
+		jsargs->error = duckdb::ErrorData(e);
+	}
+	jsargs->Complete();
+}
+
+struct UdfOptions {
+	// the UDF completes through a callback, see JSArgs
+	bool asynchronous = false;
+	// same arguments, same result: the UDF may be constant folded and its results are memoized
+	bool deterministic = false;
+	// maximum number of memoized results of a deterministic UDF
+	duckdb::idx_t cache_size = 10000;
+};
+
+static void CallUdf(duckdb_node_udf_function_t &udf, bool asynchronous, duckdb::DataChunk &args,
+					duckdb::Vector &result) {
+	// here we can do only DuckDB stuff because we do not have a functioning env
+
+	// Flatten all args to simplify udfs
+	bool all_constant = args.AllConstant();
+	args.Flatten();
+
+	JSArgs jsargs;
+	jsargs.rows = args.size();
+	jsargs.args = &args;
+	jsargs.result = &result;
+	jsargs.asynchronous = asynchronous;
+
+	udf.BlockingCall(&jsargs);
+	jsargs.Wait();
+	if (jsargs.error.HasError()) {
+		jsargs.error.Throw();
+	}
+	if (all_constant) {
+		result.SetVectorType(duckdb::VectorType::CONSTANT_VECTOR);
+	}
+}
+
+struct UdfArgumentsHash {
+	size_t operator()(const vector<duckdb::Value> &arguments) const {
+		duckdb::hash_t hash = 0;
+		for (auto &argument : arguments) {
+			hash = duckdb::CombineHash(hash, argument.Hash());
 		}
-		case duckdb::LogicalTypeId::UBIGINT: {
-#if NAPI_VERSION > 5
-			auto data = ret.Get("data").As<Napi::BigUint64Array>();
-#else
-			auto data = ret.Get("data").As<Napi::Float64Array>();
-#endif
-			auto out = duckdb::FlatVector::GetData<uint64_t>(*jsargs->result);
-			memcpy(out, data.Data(), jsargs->rows * duckdb::GetTypeIdSize(ret_type));
-			break;
-		}
-		case duckdb::LogicalTypeId::BLOB:
-		case duckdb::LogicalTypeId::VARCHAR: {
-			auto data = ret.Get("data").As<Napi::Array>();
-			auto out = duckdb::FlatVector::GetData<duckdb::string_t>(*jsargs->result);
-			for (size_t i = 0; i < data.Length(); ++i) {
-				// Use the AddString method to save the memory into the StringHeap if it can't be inlined
-				out[i] = duckdb::StringVector::AddString(*jsargs->result, data.Get(i).ToString());
+		return hash;
+	}
+};
+
+struct UdfArgumentsEquality {
+	bool operator()(const vector<duckdb::Value> &lhs, const vector<duckdb::Value> &rhs) const {
+		if (lhs.size() != rhs.size()) {
+			return false;
+		}
+		for (duckdb::idx_t i = 0; i < lhs.size(); i++) {
+			if (!duckdb::Value::NotDistinctFrom(lhs[i], rhs[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+template <class T>
+using udf_arguments_map_t = std::unordered_map<vector<duckdb::Value>, T, UdfArgumentsHash, UdfArgumentsEquality>;
+
+//! LRU cache of the results of a deterministic UDF, shared by all threads evaluating it
+struct UdfMemo {
+	explicit UdfMemo(duckdb::idx_t capacity) : capacity(capacity) {
+	}
+
+	//! Looks up the results of all arguments at once, returns the indexes of the arguments that are not memoized
+	vector<duckdb::idx_t> Get(const vector<vector<duckdb::Value>> &arguments, vector<duckdb::Value> &results) {
+		vector<duckdb::idx_t> missing;
+		std::lock_guard<std::mutex> guard(lock);
+		for (duckdb::idx_t i = 0; i < arguments.size(); i++) {
+			auto entry = index.find(arguments[i]);
+			if (entry == index.end()) {
+				missing.push_back(i);
+				continue;
 			}
-			break;
+			entries.splice(entries.begin(), entries, entry->second);
+			results[i] = entry->second->second;
+		}
+		return missing;
+	}
+
+	void Put(const vector<vector<duckdb::Value>> &arguments, const vector<duckdb::idx_t> &indexes,
+	         const vector<duckdb::Value> &results) {
+		if (capacity == 0) {
+			return;
 		}
-		default: {
-			for (duckdb::idx_t row_idx = 0; row_idx < jsargs->rows; row_idx++) {
-				duckdb::FlatVector::SetNull(*jsargs->result, row_idx, false);
+		std::lock_guard<std::mutex> guard(lock);
+		for (auto i : indexes) {
+			if (index.find(arguments[i]) != index.end()) {
+				continue;
 			}
+			entries.emplace_front(arguments[i], results[i]);
+			index[arguments[i]] = entries.begin();
 		}
+		while (entries.size() > capacity) {
+			index.erase(entries.back().first);
+			entries.pop_back();
 		}
-	} catch (const duckdb::Exception &e) {
-		jsargs->error = duckdb::ErrorData(e);
-	} catch (const std::exception &e) {
-		jsargs->error = duckdb::ErrorData(e);
 	}
-	jsargs->done = true;
+
+	duckdb::idx_t capacity;
+	std::mutex lock;
+	std::list<std::pair<vector<duckdb::Value>, duckdb::Value>> entries;
+	udf_arguments_map_t<std::list<std::pair<vector<duckdb::Value>, duckdb::Value>>::iterator> index;
+};
+
+// Calls into JS only for the distinct argument combinations of the chunk that are not memoized yet
+static void CallMemoizedUdf(duckdb_node_udf_function_t &udf, bool asynchronous, UdfMemo &memo,
+							duckdb::DataChunk &args, duckdb::Vector &result) {
+	auto count = args.size();
+	if (args.ColumnCount() == 1 && args.data[0].GetVectorType() == duckdb::VectorType::DICTIONARY_VECTOR) {
+		// evaluate the dictionary only and select the results like the dictionary selects its entries
+		auto dictionary_size = duckdb::DictionaryVector::DictionarySize(args.data[0]);
+		if (dictionary_size.IsValid() && dictionary_size.GetIndex() < count) {
+			duckdb::DataChunk dictionary;
+			dictionary.InitializeEmpty(args.GetTypes());
+			dictionary.data[0].Reference(duckdb::DictionaryVector::Child(args.data[0]));
+			dictionary.SetCardinality(dictionary_size.GetIndex());
+			duckdb::Vector dictionary_result(result.GetType());
+			CallMemoizedUdf(udf, asynchronous, memo, dictionary, dictionary_result);
+			result.Slice(dictionary_result, duckdb::DictionaryVector::SelVector(args.data[0]), count);
+			return;
+		}
+	}
+	bool all_constant = args.AllConstant();
+	if (all_constant) {
+		count = duckdb::MinValue<duckdb::idx_t>(count, 1);
+	}
+
+	if (count == 0) {
+		return;
+	}
+
+	// find the distinct argument combinations of the chunk: group the rows by hash, then verify the groups
+	duckdb::Vector hashes(duckdb::LogicalType::HASH, count);
+	duckdb::VectorOperations::Hash(args.data[0], hashes, count);
+	for (duckdb::idx_t col_idx = 1; col_idx < args.ColumnCount(); col_idx++) {
+		duckdb::VectorOperations::CombineHash(hashes, args.data[col_idx], count);
+	}
+	hashes.Flatten(count);
+	auto hash_data = duckdb::FlatVector::GetData<duckdb::hash_t>(hashes);
+
+	// distinct_rows: the first row of every distinct combination, row_distinct: the combination of every row
+	duckdb::SelectionVector distinct_rows(count);
+	duckdb::SelectionVector row_distinct(count);
+	duckdb::idx_t distinct_count = 0;
+	duckdb::SelectionVector check_rows(count);
+	duckdb::SelectionVector check_firsts(count);
+	duckdb::idx_t check_count = 0;
+	std::unordered_map<duckdb::hash_t, duckdb::idx_t> first_of_hash;
+	for (duckdb::idx_t row_idx = 0; row_idx < count; row_idx++) {
+		auto entry = first_of_hash.emplace(hash_data[row_idx], distinct_count);
+		if (entry.second) {
+			distinct_rows.set_index(distinct_count++, row_idx);
+		} else {
+			check_rows.set_index(check_count, row_idx);
+			check_firsts.set_index(check_count++, distinct_rows.get_index(entry.first->second));
+		}
+		row_distinct.set_index(row_idx, entry.first->second);
+	}
+	if (check_count > 0) {
+		// rows that only share the hash of an earlier row become combinations of their own
+		duckdb::SelectionVector remaining(check_count);
+		for (duckdb::idx_t i = 0; i < check_count; i++) {
+			remaining.set_index(i, i);
+		}
+		duckdb::idx_t remaining_count = check_count;
+		duckdb::SelectionVector equal(check_count);
+		duckdb::SelectionVector different(check_count);
+		for (duckdb::idx_t col_idx = 0; col_idx < args.ColumnCount() && remaining_count > 0; col_idx++) {
+			duckdb::Vector rows(args.data[col_idx], check_rows, check_count);
+			duckdb::Vector firsts(args.data[col_idx], check_firsts, check_count);
+			auto equal_count = duckdb::VectorOperations::NotDistinctFrom(rows, firsts, &remaining, remaining_count,
+			                                                             &equal, &different);
+			for (duckdb::idx_t i = 0; i < remaining_count - equal_count; i++) {
+				auto row_idx = check_rows.get_index(different.get_index(i));
+				distinct_rows.set_index(distinct_count, row_idx);
+				row_distinct.set_index(row_idx, distinct_count++);
+			}
+			for (duckdb::idx_t i = 0; i < equal_count; i++) {
+				remaining.set_index(i, equal.get_index(i));
+			}
+			remaining_count = equal_count;
+		}
+	}
+
+	duckdb::DataChunk distinct_args;
+	distinct_args.InitializeEmpty(args.GetTypes());
+	distinct_args.Slice(args, distinct_rows, distinct_count);
+	vector<vector<duckdb::Value>> arguments(distinct_count);
+	for (duckdb::idx_t i = 0; i < distinct_count; i++) {
+		for (duckdb::idx_t col_idx = 0; col_idx < distinct_args.ColumnCount(); col_idx++) {
+			arguments[i].push_back(distinct_args.GetValue(col_idx, i));
+		}
+	}
+	vector<duckdb::Value> results(distinct_count);
+	auto missing = memo.Get(arguments, results);
+
+	if (!missing.empty()) {
+		duckdb::SelectionVector missing_sel(missing.size());
+		for (duckdb::idx_t i = 0; i < missing.size(); i++) {
+			missing_sel.set_index(i, missing[i]);
+		}
+		duckdb::DataChunk missing_args;
+		missing_args.InitializeEmpty(args.GetTypes());
+		missing_args.Slice(distinct_args, missing_sel, missing.size());
+		duckdb::Vector missing_result(result.GetType());
+		CallUdf(udf, asynchronous, missing_args, missing_result);
+		for (duckdb::idx_t i = 0; i < missing.size(); i++) {
+			results[missing[i]] = missing_result.GetValue(i);
+		}
+		memo.Put(arguments, missing, results);
+	}
+
+	duckdb::Vector distinct_result(result.GetType(), distinct_count);
+	for (duckdb::idx_t i = 0; i < distinct_count; i++) {
+		distinct_result.SetValue(i, results[i]);
+	}
+	result.SetVectorType(duckdb::VectorType::FLAT_VECTOR);
+	duckdb::VectorOperations::Copy(distinct_result, result, row_distinct, count, 0, 0);
+	if (all_constant) {
+		result.SetVectorType(duckdb::VectorType::CONSTANT_VECTOR);
+	}
 }
 
 struct RegisterUdfTask : public Task {
-	RegisterUdfTask(Connection &connection, std::string name, std::string return_type_name, Napi::Function callback)
-		: Task(connection, callback), name(std::move(name)), return_type_name(std::move(return_type_name)) {
+	RegisterUdfTask(Connection &connection, std::string name, std::string return_type_name, UdfOptions options,
+					Napi::Function callback)
+		: Task(connection, callback), name(std::move(name)), return_type_name(std::move(return_type_name)),
+		  options(options) {
 	}
 
 	void DoWork() override {
 		auto &connection = Get<Connection>();
 		auto &udf_ptr = connection.udfs[name];
-		duckdb::scalar_function_t udf_function = [&udf_ptr](duckdb::DataChunk &args, duckdb::ExpressionState &state,
-															duckdb::Vector &result) -> void {
-			// here we can do only DuckDB stuff because we do not have a functioning env
-
-			// Flatten all args to simplify udfs
-			bool all_constant = args.AllConstant();
-			args.Flatten();
-
-			JSArgs jsargs;
-			jsargs.rows = args.size();
-			jsargs.args = &args;
-			jsargs.result = &result;
-			jsargs.done = false;
-
-			udf_ptr.BlockingCall(&jsargs);
-			while (!jsargs.done) {
-				std::this_thread::yield();
-			}
-			if (jsargs.error.HasError()) {
-				jsargs.error.Throw();
-			}
-			if (all_constant) {
-				result.SetVectorType(duckdb::VectorType::CONSTANT_VECTOR);
-			}
-		};
+		auto asynchronous = options.asynchronous;
+		duckdb::scalar_function_t udf_function;
+		if (options.deterministic) {
+			auto memo = std::make_shared<UdfMemo>(options.cache_size);
+			udf_function = [&udf_ptr, asynchronous, memo](duckdb::DataChunk &args, duckdb::ExpressionState &state,
+														 duckdb::Vector &result) -> void {
+				CallMemoizedUdf(udf_ptr, asynchronous, *memo, args, result);
+			};
+		} else {
+			udf_function = [&udf_ptr, asynchronous](duckdb::DataChunk &args, duckdb::ExpressionState &state,
+													duckdb::Vector &result) -> void {
+				CallUdf(udf_ptr, asynchronous, args, result);
+			};
+		}
 
 		auto expr = duckdb::Parser::ParseExpressionList(duckdb::StringUtil::Format("asdf::%s", return_type_name));
 		auto &cast = (duckdb::CastExpression &)*expr[0];
 		auto return_type = cast.cast_type;
 
-		connection.connection->CreateVectorizedFunction(name, vector<duckdb::LogicalType> {}, return_type, udf_function,
-														duckdb::LogicalType::ANY);
+		duckdb::ScalarFunction function(name, {}, return_type, udf_function);
+		function.varargs = duckdb::LogicalType::ANY;
+		function.null_handling = duckdb::FunctionNullHandling::SPECIAL_HANDLING;
+		// only deterministic UDFs may be evaluated once for constant arguments, e.g. while optimizing
+		function.stability =
+			options.deterministic ? duckdb::FunctionStability::CONSISTENT : duckdb::FunctionStability::VOLATILE;
+		duckdb::CreateScalarFunctionInfo info(function);
+		info.schema = DEFAULT_SCHEMA;
+		connection.connection->context->RegisterFunction(info);
 	}
 	std::string name;
 	std::string return_type_name;
+	UdfOptions options;
 };
 
 Napi::Value Connection::RegisterUdf(const Napi::CallbackInfo &info) {
@@ -290,6 +595,16 @@ Napi::Value Connection::RegisterUdf(const Napi::CallbackInfo &info) {
 	if (info.Length() > 3 && info[3].IsFunction()) {
 		completion_callback = info[3].As<Napi::Function>();
 	}
+	UdfOptions options;
+	if (info.Length() > 4 && info[4].IsObject()) {
+		auto options_object = info[4].As<Napi::Object>();
+		options.asynchronous = options_object.Get("async").ToBoolean();
+		options.deterministic = options_object.Get("deterministic").ToBoolean();
+		if (options_object.Get("cacheSize").IsNumber()) {
+			options.cache_size =
+				duckdb::MaxValue<int64_t>(options_object.Get("cacheSize").As<Napi::Number>().Int64Value(), 0);
+		}
+	}
 
 	if (udfs.find(name) != udfs.end()) {
 		throw Napi::TypeError::New(env, "UDF with this name already exists");
@@ -304,7 +619,8 @@ Napi::Value Connection::RegisterUdf(const Napi::CallbackInfo &info) {
 	udfs[name] = udf;
 
 	database_ref->Schedule(info.Env(),
-						   duckdb::make_uniq<RegisterUdfTask>(*this, name, return_type_name, completion_callback));
+						   duckdb::make_uniq<RegisterUdfTask>(*this, name, return_type_name, options,
+																	  completion_callback));
 
 	return Value();
 }
@@ -355,6 +671,7 @@ Napi::Value Connection::UnregisterUdf(const Napi::CallbackInfo &info) {
 struct ExecTask : public Task {
 	ExecTask(Connection &connection, std::string sql, Napi::Function callback)
 		: Task(connection, callback), sql(std::move(sql)) {
+		pipeline = connection.PipelineOrNull();
 	}
 
 	void DoWork() override {
@@ -367,11 +684,12 @@ struct ExecTask : public Task {
 				return;
 			}
 
+			// exec never returns rows, so we do not materialize them either
 			for (duckdb::idx_t i = 0; i < statements.size(); i++) {
-				auto res = connection.connection->Query(std::move(statements[i]));
-				if (res->HasError()) {
+				auto statement_error = Utils::ExecuteDiscardingResult(*connection.connection, std::move(statements[i]));
+				if (statement_error.HasError()) {
 					success = false;
-					error = res->GetErrorObject();
+					error = std::move(statement_error);
 					break;
 				}
 			}
@@ -379,6 +697,10 @@ struct ExecTask : public Task {
 			success = false;
 			error = duckdb::ErrorData(e);
 			return;
+		} catch (std::exception &e) {
+			success = false;
+			error = duckdb::ErrorData(e);
+			return;
 		}
 	}
 
@@ -455,6 +777,16 @@ Napi::Value Connection::Exec(const Napi::CallbackInfo &info) {
 	return Value();
 }
 
+Napi::Value Connection::SetPipelining(const Napi::CallbackInfo &info) {
+	auto env = info.Env();
+	if (info.Length() < 1 || !info[0].IsBoolean()) {
+		throw Napi::TypeError::New(env, "Boolean expected");
+	}
+	auto previous = pipelining;
+	pipelining = info[0].As<Napi::Boolean>();
+	return Napi::Boolean::New(env, previous);
+}
+
 struct CreateArrowViewTask : public Task {
 	CreateArrowViewTask(Connection &connection, duckdb::vector<duckdb::Value>& parameters, std::string &view_name, Napi::Function callback)
 		: Task(connection, callback), parameters(parameters), view_name(view_name) {
@@ -578,6 +910,292 @@ Napi::Value Connection::UnRegisterBuffer(const Napi::CallbackInfo &info) {
 	return Value();
 }
 
+// A stream between JS and a statement reading from or writing to a pipe:// file. It progresses at the pace of JS, so it
+// is executed on a thread of its own (see Database::ScheduleDetached) and on a connection of its own, neither the task
+// queue nor the connection it was created on are held up while it runs
+struct StreamTask : public Task {
+	explicit StreamTask(Connection &connection) : Task(connection) {
+	}
+	StreamTask(Connection &connection, Napi::Function callback) : Task(connection, callback) {
+	}
+
+	void DoWork() override {
+		if (error.HasError()) {
+			// opening the stream failed
+			return;
+		}
+		std::string path;
+		try {
+			path = RegisterPipe();
+			Execute(path);
+		} catch (std::exception &e) {
+			error = duckdb::ErrorData(e);
+		}
+		if (!path.empty()) {
+			pipe_fs->Unregister(path);
+		}
+		stream_connection.reset();
+	}
+
+	virtual std::string RegisterPipe() = 0;
+	virtual void Execute(const std::string &path) = 0;
+
+	duckdb::unique_ptr<duckdb::Connection> stream_connection;
+	NodePipeFileSystem *pipe_fs = nullptr;
+	duckdb::ErrorData error;
+};
+
+// Opens a stream on the task queue, where the pipe file system can be registered on first use, and hands it on to a
+// thread of its own
+struct OpenStreamTask : public Task {
+	OpenStreamTask(Connection &connection, duckdb::unique_ptr<StreamTask> stream)
+		: Task(connection), stream(std::move(stream)) {
+	}
+
+	void DoWork() override {
+		auto &connection = Get<Connection>();
+		try {
+			if (!connection.database_ref->database) {
+				throw duckdb::ConnectionException("Database was closed");
+			}
+			stream->pipe_fs = &connection.database_ref->GetPipeFileSystem();
+			stream->stream_connection = duckdb::make_uniq<duckdb::Connection>(*connection.database_ref->database);
+		} catch (std::exception &e) {
+			stream->error = duckdb::ErrorData(e);
+		}
+	}
+
+	void DoCallback() override {
+		Get<Connection>().database_ref->ScheduleDetached(object.Env(), std::move(stream));
+	}
+
+	duckdb::unique_ptr<StreamTask> stream;
+};
+
+struct ExportTask : public StreamTask {
+	ExportTask(Connection &connection, std::string sql, std::string copy_options, duckdb::shared_ptr<ExportPipe> pipe)
+		: StreamTask(connection), sql(std::move(sql)), copy_options(std::move(copy_options)), pipe(std::move(pipe)) {
+	}
+
+	std::string RegisterPipe() override {
+		return pipe_fs->Register(pipe);
+	}
+
+	void Execute(const std::string &path) override {
+		auto result = stream_connection->Query("COPY (" + sql + ") TO " + duckdb::KeywordHelper::WriteQuoted(path) +
+											   " (" + copy_options + ")");
+		if (result->HasError()) {
+			error = result->GetErrorObject();
+		}
+	}
+
+	void DoCallback() override {
+		pipe->Finish(std::move(error));
+	}
+
+	std::string sql;
+	std::string copy_options;
+	duckdb::shared_ptr<ExportPipe> pipe;
+};
+
+// COPY options given to exportStream besides the format, e.g. {header: false} or {compression: 'zstd'}
+static std::string ExportCopyOptions(Napi::Object options) {
+	std::string result;
+	auto keys = options.GetPropertyNames();
+	for (uint32_t i = 0; i < keys.Length(); i++) {
+		auto key = keys.Get(i).As<Napi::String>().Utf8Value();
+		if (key == "format" || key == "highWaterMark") {
+			continue;
+		}
+		auto value = options.Get(key);
+		std::string literal;
+		if (value.IsBoolean()) {
+			literal = value.As<Napi::Boolean>().Value() ? "TRUE" : "FALSE";
+		} else if (value.IsNumber()) {
+			auto number = value.As<Napi::Number>().DoubleValue();
+			literal = number == std::floor(number) && std::fabs(number) < 9007199254740992.0
+						  ? std::to_string((int64_t)number)
+						  : duckdb::Value::DOUBLE(number).ToString();
+		} else if (value.IsString()) {
+			literal = duckdb::KeywordHelper::WriteQuoted(value.As<Napi::String>().Utf8Value());
+		} else {
+			throw Napi::TypeError::New(options.Env(),
+									   "Export option \"" + key + "\" must be a boolean, number or string");
+		}
+		result += ", " + duckdb::KeywordHelper::WriteOptionallyQuoted(key) + " " + literal;
+	}
+	return result;
+}
+
+Napi::Value Connection::ExportStream(const Napi::CallbackInfo &info) {
+	auto env = info.Env();
+	if (info.Length() < 1 || !info[0].IsString()) {
+		throw Napi::TypeError::New(env, "Export stream: SQL query (string) expected");
+	}
+	if (info.Length() < 2 || !info[1].IsObject()) {
+		throw Napi::TypeError::New(env, "Export stream: options (object) expected");
+	}
+	if (info.Length() < 3 || !info[2].IsFunction()) {
+		throw Napi::TypeError::New(env, "Export stream: delivery callback (function) expected");
+	}
+	std::string sql = info[0].As<Napi::String>();
+	auto options = info[1].As<Napi::Object>();
+
+	std::string format = "csv";
+	if (options.Has("format") && !options.Get("format").IsUndefined()) {
+		format = options.Get("format").ToString().Utf8Value();
+	}
+	std::string copy_format;
+	if (format == "csv" || format == "parquet") {
+		copy_format = format;
+	} else if (format == "ndjson") {
+		copy_format = "json";
+	} else {
+		throw Napi::TypeError::New(env, "Export format must be 'csv', 'ndjson' or 'parquet'");
+	}
+	duckdb::idx_t capacity = 1 << 20;
+	if (options.Has("highWaterMark") && options.Get("highWaterMark").IsNumber()) {
+		capacity = duckdb::MaxValue<duckdb::idx_t>(options.Get("highWaterMark").As<Napi::Number>().Int64Value(), 1);
+	}
+
+	// COPY wraps the query in parentheses, where a trailing semicolon is a syntax error
+	duckdb::StringUtil::RTrim(sql);
+	while (!sql.empty() && sql.back() == ';') {
+		sql.pop_back();
+		duckdb::StringUtil::RTrim(sql);
+	}
+	// the pipe is written front to back, so the writer must not go through a temporary file that is moved in place
+	auto copy_options = "FORMAT " + copy_format + ", USE_TMP_FILE false" + ExportCopyOptions(options);
+
+	auto deliver = duckdb_node_export_function_t::New(env, info[2].As<Napi::Function>(), "duckdb_node_export", 0, 1,
+													  nullptr, [](Napi::Env, void *, std::nullptr_t *ctx) {});
+	auto pipe = duckdb::make_shared_ptr<ExportPipe>(capacity, deliver);
+
+	auto controls = Napi::Object::New(env);
+	controls.Set("resume", Napi::Function::New(env, [pipe](const Napi::CallbackInfo &) { pipe->Resume(); }));
+	controls.Set("cancel", Napi::Function::New(env, [pipe](const Napi::CallbackInfo &) { pipe->Cancel(); }));
+
+	database_ref->Schedule(
+		env, duckdb::make_uniq<OpenStreamTask>(*this, duckdb::make_uniq<ExportTask>(*this, sql, copy_options, pipe)));
+	return controls;
+}
+
+struct InsertStreamTask : public StreamTask {
+	InsertStreamTask(Connection &connection, std::string table, std::string reader, std::string reader_options,
+					 duckdb::shared_ptr<IngestPipe> pipe, Napi::Function callback)
+		: StreamTask(connection, callback), table(std::move(table)), reader(std::move(reader)),
+		  reader_options(std::move(reader_options)), pipe(std::move(pipe)) {
+	}
+
+	std::string RegisterPipe() override {
+		return pipe_fs->Register(pipe);
+	}
+
+	void Execute(const std::string &path) override {
+		// NDJSON objects are matched to the columns by key, CSV columns by position
+		auto by_name = reader == "read_ndjson" ? " BY NAME" : "";
+		auto result = stream_connection->Query("INSERT INTO " + table + by_name + " SELECT * FROM " + reader + "(" +
+											   duckdb::KeywordHelper::WriteQuoted(path) + reader_options + ")");
+		if (result->HasError()) {
+			error = result->GetErrorObject();
+		} else {
+			inserted = result->GetValue(0, 0).GetValue<int64_t>();
+		}
+	}
+
+	void DoCallback() override {
+		pipe->Finish();
+		Task::DoCallback();
+	}
+
+	void Callback() override {
+		auto env = object.Env();
+		Napi::HandleScope scope(env);
+		if (error.HasError()) {
+			callback.Value().MakeCallback(object.Value(), {Utils::CreateError(env, error)});
+			return;
+		}
+		callback.Value().MakeCallback(object.Value(), {env.Null(), Napi::Number::New(env, (double)inserted)});
+	}
+
+	std::string table;
+	std::string reader;
+	std::string reader_options;
+	duckdb::shared_ptr<IngestPipe> pipe;
+	int64_t inserted = 0;
+};
+
+Napi::Value Connection::InsertStream(const Napi::CallbackInfo &info) {
+	auto env = info.Env();
+	if (info.Length() < 1 || !info[0].IsString()) {
+		throw Napi::TypeError::New(env, "Insert stream: table name (string) expected");
+	}
+	if (info.Length() < 2 || !info[1].IsObject()) {
+		throw Napi::TypeError::New(env, "Insert stream: options (object) expected");
+	}
+	if (info.Length() < 3 || !info[2].IsFunction()) {
+		throw Napi::TypeError::New(env, "Insert stream: drain callback (function) expected");
+	}
+	if (info.Length() < 4 || !info[3].IsFunction()) {
+		throw Napi::TypeError::New(env, "Insert stream: completion callback (function) expected");
+	}
+	std::string table;
+	for (auto &component : duckdb::QualifiedName::ParseComponents(info[0].As<Napi::String>().Utf8Value())) {
+		table += (table.empty() ? "" : ".") + duckdb::KeywordHelper::WriteOptionallyQuoted(component);
+	}
+	auto options = info[1].As<Napi::Object>();
+
+	std::string format = "csv";
+	if (options.Has("format") && !options.Get("format").IsUndefined()) {
+		format = options.Get("format").ToString().Utf8Value();
+	}
+	std::string reader;
+	if (format == "csv") {
+		reader = "read_csv";
+	} else if (format == "ndjson") {
+		reader = "read_ndjson";
+	} else {
+		throw Napi::TypeError::New(env, "Insert stream format must be 'csv' or 'ndjson'");
+	}
+	duckdb::idx_t capacity = 1 << 20;
+	if (options.Has("highWaterMark") && options.Get("highWaterMark").IsNumber()) {
+		capacity = duckdb::MaxValue<duckdb::idx_t>(options.Get("highWaterMark").As<Napi::Number>().Int64Value(), 1);
+	}
+
+	// everything else is passed to the reader as named parameters, e.g. {header: false, columns: {a: 'INTEGER'}}
+	std::string reader_options;
+	auto keys = options.GetPropertyNames();
+	for (uint32_t i = 0; i < keys.Length(); i++) {
+		auto key = keys.Get(i).As<Napi::String>().Utf8Value();
+		auto value = options.Get(key);
+		if (key == "format" || key == "highWaterMark" || value.IsUndefined()) {
+			continue;
+		}
+		reader_options += ", " + duckdb::KeywordHelper::WriteOptionallyQuoted(key) +
+						  " := " + Utils::BindParameter(value).ToSQLString();
+	}
+
+	auto drain = duckdb_node_ingest_function_t::New(env, info[2].As<Napi::Function>(), "duckdb_node_ingest", 0, 1,
+													nullptr, [](Napi::Env, void *, std::nullptr_t *ctx) {});
+	auto pipe = duckdb::make_shared_ptr<IngestPipe>(capacity, drain);
+
+	auto controls = Napi::Object::New(env);
+	controls.Set("write", Napi::Function::New(env, [pipe](const Napi::CallbackInfo &info) {
+					 if (info.Length() < 1 || !info[0].IsBuffer()) {
+						 throw Napi::TypeError::New(info.Env(), "Buffer expected");
+					 }
+					 auto buffer = info[0].As<Napi::Buffer<char>>();
+					 return Napi::Boolean::New(info.Env(), pipe->Push(buffer.Data(), buffer.Length()));
+				 }));
+	controls.Set("end", Napi::Function::New(env, [pipe](const Napi::CallbackInfo &) { pipe->End(); }));
+	controls.Set("cancel", Napi::Function::New(env, [pipe](const Napi::CallbackInfo &) { pipe->Cancel(); }));
+
+	auto insert = duckdb::make_uniq<InsertStreamTask>(*this, table, reader, reader_options, pipe,
+													  info[3].As<Napi::Function>());
+	database_ref->Schedule(env, duckdb::make_uniq<OpenStreamTask>(*this, std::move(insert)));
+	return controls;
+}
+
 Napi::Value Connection::Close(const Napi::CallbackInfo &info) {
 	Napi::Function callback;
 	if (info.Length() > 0 && info[0].IsFunction()) {
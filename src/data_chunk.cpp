@@ -2,11 +2,93 @@
 #include "duckdb_node.hpp"
 #include "napi.h"
 
+#include <cstring>
 #include <thread>
 
 namespace node_duckdb {
 
-Napi::Array EncodeDataChunk(Napi::Env env, duckdb::DataChunk &chunk, bool with_types, bool with_data) {
+Napi::Buffer<char> CreateExternalBuffer(Napi::Env env, const char *data, size_t size,
+                                        const std::shared_ptr<void> &owner) {
+	if (!owner || size == 0) {
+		return Napi::Buffer<char>::Copy(env, data, size);
+	}
+	auto deleter = [](Napi::Env, void *finalizeData, void *hint) { delete static_cast<std::shared_ptr<void> *>(hint); };
+	return Napi::Buffer<char>::NewOrCopy(env, (char *)data, size, deleter, new std::shared_ptr<void>(owner));
+}
+
+// Fixed-width data with the same layout in JS, viewed in place if the vector memory has an owner
+template <class T, class ARRAY>
+static ARRAY EncodeFlatData(Napi::Env env, duckdb::Vector &vec, idx_t count, const std::shared_ptr<void> &owner) {
+	auto data = duckdb::FlatVector::GetData<T>(vec);
+	if (owner && count > 0) {
+		auto buffer = CreateExternalBuffer(env, (const char *)data, count * sizeof(T), owner);
+		if (buffer.ByteOffset() % sizeof(T) == 0) {
+			return ARRAY::New(env, count, buffer.ArrayBuffer(), buffer.ByteOffset());
+		}
+	}
+	auto array = ARRAY::New(env, count);
+	memcpy(array.Data(), data, count * sizeof(T));
+	return array;
+}
+
+#if NAPI_VERSION <= 5
+template <class T>
+static Napi::Float64Array EncodeFlatDataAsDouble(Napi::Env env, duckdb::Vector &vec, idx_t count) {
+	auto array = Napi::Float64Array::New(env, count);
+	auto data = duckdb::FlatVector::GetData<T>(vec);
+	for (size_t i = 0; i < count; ++i) {
+		array[i] = data[i];
+	}
+	return array;
+}
+#endif
+
+// Returns the child vector of a flat LIST/MAP vector laid out so that the entries of row i are at
+// [offsets[i], offsets[i + 1]). Slices the child if the list entries are not already stored back to back.
+static duckdb::Vector &EncodeListOffsets(Napi::Env env, duckdb::Vector &vec, idx_t count, Napi::Object &desc,
+                                         vector<duckdb::unique_ptr<duckdb::Vector>> &owned, idx_t &child_count) {
+	auto &child = duckdb::ListVector::GetEntry(vec);
+	auto entries = duckdb::FlatVector::GetData<duckdb::list_entry_t>(vec);
+	auto &validity = duckdb::FlatVector::Validity(vec);
+
+	auto offsets = Napi::Int32Array::New(env, count + 1);
+	bool contiguous = true;
+	child_count = 0;
+	offsets[0] = 0;
+	for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+		if (validity.RowIsValid(row_idx)) {
+			contiguous = contiguous && entries[row_idx].offset == child_count;
+			child_count += entries[row_idx].length;
+		}
+		offsets[row_idx + 1] = child_count;
+	}
+	desc.Set("offsets", offsets);
+
+	if (contiguous) {
+		child.Flatten(child_count);
+		return child;
+	}
+	duckdb::SelectionVector sel(child_count);
+	idx_t sel_idx = 0;
+	for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+		if (validity.RowIsValid(row_idx)) {
+			for (idx_t i = 0; i < entries[row_idx].length; i++) {
+				sel.set_index(sel_idx++, entries[row_idx].offset + i);
+			}
+		}
+	}
+	owned.push_back(duckdb::make_uniq<duckdb::Vector>(child, sel, child_count));
+	owned.back()->Flatten(child_count);
+	return *owned.back();
+}
+
+// Encodes the columns of a chunk in an Arrow-like layout: a validity and data array per column, nested types are
+// encoded as `children` descriptors (struct fields as siblings, the element column of lists, maps and arrays) with
+// list entries delimited by an `offsets` Int32Array. With an `owner` keeping the chunk (and the sliced child vectors
+// in `owned`) alive, data arrays are views over the vector memory instead of copies.
+static Napi::Array EncodeColumns(Napi::Env env, duckdb::DataChunk &chunk, bool with_types, bool with_data,
+                                 vector<duckdb::unique_ptr<duckdb::Vector>> &owned,
+                                 const std::shared_ptr<void> &owner) {
 	Napi::Array col_descs(Napi::Array::New(env, chunk.ColumnCount()));
 	for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
 		auto col_desc = Napi::Object::New(env);
@@ -17,18 +99,19 @@ Napi::Array EncodeDataChunk(Napi::Env env, duckdb::DataChunk &chunk, bool with_t
 			chunk_vec.Flatten(chunk.size());
 		}
 
-		// Do a post-order DFS traversal
-		vector<std::tuple<bool, duckdb::Vector *, Napi::Object, size_t, size_t>> pending;
-		pending.emplace_back(false, &chunk_vec, Napi::Object::New(env), 0, 0);
+		// Do a post-order DFS traversal, nodes are (visited, vector, descriptor, parent, index in parent, row count)
+		vector<std::tuple<bool, duckdb::Vector *, Napi::Object, size_t, size_t, idx_t>> pending;
+		pending.emplace_back(false, &chunk_vec, Napi::Object::New(env), 0, 0, chunk.size());
 
 		while (!pending.empty()) {
 			// Unpack DFS node
 			auto &back = pending.back();
 			auto &visited = std::get<0>(back);
-			auto &vec = std::get<1>(back);
-			auto &desc = std::get<2>(back);
-			auto &parent_idx = std::get<3>(back);
-			auto &idx_in_parent = std::get<4>(back);
+			auto vec = std::get<1>(back);
+			auto desc = std::get<2>(back);
+			auto parent_idx = std::get<3>(back);
+			auto idx_in_parent = std::get<4>(back);
+			auto count = std::get<5>(back);
 
 			// Already visited?
 			if (visited) {
@@ -52,10 +135,10 @@ Napi::Array EncodeDataChunk(Napi::Env env, duckdb::DataChunk &chunk, bool with_t
 
 			// Create validity vector
 			if (with_data) {
-				vec->Flatten(chunk.size());
+				vec->Flatten(count);
 				auto &validity = duckdb::FlatVector::Validity(*vec);
-				auto validity_buffer = Napi::Uint8Array::New(env, chunk.size());
-				for (idx_t row_idx = 0; row_idx < chunk.size(); row_idx++) {
+				auto validity_buffer = Napi::Uint8Array::New(env, count);
+				for (idx_t row_idx = 0; row_idx < count; row_idx++) {
 					validity_buffer[row_idx] = validity.RowIsValid(row_idx);
 				}
 				desc.Set("validity", validity_buffer);
@@ -63,47 +146,58 @@ Napi::Array EncodeDataChunk(Napi::Env env, duckdb::DataChunk &chunk, bool with_t
 
 			// Create data buffer
 			switch (vec_type.id()) {
+			case duckdb::LogicalTypeId::BOOLEAN: {
+				if (with_data) {
+					desc.Set("data", EncodeFlatData<bool, Napi::Uint8Array>(env, *vec, count, owner));
+				}
+				break;
+			}
 			case duckdb::LogicalTypeId::TINYINT: {
 				if (with_data) {
-					auto array = Napi::Int8Array::New(env, chunk.size());
-					auto data = duckdb::FlatVector::GetData<int8_t>(*vec);
-					for (size_t i = 0; i < chunk.size(); ++i) {
-						array[i] = data[i];
-					}
-					desc.Set("data", array);
+					desc.Set("data", EncodeFlatData<int8_t, Napi::Int8Array>(env, *vec, count, owner));
 				}
 				break;
 			}
 			case duckdb::LogicalTypeId::SMALLINT: {
 				if (with_data) {
-					auto array = Napi::Int16Array::New(env, chunk.size());
-					auto data = duckdb::FlatVector::GetData<int16_t>(*vec);
-					for (size_t i = 0; i < chunk.size(); ++i) {
-						array[i] = data[i];
-					}
-					desc.Set("data", array);
+					desc.Set("data", EncodeFlatData<int16_t, Napi::Int16Array>(env, *vec, count, owner));
 				}
 				break;
 			}
+			case duckdb::LogicalTypeId::DATE:
 			case duckdb::LogicalTypeId::INTEGER: {
 				if (with_data) {
-					auto array = Napi::Int32Array::New(env, chunk.size());
-					auto data = duckdb::FlatVector::GetData<int32_t>(*vec);
-					for (size_t i = 0; i < chunk.size(); ++i) {
-						array[i] = data[i];
-					}
-					desc.Set("data", array);
+					desc.Set("data", EncodeFlatData<int32_t, Napi::Int32Array>(env, *vec, count, owner));
+				}
+				break;
+			}
+			case duckdb::LogicalTypeId::UTINYINT: {
+				if (with_data) {
+					desc.Set("data", EncodeFlatData<uint8_t, Napi::Uint8Array>(env, *vec, count, owner));
+				}
+				break;
+			}
+			case duckdb::LogicalTypeId::USMALLINT: {
+				if (with_data) {
+					desc.Set("data", EncodeFlatData<uint16_t, Napi::Uint16Array>(env, *vec, count, owner));
+				}
+				break;
+			}
+			case duckdb::LogicalTypeId::UINTEGER: {
+				if (with_data) {
+					desc.Set("data", EncodeFlatData<uint32_t, Napi::Uint32Array>(env, *vec, count, owner));
+				}
+				break;
+			}
+			case duckdb::LogicalTypeId::FLOAT: {
+				if (with_data) {
+					desc.Set("data", EncodeFlatData<float, Napi::Float32Array>(env, *vec, count, owner));
 				}
 				break;
 			}
 			case duckdb::LogicalTypeId::DOUBLE: {
 				if (with_data) {
-					auto array = Napi::Float64Array::New(env, chunk.size());
-					auto data = duckdb::FlatVector::GetData<double>(*vec);
-					for (size_t i = 0; i < chunk.size(); ++i) {
-						array[i] = data[i];
-					}
-					desc.Set("data", array);
+					desc.Set("data", EncodeFlatData<double, Napi::Float64Array>(env, *vec, count, owner));
 				}
 				break;
 			}
@@ -116,42 +210,33 @@ Napi::Array EncodeDataChunk(Napi::Env env, duckdb::DataChunk &chunk, bool with_t
 			case duckdb::LogicalTypeId::TIMESTAMP: {
 				if (with_data) {
 #if NAPI_VERSION > 5
-					auto array = Napi::BigInt64Array::New(env, chunk.size());
-					auto data = duckdb::FlatVector::GetData<int64_t>(*vec);
+					desc.Set("data", EncodeFlatData<int64_t, Napi::BigInt64Array>(env, *vec, count, owner));
 #else
-					auto array = Napi::Float64Array::New(env, chunk.size());
-					auto data = duckdb::FlatVector::GetData<int64_t>(*vec);
+					desc.Set("data", EncodeFlatDataAsDouble<int64_t>(env, *vec, count));
 #endif
-					for (size_t i = 0; i < chunk.size(); ++i) {
-						array[i] = data[i];
-					}
-					desc.Set("data", array);
 				}
 				break;
 			}
 			case duckdb::LogicalTypeId::UBIGINT: {
 				if (with_data) {
 #if NAPI_VERSION > 5
-					auto array = Napi::BigUint64Array::New(env, chunk.size());
-					auto data = duckdb::FlatVector::GetData<uint64_t>(*vec);
+					desc.Set("data", EncodeFlatData<uint64_t, Napi::BigUint64Array>(env, *vec, count, owner));
 #else
-					auto array = Napi::Float64Array::New(env, chunk.size());
-					auto data = duckdb::FlatVector::GetData<int64_t>(*vec);
+					desc.Set("data", EncodeFlatDataAsDouble<uint64_t>(env, *vec, count));
 #endif
-					for (size_t i = 0; i < chunk.size(); ++i) {
-						array[i] = data[i];
-					}
-					desc.Set("data", array);
 				}
 				break;
 			}
 			case duckdb::LogicalTypeId::BLOB: {
 				if (with_data) {
-					auto array = Napi::Array::New(env, chunk.size());
+					auto array = Napi::Array::New(env, count);
 					auto data = duckdb::FlatVector::GetData<duckdb::string_t>(*vec);
 
-					for (size_t i = 0; i < chunk.size(); ++i) {
-						auto buf = Napi::Buffer<char>::Copy(env, data[i].GetData(), data[i].GetSize());
+					for (size_t i = 0; i < count; ++i) {
+						// inlined values are cheaper to copy than to keep the whole chunk alive for
+						auto size = data[i].GetSize();
+						auto buf = CreateExternalBuffer(env, data[i].GetData(), size,
+						                                size > duckdb::string_t::INLINE_LENGTH ? owner : nullptr);
 						array.Set(i, buf);
 					}
 					desc.Set("data", array);
@@ -160,9 +245,9 @@ Napi::Array EncodeDataChunk(Napi::Env env, duckdb::DataChunk &chunk, bool with_t
 			}
 			case duckdb::LogicalTypeId::VARCHAR: {
 				if (with_data) {
-					auto array = Napi::Array::New(env, chunk.size());
+					auto array = Napi::Array::New(env, count);
 					auto data = duckdb::FlatVector::GetData<duckdb::string_t>(*vec);
-					for (size_t i = 0; i < chunk.size(); ++i) {
+					for (size_t i = 0; i < count; ++i) {
 						array.Set(i, data[i].GetString());
 					}
 					desc.Set("data", array);
@@ -175,16 +260,41 @@ Napi::Array EncodeDataChunk(Napi::Env env, duckdb::DataChunk &chunk, bool with_t
 				desc.Set("children", Napi::Array::New(env, child_count));
 				for (size_t i = 0; i < child_count; ++i) {
 					auto c = child_count - 1 - i;
-					auto &entry = entries[c];
-					auto desc = Napi::Object::New(env);
-					auto name = duckdb::StructType::GetChildName(vec_type, c);
-					desc.Set("name", name);
-					pending.emplace_back(false, entry.get(), desc, current_idx, i);
+					auto child_desc = Napi::Object::New(env);
+					child_desc.Set("name", duckdb::StructType::GetChildName(vec_type, c));
+					pending.emplace_back(false, entries[c].get(), child_desc, current_idx, c, count);
 				}
 				break;
 			}
+			case duckdb::LogicalTypeId::LIST:
+			case duckdb::LogicalTypeId::MAP: {
+				duckdb::Vector *child = &duckdb::ListVector::GetEntry(*vec);
+				idx_t child_count = 0;
+				if (with_data) {
+					child = &EncodeListOffsets(env, *vec, count, desc, owned, child_count);
+				}
+				desc.Set("children", Napi::Array::New(env, 1));
+				pending.emplace_back(false, child, Napi::Object::New(env), current_idx, 0, child_count);
+				break;
+			}
+			case duckdb::LogicalTypeId::ARRAY: {
+				auto array_size = duckdb::ArrayType::GetSize(vec_type);
+				idx_t child_count = 0;
+				if (with_data) {
+					child_count = count * array_size;
+					auto offsets = Napi::Int32Array::New(env, count + 1);
+					for (idx_t row_idx = 0; row_idx <= count; row_idx++) {
+						offsets[row_idx] = row_idx * array_size;
+					}
+					desc.Set("offsets", offsets);
+				}
+				desc.Set("children", Napi::Array::New(env, 1));
+				pending.emplace_back(false, &duckdb::ArrayVector::GetEntry(*vec), Napi::Object::New(env), current_idx,
+				                     0, child_count);
+				break;
+			}
 			default:
-				throw Napi::TypeError::New(env, "Unsupported UDF argument type " + vec->GetType().ToString());
+				throw Napi::TypeError::New(env, "Unsupported type for columnar encoding " + vec->GetType().ToString());
 			}
 		}
 		col_descs.Set(col_idx, col_desc);
@@ -192,4 +302,21 @@ Napi::Array EncodeDataChunk(Napi::Env env, duckdb::DataChunk &chunk, bool with_t
 	return col_descs;
 }
 
+Napi::Array EncodeDataChunk(Napi::Env env, duckdb::DataChunk &chunk, bool with_types, bool with_data) {
+	// sliced child vectors, must outlive the traversal
+	vector<duckdb::unique_ptr<duckdb::Vector>> owned;
+	return EncodeColumns(env, chunk, with_types, with_data, owned, nullptr);
+}
+
+struct EncodedChunk {
+	std::shared_ptr<duckdb::DataChunk> chunk;
+	vector<duckdb::unique_ptr<duckdb::Vector>> sliced;
+};
+
+Napi::Array EncodeDataChunk(Napi::Env env, std::shared_ptr<duckdb::DataChunk> chunk, bool with_types) {
+	auto encoded = std::make_shared<EncodedChunk>();
+	encoded->chunk = std::move(chunk);
+	return EncodeColumns(env, *encoded->chunk, with_types, true, encoded->sliced, encoded);
+}
+
 } // namespace node_duckdb
@@ -1,11 +1,18 @@
+#include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/function_expression.hpp"
+#include "duckdb/parser/expression/star_expression.hpp"
 #include "duckdb/parser/parser.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/parser/tableref/column_data_ref.hpp"
+#include "duckdb/parser/tableref/subqueryref.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb_node.hpp"
 #include "napi.h"
 
+#include <chrono>
 #include <iostream>
 #include <thread>
 
@@ -20,7 +27,12 @@ Napi::FunctionReference Database::Init(Napi::Env env, Napi::Object exports) {
 	     InstanceMethod("serialize", &Database::Serialize), InstanceMethod("parallelize", &Database::Parallelize),
 	     InstanceMethod("connect", &Database::Connect), InstanceMethod("interrupt", &Database::Interrupt),
 	     InstanceMethod("registerReplacementScan", &Database::RegisterReplacementScan),
-	     InstanceMethod("tokenize", &Database::Tokenize)});
+	     InstanceMethod("invalidateReplacementScans", &Database::InvalidateReplacementScans),
+	     InstanceMethod("tokenize", &Database::Tokenize),
+	     InstanceMethod("registerFileBuffer", &Database::RegisterFileBuffer),
+	     InstanceMethod("unregisterFileBuffer", &Database::UnregisterFileBuffer),
+	     InstanceMethod("getFileBuffer", &Database::GetFileBuffer),
+	     InstanceMethod("register_file_system_internal", &Database::RegisterFileSystem)});
 
 	exports.Set("Database", t);
 
@@ -127,20 +139,63 @@ Database::~Database() {
 void Database::Schedule(Napi::Env env, duckdb::unique_ptr<Task> task) {
 	{
 		std::lock_guard<std::mutex> lock(task_mutex);
-		task_queue.push(std::move(task));
+		task_queue.push_back(std::move(task));
 	}
 	Process(env);
 }
 
+void Database::ScheduleFirst(duckdb::unique_ptr<Task> task) {
+	std::lock_guard<std::mutex> lock(task_mutex);
+	task_queue.push_front(std::move(task));
+}
+
+void DuckDBNodeTaskLauncher(Napi::Env env, Napi::Function, std::nullptr_t *, Task *task_p) {
+	if (env == nullptr) {
+		// the environment is shutting down, the references of the task can no longer be released
+		return;
+	}
+	duckdb::unique_ptr<Task> task(task_p);
+	task->DoCallback();
+}
+
+void Database::ScheduleDetached(Napi::Env env, duckdb::unique_ptr<Task> task) {
+	auto complete = duckdb_node_task_function_t::New(env, "duckdb_node_detached_task", 0, 1, nullptr,
+	                                                 [](Napi::Env, void *, std::nullptr_t *ctx) {});
+	task->BeforeWork();
+	std::thread(
+	    [complete](Task *task) {
+		    task->DoWork();
+		    complete.BlockingCall(task);
+		    complete.Release();
+	    },
+	    task.release())
+	    .detach();
+}
+
+// upper bound on the tasks executed in a single worker hop when pipelining
+static constexpr duckdb::idx_t MAX_PIPELINED_TASKS = 256;
+
 static void TaskExecuteCallback(napi_env e, void *data) {
 	auto holder = (TaskHolder *)data;
-	holder->task->DoWork();
+	for (auto &task : holder->tasks) {
+		task->DoWork();
+	}
 }
 
 static void TaskCompleteCallback(napi_env e, napi_status status, void *data) {
 	duckdb::unique_ptr<TaskHolder> holder((TaskHolder *)data);
+	// continuations are queued before the next task is started, so nothing can run in between
+	for (auto &task : holder->tasks) {
+		auto continuation = task->Continuation();
+		if (continuation) {
+			holder->db->ScheduleFirst(std::move(continuation));
+		}
+	}
 	holder->db->TaskComplete(e);
-	holder->task->DoCallback();
+	// the callbacks of a pipelined batch are all delivered in this turn of the event loop
+	for (auto &task : holder->tasks) {
+		task->DoCallback();
+	}
 	napi_delete_async_work(e, holder->request);
 }
 
@@ -163,21 +218,33 @@ void Database::TaskComplete(Napi::Env env) {
 }
 
 void Database::Process(Napi::Env env) {
-	std::lock_guard<std::mutex> lock(task_mutex);
-	if (task_queue.empty()) {
-		return;
-	}
-	if (task_inflight) {
-		return;
+	TaskHolder *holder;
+	{
+		std::lock_guard<std::mutex> lock(task_mutex);
+		if (task_queue.empty() || task_inflight) {
+			return;
+		}
+		task_inflight = true;
+
+		holder = new TaskHolder();
+		holder->db = this;
+		holder->tasks.push_back(std::move(task_queue.front()));
+		task_queue.pop_front();
+
+		// drain the tasks queued right behind a pipelined one on the same connection into the same worker hop,
+		// bounded so that a long pipeline still delivers its callbacks in portions
+		auto pipeline = holder->tasks.back()->pipeline;
+		while (pipeline && !task_queue.empty() && task_queue.front()->pipeline == pipeline &&
+		       holder->tasks.size() < MAX_PIPELINED_TASKS) {
+			holder->tasks.push_back(std::move(task_queue.front()));
+			task_queue.pop_front();
+		}
 	}
-	task_inflight = true;
-
-	auto task = std::move(task_queue.front());
-	task_queue.pop();
 
-	auto holder = new TaskHolder();
-	holder->task = std::move(task);
-	holder->db = this;
+	// outside of the lock, as this can call into JS which can schedule more tasks
+	for (auto &task : holder->tasks) {
+		task->BeforeWork();
+	}
 
 	napi_create_async_work(env, nullptr, Napi::String::New(env, "duckdb.Database.Task"), TaskExecuteCallback,
 	                       TaskCompleteCallback, holder, &holder->request);
@@ -225,6 +292,8 @@ struct CloseTask : public Task {
 		auto &database = Get<Database>();
 		if (database.database) {
 			database.database.reset();
+			database.memory_fs = nullptr;
+			database.pipe_fs = nullptr;
 			success = true;
 		} else {
 			success = false;
@@ -241,6 +310,8 @@ struct CloseTask : public Task {
 			cb.MakeCallback(database.Value(), {Utils::CreateError(env, "Database was already closed")});
 			return;
 		}
+		// no mem:// file can be read anymore, release the buffers on the main thread
+		database.file_buffers.clear();
 		cb.MakeCallback(database.Value(), {env.Null(), database.Value()});
 	}
 
@@ -267,35 +338,285 @@ Napi::Value Database::Connect(const Napi::CallbackInfo &info) {
 	return Connection::NewInstance(Value());
 }
 
+// What a replacement scan resolved a table name to: a table function call, a result set handed over by JS or
+// nothing (an empty function and no collection)
+struct ReplacementScanEntry {
+	std::string function;
+	vector<duckdb::Value> parameters;
+	duckdb::shared_ptr<duckdb::ColumnDataCollection> collection;
+	vector<std::string> names;
+	std::chrono::steady_clock::time_point expires;
+
+	duckdb::unique_ptr<duckdb::TableRef> CreateTableRef() const {
+		if (collection) {
+			// the collection is shared with the cache, binding does not copy it
+			auto select = duckdb::make_uniq<duckdb::SelectStatement>();
+			auto node = duckdb::make_uniq<duckdb::SelectNode>();
+			node->select_list.push_back(duckdb::make_uniq<duckdb::StarExpression>());
+			node->from_table = duckdb::make_uniq<duckdb::ColumnDataRef>(
+			    duckdb::optionally_owned_ptr<duckdb::ColumnDataCollection>(collection), names);
+			select->node = std::move(node);
+			return duckdb::make_uniq<duckdb::SubqueryRef>(std::move(select));
+		}
+		if (function != "") {
+			auto table_function = duckdb::make_uniq<duckdb::TableFunctionRef>();
+			duckdb::vector<duckdb::unique_ptr<duckdb::ParsedExpression>> children;
+			for (auto &param : parameters) {
+				children.push_back(duckdb::make_uniq<duckdb::ConstantExpression>(param));
+			}
+			table_function->function = duckdb::make_uniq<duckdb::FunctionExpression>(function, std::move(children));
+			return std::move(table_function);
+		}
+		return nullptr;
+	}
+};
+
+// Replacement scan results by table name, shared between the scan and the Database so JS can invalidate them
+struct ReplacementScanCache {
+	ReplacementScanCache(bool enabled, int64_t ttl_ms) : enabled(enabled), ttl_ms(ttl_ms) {
+	}
+
+	duckdb::shared_ptr<ReplacementScanEntry> Get(const std::string &table) {
+		std::lock_guard<std::mutex> guard(lock);
+		auto entry = entries.find(table);
+		if (entry == entries.end()) {
+			return nullptr;
+		}
+		if (ttl_ms > 0 && entry->second->expires <= std::chrono::steady_clock::now()) {
+			entries.erase(entry);
+			return nullptr;
+		}
+		return entry->second;
+	}
+
+	void Put(const std::string &table, duckdb::shared_ptr<ReplacementScanEntry> entry) {
+		if (!enabled) {
+			return;
+		}
+		entry->expires = std::chrono::steady_clock::now() + std::chrono::milliseconds(ttl_ms);
+		std::lock_guard<std::mutex> guard(lock);
+		entries[table] = std::move(entry);
+	}
+
+	void Invalidate() {
+		std::lock_guard<std::mutex> guard(lock);
+		entries.clear();
+	}
+
+	void Invalidate(const std::string &table) {
+		std::lock_guard<std::mutex> guard(lock);
+		entries.erase(table);
+	}
+
+	bool enabled;
+	// entries never expire if not positive
+	int64_t ttl_ms;
+	std::mutex lock;
+	std::unordered_map<std::string, duckdb::shared_ptr<ReplacementScanEntry>> entries;
+};
+
 struct JSRSArgs {
 	std::string table = "";
-	std::string function = "";
-	vector<duckdb::Value> parameters;
+	duckdb::shared_ptr<ReplacementScanEntry> result;
 	bool done = false;
 	duckdb::ErrorData error;
 };
 
 struct NodeReplacementScanData : duckdb::ReplacementScanData {
-	NodeReplacementScanData(duckdb_node_rs_function_t rs) : rs(std::move(rs)) {};
+	NodeReplacementScanData(duckdb_node_rs_function_t rs, duckdb::shared_ptr<ReplacementScanCache> cache)
+	    : rs(std::move(rs)), cache(std::move(cache)) {};
 	duckdb_node_rs_function_t rs;
+	duckdb::shared_ptr<ReplacementScanCache> cache;
+};
+
+static duckdb::LogicalType ElementType(napi_typedarray_type type) {
+	switch (type) {
+	case napi_int8_array:
+		return duckdb::LogicalType::TINYINT;
+	case napi_uint8_array:
+	case napi_uint8_clamped_array:
+		return duckdb::LogicalType::UTINYINT;
+	case napi_int16_array:
+		return duckdb::LogicalType::SMALLINT;
+	case napi_uint16_array:
+		return duckdb::LogicalType::USMALLINT;
+	case napi_int32_array:
+		return duckdb::LogicalType::INTEGER;
+	case napi_uint32_array:
+		return duckdb::LogicalType::UINTEGER;
+	case napi_float32_array:
+		return duckdb::LogicalType::FLOAT;
+	case napi_float64_array:
+		return duckdb::LogicalType::DOUBLE;
+#if NAPI_VERSION > 5
+	case napi_bigint64_array:
+		return duckdb::LogicalType::BIGINT;
+	case napi_biguint64_array:
+		return duckdb::LogicalType::UBIGINT;
+#endif
+	default:
+		return duckdb::LogicalType::INVALID;
+	}
+}
+
+// A column of a result set returned by JS, either a typed array laid out like the column type or an array of values
+struct JSColumn {
+	JSColumn(std::string name_p, Napi::Value data_p, Napi::Value validity_p, duckdb::LogicalType type_p)
+	    : name(std::move(name_p)), type(std::move(type_p)), data(data_p), validity(validity_p) {
+		if (data.IsTypedArray()) {
+			auto array = data.As<Napi::TypedArray>();
+			length = array.ElementLength();
+			if (type.id() == duckdb::LogicalTypeId::INVALID) {
+				type = ElementType(array.TypedArrayType());
+			}
+			auto physical_type = type.InternalType();
+			if (!duckdb::TypeIsConstantSize(physical_type) || type.id() == duckdb::LogicalTypeId::INVALID ||
+			    duckdb::GetTypeIdSize(physical_type) != array.ElementSize()) {
+				throw duckdb::InvalidInputException("Typed array of column \"%s\" does not match its type %s", name,
+				                                    type.ToString());
+			}
+			return;
+		}
+		if (!data.IsArray()) {
+			throw duckdb::InvalidInputException("Expected an array or typed array for column \"%s\"", name);
+		}
+		auto list = Utils::BindParameter(data);
+		if (list.type().id() != duckdb::LogicalTypeId::LIST) {
+			throw duckdb::InvalidInputException("Values of column \"%s\" do not have a common type", name);
+		}
+		if (type.id() == duckdb::LogicalTypeId::INVALID) {
+			type = duckdb::ListType::GetChildType(list.type());
+			if (type.id() == duckdb::LogicalTypeId::SQLNULL) {
+				type = duckdb::LogicalType::INTEGER;
+			}
+		}
+		for (auto &value : duckdb::ListValue::GetChildren(list)) {
+			values.push_back(value.DefaultCastAs(type));
+		}
+		length = values.size();
+	}
+
+	void Decode(duckdb::Vector &result, duckdb::idx_t offset, duckdb::idx_t count) {
+		if (data.IsTypedArray()) {
+			auto array = data.As<Napi::TypedArray>();
+			auto width = array.ElementSize();
+			memcpy(duckdb::FlatVector::GetData(result),
+			       (const char *)array.ArrayBuffer().Data() + array.ByteOffset() + offset * width, count * width);
+		} else {
+			for (duckdb::idx_t row_idx = 0; row_idx < count; row_idx++) {
+				result.SetValue(row_idx, values[offset + row_idx]);
+			}
+		}
+		if (validity.IsTypedArray()) {
+			auto mask = validity.As<Napi::Uint8Array>();
+			for (duckdb::idx_t row_idx = 0; row_idx < count; row_idx++) {
+				if (!mask[offset + row_idx]) {
+					duckdb::FlatVector::SetNull(result, row_idx, true);
+				}
+			}
+		}
+	}
+
+	std::string name;
+	duckdb::LogicalType type;
+	Napi::Value data;
+	Napi::Value validity;
+	vector<duckdb::Value> values;
+	duckdb::idx_t length = 0;
 };
 
+// Copies the columns of a JS result set into a collection, once, so binds reuse it without calling into JS
+static void AppendJSColumns(duckdb::shared_ptr<ReplacementScanEntry> &entry, vector<JSColumn> &columns) {
+	if (columns.empty()) {
+		throw duckdb::InvalidInputException("Replacement scan result has no columns");
+	}
+	vector<duckdb::LogicalType> types;
+	for (auto &column : columns) {
+		if (column.length != columns[0].length) {
+			throw duckdb::InvalidInputException("Column \"%s\" has %llu values, expected %llu", column.name,
+			                                    column.length, columns[0].length);
+		}
+		types.push_back(column.type);
+	}
+	if (!entry->collection) {
+		for (auto &column : columns) {
+			entry->names.push_back(column.name);
+		}
+		entry->collection =
+		    duckdb::make_shared_ptr<duckdb::ColumnDataCollection>(duckdb::Allocator::DefaultAllocator(), types);
+	} else if (entry->collection->Types() != types) {
+		throw duckdb::InvalidInputException("Replacement scan batches do not have the same column types");
+	}
+
+	duckdb::DataChunk chunk;
+	chunk.Initialize(duckdb::Allocator::DefaultAllocator(), types);
+	for (duckdb::idx_t offset = 0; offset < columns[0].length; offset += STANDARD_VECTOR_SIZE) {
+		auto count = duckdb::MinValue<duckdb::idx_t>(STANDARD_VECTOR_SIZE, columns[0].length - offset);
+		chunk.Reset();
+		for (duckdb::idx_t col_idx = 0; col_idx < columns.size(); col_idx++) {
+			columns[col_idx].Decode(chunk.data[col_idx], offset, count);
+		}
+		chunk.SetCardinality(count);
+		entry->collection->Append(chunk);
+	}
+}
+
+// `{columns: {name: values}}` with arrays or typed arrays per column, or the `{batches}` returned by allColumnar
+static void ReadJSResultSet(duckdb::shared_ptr<ReplacementScanEntry> &entry, Napi::Object obj) {
+	if (obj.Has("columns")) {
+		auto columns_obj = obj.Get("columns").ToObject();
+		auto names = columns_obj.GetPropertyNames();
+		vector<JSColumn> columns;
+		for (uint32_t i = 0; i < names.Length(); i++) {
+			auto name = names.Get(i).ToString().Utf8Value();
+			columns.emplace_back(name, columns_obj.Get(name), Napi::Value(), duckdb::LogicalType::INVALID);
+		}
+		AppendJSColumns(entry, columns);
+		return;
+	}
+	auto batches = obj.Get("batches");
+	if (!batches.IsArray()) {
+		throw duckdb::InvalidInputException("Expected an array of batches");
+	}
+	auto batch_array = batches.As<Napi::Array>();
+	for (uint32_t batch_idx = 0; batch_idx < batch_array.Length(); batch_idx++) {
+		auto descs = batch_array.Get(batch_idx).ToObject().Get("columns").As<Napi::Array>();
+		vector<JSColumn> columns;
+		for (uint32_t col_idx = 0; col_idx < descs.Length(); col_idx++) {
+			auto desc = descs.Get(col_idx).ToObject();
+			auto name = desc.Get("name").ToString().Utf8Value();
+			if (desc.Has("children")) {
+				throw duckdb::InvalidInputException("Nested column \"%s\" is not supported in replacement scan batches",
+				                                    name);
+			}
+			columns.emplace_back(name, desc.Get("data"), desc.Get("validity"),
+			                     duckdb::TransformStringToLogicalType(desc.Get("sqlType").ToString().Utf8Value()));
+		}
+		AppendJSColumns(entry, columns);
+	}
+}
+
 void DuckDBNodeRSLauncher(Napi::Env env, Napi::Function jsrs, std::nullptr_t *, JSRSArgs *jsargs) {
 	try {
 		Napi::EscapableHandleScope scope(env);
 		auto arg = Napi::String::New(env, jsargs->table);
 		auto result = jsrs({arg});
+		jsargs->result = duckdb::make_shared_ptr<ReplacementScanEntry>();
 		if (result && result.IsObject()) {
 			auto obj = result.As<Napi::Object>();
-			jsargs->function = obj.Get("function").ToString().Utf8Value();
-			auto parameters = obj.Get("parameters");
-			if (parameters.IsArray()) {
-				auto paramArray = parameters.As<Napi::Array>();
-				for (uint32_t i = 0; i < paramArray.Length(); i++) {
-					jsargs->parameters.push_back(Utils::BindParameter(paramArray.Get(i)));
-				}
+			if (obj.Has("columns") || obj.Has("batches")) {
+				ReadJSResultSet(jsargs->result, obj);
 			} else {
-				throw duckdb::InvalidInputException("Expected parameter array");
+				jsargs->result->function = obj.Get("function").ToString().Utf8Value();
+				auto parameters = obj.Get("parameters");
+				if (parameters.IsArray()) {
+					auto paramArray = parameters.As<Napi::Array>();
+					for (uint32_t i = 0; i < paramArray.Length(); i++) {
+						jsargs->result->parameters.push_back(Utils::BindParameter(paramArray.Get(i)));
+					}
+				} else {
+					throw duckdb::InvalidInputException("Expected parameter array");
+				}
 			}
 		} else if (!result.IsNull()) {
 			throw std::runtime_error("Invalid scan replacement result");
@@ -310,45 +631,45 @@ void DuckDBNodeRSLauncher(Napi::Env env, Napi::Function jsrs, std::nullptr_t *,
 
 static duckdb::unique_ptr<duckdb::TableRef>
 ScanReplacement(duckdb::ClientContext &context, duckdb::ReplacementScanInput& info, duckdb::optional_ptr<duckdb::ReplacementScanData> data) {
+	auto &scan_data = (NodeReplacementScanData &)*data;
+	auto cached = scan_data.cache->Get(info.table_name);
+	if (cached) {
+		return cached->CreateTableRef();
+	}
 	JSRSArgs jsargs;
 	jsargs.table = info.table_name;
-	((NodeReplacementScanData *)data.get())->rs.BlockingCall(&jsargs);
+	scan_data.rs.BlockingCall(&jsargs);
 	while (!jsargs.done) {
 		std::this_thread::yield();
 	}
 	if (jsargs.error.HasError()) {
 		jsargs.error.Throw();
 	}
-	if (jsargs.function != "") {
-		auto table_function = duckdb::make_uniq<duckdb::TableFunctionRef>();
-		duckdb::vector<duckdb::unique_ptr<duckdb::ParsedExpression>> children;
-		for (auto &param : jsargs.parameters) {
-			children.push_back(duckdb::make_uniq<duckdb::ConstantExpression>(std::move(param)));
-		}
-		table_function->function = duckdb::make_uniq<duckdb::FunctionExpression>(jsargs.function, std::move(children));
-		return std::move(table_function);
-	}
-	return nullptr;
+	scan_data.cache->Put(info.table_name, jsargs.result);
+	return jsargs.result->CreateTableRef();
 }
 
 struct RegisterRsTask : public Task {
-	RegisterRsTask(Database &database, duckdb_node_rs_function_t rs, Napi::Promise::Deferred deferred)
-	    : Task(database), rs(std::move(rs)), deferred(deferred) {
+	RegisterRsTask(Database &database, duckdb_node_rs_function_t rs, duckdb::shared_ptr<ReplacementScanCache> cache,
+	               Napi::Promise::Deferred deferred)
+	    : Task(database), rs(std::move(rs)), cache(std::move(cache)), deferred(deferred) {
 	}
 
 	void DoWork() override {
 		auto &database = Get<Database>();
 		if (database.database) {
 			database.database->instance->config.replacement_scans.emplace_back(
-			    ScanReplacement, duckdb::make_uniq<NodeReplacementScanData>(rs));
+			    ScanReplacement, duckdb::make_uniq<NodeReplacementScanData>(rs, cache));
 		}
 	}
 
 	void DoCallback() override {
+		Get<Database>().replacement_scan_caches.push_back(cache);
 		deferred.Resolve(deferred.Env().Undefined());
 	}
 
 	duckdb_node_rs_function_t rs;
+	duckdb::shared_ptr<ReplacementScanCache> cache;
 	Napi::Promise::Deferred deferred;
 };
 
@@ -359,12 +680,291 @@ Napi::Value Database::RegisterReplacementScan(const Napi::CallbackInfo &info) {
 		throw Napi::TypeError::New(env, "Replacement scan callback expected");
 	}
 	Napi::Function rs_callback = info[0].As<Napi::Function>();
+
+	bool cache_results = false;
+	int64_t ttl_ms = 0;
+	if (info.Length() > 1 && info[1].IsObject()) {
+		auto options = info[1].As<Napi::Object>();
+		if (options.Has("ttl")) {
+			if (!options.Get("ttl").IsNumber()) {
+				throw Napi::TypeError::New(env, "Replacement scan option ttl must be a number of milliseconds");
+			}
+			ttl_ms = options.Get("ttl").As<Napi::Number>().Int64Value();
+			cache_results = true;
+		}
+		if (options.Has("cache")) {
+			cache_results = options.Get("cache").ToBoolean();
+		}
+	}
+
 	auto rs =
 	    duckdb_node_rs_function_t::New(env, rs_callback, "duckdb_node_rs_" + std::to_string(replacement_scan_count++),
 	                                   0, 1, nullptr, [](Napi::Env, void *, std::nullptr_t *ctx) {});
 	rs.Unref(env);
 
-	Schedule(info.Env(), duckdb::make_uniq<RegisterRsTask>(*this, rs, deferred));
+	auto cache = duckdb::make_shared_ptr<ReplacementScanCache>(cache_results, ttl_ms);
+	Schedule(info.Env(), duckdb::make_uniq<RegisterRsTask>(*this, rs, cache, deferred));
+
+	return deferred.Promise();
+}
+
+Napi::Value Database::InvalidateReplacementScans(const Napi::CallbackInfo &info) {
+	if (info.Length() > 0 && info[0].IsString()) {
+		auto table = info[0].As<Napi::String>().Utf8Value();
+		for (auto &cache : replacement_scan_caches) {
+			cache->Invalidate(table);
+		}
+	} else {
+		for (auto &cache : replacement_scan_caches) {
+			cache->Invalidate();
+		}
+	}
+	return info.This();
+}
+
+NodeMemoryFileSystem &Database::GetMemoryFileSystem() {
+	if (!database) {
+		throw duckdb::ConnectionException("Database is closed");
+	}
+	if (!memory_fs) {
+		auto memory_fs_ptr = duckdb::make_uniq<NodeMemoryFileSystem>();
+		memory_fs = memory_fs_ptr.get();
+		duckdb::FileSystem::GetFileSystem(*database->instance).RegisterSubSystem(std::move(memory_fs_ptr));
+	}
+	return *memory_fs;
+}
+
+NodePipeFileSystem &Database::GetPipeFileSystem() {
+	if (!database) {
+		throw duckdb::ConnectionException("Database is closed");
+	}
+	if (!pipe_fs) {
+		auto pipe_fs_ptr = duckdb::make_uniq<NodePipeFileSystem>();
+		pipe_fs = pipe_fs_ptr.get();
+		duckdb::FileSystem::GetFileSystem(*database->instance).RegisterSubSystem(std::move(pipe_fs_ptr));
+	}
+	return *pipe_fs;
+}
+
+struct FileBufferTask : public Task {
+	FileBufferTask(Database &database, std::string name, Napi::Function callback)
+	    : Task(database, callback), name(NodeMemoryFileSystem::NormalizePath(name)) {
+	}
+
+	void DoWork() override {
+		try {
+			Work(Get<Database>().GetMemoryFileSystem());
+		} catch (std::exception &ex) {
+			error = duckdb::ErrorData(ex);
+		}
+	}
+
+	virtual void Work(NodeMemoryFileSystem &memory_fs) = 0;
+
+	void Callback() override {
+		auto &database = Get<Database>();
+		auto env = database.Env();
+		Napi::HandleScope scope(env);
+
+		if (error.HasError()) {
+			callback.Value().MakeCallback(database.Value(), {Utils::CreateError(env, error)});
+			return;
+		}
+		callback.Value().MakeCallback(database.Value(), {env.Null(), Result(env)});
+	}
+
+	virtual Napi::Value Result(Napi::Env env) {
+		return env.Undefined();
+	}
+
+	std::string name;
+	duckdb::ErrorData error;
+};
+
+struct RegisterFileBufferTask : public FileBufferTask {
+	RegisterFileBufferTask(Database &database, std::string name, Napi::Buffer<char> buffer, Napi::Function callback)
+	    : FileBufferTask(database, std::move(name), callback), buffer(Napi::Persistent(buffer)),
+	      data(buffer.Data()), size(buffer.Length()) {
+	}
+
+	void Work(NodeMemoryFileSystem &memory_fs) override {
+		memory_fs.RegisterFile(name, data, size);
+	}
+
+	void DoCallback() override {
+		if (!error.HasError()) {
+			// the file system reads straight from the buffer, keep it alive until the file is unregistered
+			Get<Database>().file_buffers[name] = std::move(buffer);
+		}
+		FileBufferTask::DoCallback();
+	}
+
+	Napi::Reference<Napi::Buffer<char>> buffer;
+	const char *data;
+	duckdb::idx_t size;
+};
+
+struct UnregisterFileBufferTask : public FileBufferTask {
+	UnregisterFileBufferTask(Database &database, std::string name, Napi::Function callback)
+	    : FileBufferTask(database, std::move(name), callback) {
+	}
+
+	void Work(NodeMemoryFileSystem &memory_fs) override {
+		if (!memory_fs.UnregisterFile(name)) {
+			throw duckdb::IOException("No file \"%s\" registered in the memory file system", name);
+		}
+	}
+
+	void DoCallback() override {
+		Get<Database>().file_buffers.erase(name);
+		FileBufferTask::DoCallback();
+	}
+};
+
+struct GetFileBufferTask : public FileBufferTask {
+	GetFileBufferTask(Database &database, std::string name, Napi::Function callback)
+	    : FileBufferTask(database, std::move(name), callback) {
+	}
+
+	void Work(NodeMemoryFileSystem &memory_fs) override {
+		contents = memory_fs.GetFileContents(name);
+		if (!contents) {
+			throw duckdb::IOException("No file \"%s\" in the memory file system", name);
+		}
+	}
+
+	Napi::Value Result(Napi::Env env) override {
+		// hand out the snapshot without copying, later writes to the file copy it first
+		auto contents_ptr = new duckdb::shared_ptr<std::string>(std::move(contents));
+		auto deleter = [](Napi::Env, void *finalizeData, void *hint) {
+			delete static_cast<duckdb::shared_ptr<std::string> *>(hint);
+		};
+		return Napi::Buffer<char>::NewOrCopy(env, (char *)(*contents_ptr)->data(), (*contents_ptr)->size(), deleter,
+		                                     contents_ptr);
+	}
+
+	duckdb::shared_ptr<std::string> contents;
+};
+
+Napi::Value Database::RegisterFileBuffer(const Napi::CallbackInfo &info) {
+	auto env = info.Env();
+	if (info.Length() < 2 || !info[0].IsString() || !info[1].IsBuffer()) {
+		throw Napi::TypeError::New(env, "File name and Buffer expected");
+	}
+	Napi::Function callback;
+	if (info.Length() > 2 && info[2].IsFunction()) {
+		callback = info[2].As<Napi::Function>();
+	}
+	Schedule(env, duckdb::make_uniq<RegisterFileBufferTask>(*this, info[0].As<Napi::String>(),
+	                                                        info[1].As<Napi::Buffer<char>>(), callback));
+	return info.This();
+}
+
+Napi::Value Database::UnregisterFileBuffer(const Napi::CallbackInfo &info) {
+	auto env = info.Env();
+	if (info.Length() < 1 || !info[0].IsString()) {
+		throw Napi::TypeError::New(env, "File name expected");
+	}
+	Napi::Function callback;
+	if (info.Length() > 1 && info[1].IsFunction()) {
+		callback = info[1].As<Napi::Function>();
+	}
+	Schedule(env, duckdb::make_uniq<UnregisterFileBufferTask>(*this, info[0].As<Napi::String>(), callback));
+	return info.This();
+}
+
+Napi::Value Database::GetFileBuffer(const Napi::CallbackInfo &info) {
+	auto env = info.Env();
+	if (info.Length() < 2 || !info[0].IsString() || !info[1].IsFunction()) {
+		throw Napi::TypeError::New(env, "File name and callback expected");
+	}
+	Schedule(env, duckdb::make_uniq<GetFileBufferTask>(*this, info[0].As<Napi::String>(),
+	                                                   info[1].As<Napi::Function>()));
+	return info.This();
+}
+
+struct RegisterFsTask : public Task {
+	RegisterFsTask(Database &database, std::string prefix, duckdb_node_fs_function_t jsfs,
+	               JSFileSystemOptions options, Napi::Promise::Deferred deferred)
+	    : Task(database), prefix(std::move(prefix)), jsfs(std::move(jsfs)), options(options), deferred(deferred) {
+	}
+
+	void DoWork() override {
+		auto &database = Get<Database>();
+		if (!database.database) {
+			error = duckdb::ErrorData(duckdb::ConnectionException("Database is closed"));
+			return;
+		}
+		try {
+			auto file_system = duckdb::make_uniq<JSFileSystem>(prefix, jsfs, options);
+			// the file system releases the JS function from here on, also if it cannot be registered
+			handed_over = true;
+			duckdb::FileSystem::GetFileSystem(*database.database->instance).RegisterSubSystem(std::move(file_system));
+		} catch (std::exception &ex) {
+			error = duckdb::ErrorData(ex);
+		}
+	}
+
+	void DoCallback() override {
+		auto env = deferred.Env();
+		Napi::HandleScope scope(env);
+		if (!handed_over) {
+			jsfs.Release();
+		}
+		if (error.HasError()) {
+			deferred.Reject(Utils::CreateError(env, error));
+			return;
+		}
+		deferred.Resolve(env.Undefined());
+	}
+
+	std::string prefix;
+	duckdb_node_fs_function_t jsfs;
+	JSFileSystemOptions options;
+	Napi::Promise::Deferred deferred;
+	duckdb::ErrorData error;
+	bool handed_over = false;
+};
+
+static duckdb::idx_t GetSizeOption(Napi::Object options, const char *name, duckdb::idx_t default_value) {
+	auto value = options.Get(name);
+	if (value.IsUndefined()) {
+		return default_value;
+	}
+	if (!value.IsNumber() || value.As<Napi::Number>().DoubleValue() < 0) {
+		throw Napi::TypeError::New(options.Env(), std::string(name) + " must be a non-negative number");
+	}
+	return value.As<Napi::Number>().Int64Value();
+}
+
+Napi::Value Database::RegisterFileSystem(const Napi::CallbackInfo &info) {
+	auto env = info.Env();
+	if (info.Length() < 2 || !info[0].IsString() || !info[1].IsFunction()) {
+		throw Napi::TypeError::New(env, "File system prefix and callback expected");
+	}
+	std::string prefix = info[0].As<Napi::String>();
+	if (prefix.empty()) {
+		throw Napi::TypeError::New(env, "File system prefix must not be empty");
+	}
+
+	JSFileSystemOptions options;
+	if (info.Length() > 2 && info[2].IsObject()) {
+		auto options_obj = info[2].As<Napi::Object>();
+		options.block_size = GetSizeOption(options_obj, "blockSize", options.block_size);
+		options.cache_size = GetSizeOption(options_obj, "cacheSize", options.cache_size);
+		options.read_ahead = GetSizeOption(options_obj, "readAhead", options.read_ahead);
+		if (options.block_size == 0) {
+			throw Napi::TypeError::New(env, "blockSize must be positive");
+		}
+	}
+
+	auto deferred = Napi::Promise::Deferred::New(env);
+	auto jsfs = duckdb_node_fs_function_t::New(env, info[1].As<Napi::Function>(),
+	                                           "duckdb_node_fs_" + std::to_string(file_system_count++), 0, 1, nullptr,
+	                                           [](Napi::Env, void *, std::nullptr_t *ctx) {});
+	jsfs.Unref(env);
+
+	Schedule(env, duckdb::make_uniq<RegisterFsTask>(*this, prefix, jsfs, options, deferred));
 
 	return deferred.Promise();
 }
@@ -161,6 +161,16 @@ idx_t ColumnReader::FileOffset() const {
 	return min_offset;
 }
 
+bool ColumnReader::SupportsPageSkipping() const {
+	// pages are only guaranteed to start at row boundaries for the leaves that are not repeated
+	return column_schema.schema_type == ParquetColumnSchemaType::COLUMN && !Type().IsNested() && !HasRepeats();
+}
+
+void ColumnReader::SetOffsetIndex(shared_ptr<const duckdb_parquet::OffsetIndex> offset_index_p) {
+	D_ASSERT(SupportsPageSkipping());
+	offset_index = std::move(offset_index_p);
+}
+
 idx_t ColumnReader::GroupRowsAvailable() {
 	return group_rows_available;
 }
@@ -203,6 +213,7 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	offset_index.reset();
 }
 
 bool ColumnReader::PageIsFilteredOut(PageHeader &page_hdr) {
@@ -726,6 +737,12 @@ void ColumnReader::ApplyPendingSkips(data_ptr_t define_out, data_ptr_t repeat_ou
 	BeginRead(nullptr, nullptr);
 
 	while (to_skip > 0) {
+		if (offset_index && page_rows_available == 0) {
+			to_skip -= SkipPages(num_values - to_skip, to_skip);
+			if (to_skip == 0) {
+				break;
+			}
+		}
 		auto skip_now = ReadPageHeaders(to_skip);
 		if (page_is_filtered_out) {
 			// the page has been filtered out entirely - skip
@@ -765,6 +782,42 @@ void ColumnReader::ApplyPendingSkips(data_ptr_t define_out, data_ptr_t repeat_ou
 	FinishRead(num_values);
 }
 
+idx_t ColumnReader::SkipPages(idx_t skip_offset, idx_t skip_count) {
+	D_ASSERT(offset_index && page_rows_available == 0);
+	auto &page_locations = offset_index->page_locations;
+	if (page_locations.empty()) {
+		return 0;
+	}
+	// the pages we jump to may be dictionary encoded: read the dictionary page first if we have not done so yet
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	const auto first_page_offset = UnsafeNumericCast<idx_t>(page_locations[0].offset);
+	while (page_rows_available == 0 && trans.GetLocation() < first_page_offset) {
+		PrepareRead(nullptr, nullptr);
+	}
+	if (page_rows_available != 0) {
+		// we ended up in the middle of a data page - skip within it
+		return 0;
+	}
+	// find the last page that starts at or before the row we skip to
+	auto current_row = UnsafeNumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available + skip_offset;
+	auto target_row = current_row + skip_count;
+	auto entry = std::upper_bound(page_locations.begin(), page_locations.end(), target_row,
+	                              [](idx_t row, const duckdb_parquet::PageLocation &location) {
+		                              return row < UnsafeNumericCast<idx_t>(location.first_row_index);
+	                              });
+	if (entry == page_locations.begin()) {
+		return 0;
+	}
+	auto &target_page = *(entry - 1);
+	auto target_page_row = UnsafeNumericCast<idx_t>(target_page.first_row_index);
+	if (target_page_row <= current_row) {
+		// no page is skipped entirely
+		return 0;
+	}
+	trans.SetLocation(UnsafeNumericCast<idx_t>(target_page.offset));
+	return target_page_row - current_row;
+}
+
 //===--------------------------------------------------------------------===//
 // Create Column Reader
 //===--------------------------------------------------------------------===//
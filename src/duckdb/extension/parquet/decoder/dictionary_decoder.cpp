@@ -163,6 +163,7 @@ bool DictionaryDecoder::DictionarySupportsFilter(const TableFilter &filter, Tabl
 	}
 	case TableFilterType::CONSTANT_COMPARISON:
 	case TableFilterType::IS_NOT_NULL:
+	case TableFilterType::BLOOM_FILTER:
 		return true;
 	case TableFilterType::EXPRESSION_FILTER: {
 		// expression filters can only be pushed into the dictionary if they filter out NULL values
@@ -101,6 +101,14 @@ public:
 	// register the range this reader will touch for prefetching
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
 
+	//! Whether skips can jump over entire pages of this reader using the OffsetIndex of the column chunk
+	bool SupportsPageSkipping() const;
+	//! Sets the OffsetIndex of the column chunk that is being read (reset by InitializeRead)
+	void SetOffsetIndex(shared_ptr<const duckdb_parquet::OffsetIndex> offset_index_p);
+	optional_ptr<const duckdb_parquet::OffsetIndex> GetOffsetIndex() const {
+		return offset_index.get();
+	}
+
 	unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
 
 	template <class VALUE_TYPE, class CONVERSION, bool HAS_DEFINES>
@@ -186,6 +194,9 @@ private:
 	idx_t ReadPageHeaders(idx_t max_read, optional_ptr<const TableFilter> filter = nullptr,
 	                      optional_ptr<TableFilterState> filter_state = nullptr);
 	idx_t ReadInternal(uint64_t num_values, data_ptr_t define_out, data_ptr_t repeat_out, Vector &result);
+	//! Jumps over the pages that a skip of skip_count rows starting skip_offset rows into the skip covers entirely,
+	//! returns the number of rows jumped over
+	idx_t SkipPages(idx_t skip_offset, idx_t skip_count);
 	//! Prepare a read of up to "max_read" rows and read the defines/repeats.
 	//! Returns whether all values are valid (i.e., not NULL)
 	bool PrepareRead(idx_t read_count, data_ptr_t define_out, data_ptr_t repeat_out, idx_t result_offset);
@@ -303,6 +314,8 @@ private:
 	idx_t page_rows_available;
 	idx_t group_rows_available;
 	idx_t chunk_read_offset;
+	//! The page locations of the column chunk (if known), used to jump over skipped pages
+	shared_ptr<const duckdb_parquet::OffsetIndex> offset_index;
 
 	shared_ptr<ResizeableBuffer> block;
 
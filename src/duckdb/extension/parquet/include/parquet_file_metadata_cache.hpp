@@ -17,6 +17,12 @@ struct CachingFileHandle;
 
 enum class ParquetCacheValidity { VALID, INVALID, UNKNOWN };
 
+//! The page indexes of a column chunk, empty if the chunk has none
+struct ParquetPageIndex {
+	unique_ptr<const duckdb_parquet::ColumnIndex> column_index;
+	shared_ptr<const duckdb_parquet::OffsetIndex> offset_index;
+};
+
 class ParquetFileMetadataCache : public ObjectCacheEntry {
 public:
 	ParquetFileMetadataCache(unique_ptr<duckdb_parquet::FileMetaData> file_metadata, CachingFileHandle &handle,
@@ -32,6 +38,10 @@ public:
 	//! Parquet footer size
 	idx_t footer_size;
 
+	//! The page indexes of a column in every row group, by column index (read on first use)
+	mutex page_index_lock;
+	unordered_map<idx_t, shared_ptr<const vector<ParquetPageIndex>>> page_indexes;
+
 public:
 	static string ObjectType();
 	string GetObjectType() override;
@@ -41,6 +51,14 @@ public:
 	//! If the OpenFileInfo does not have enough information this can return UNKNOWN
 	ParquetCacheValidity IsValid(const OpenFileInfo &info) const;
 
+	//! Read the entry of the file from the cache directory, returns nullptr if there is none for this path, size and
+	//! modification time
+	static shared_ptr<ParquetFileMetadataCache> ReadPersistent(ClientContext &context, const string &directory,
+	                                                           CachingFileHandle &handle);
+	//! Write the entry of the file to the cache directory on a background thread (on a best-effort basis: failures are
+	//! ignored)
+	void WritePersistent(ClientContext &context, const string &directory, CachingFileHandle &handle) const;
+
 private:
 	bool validate;
 	timestamp_t last_modified;
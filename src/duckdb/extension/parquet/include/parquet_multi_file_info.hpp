@@ -54,6 +54,8 @@ struct ParquetMultiFileInfo : MultiFileReaderInterface {
 	                                        const MultiFileOptions &file_options) override;
 	unique_ptr<NodeStatistics> GetCardinality(const MultiFileBindData &bind_data, idx_t file_count) override;
 	void GetVirtualColumns(ClientContext &context, MultiFileBindData &bind_data, virtual_column_map_t &result) override;
+	void DynamicToString(const GlobalTableFunctionState &global_state,
+	                     InsertionOrderPreservingMap<string> &result) override;
 	unique_ptr<MultiFileReaderInterface> Copy() override;
 	FileGlobInput GetGlobInput() override;
 };
@@ -15,6 +15,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/multi_file/base_file_reader.hpp"
 #include "duckdb/common/multi_file/multi_file_options.hpp"
+#include "duckdb/common/enums/order_type.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "column_reader.hpp"
@@ -55,6 +56,12 @@ struct ParquetScanFilter {
 	unique_ptr<TableFilterState> filter_state;
 };
 
+//! A range [start, end) of rows within a row group
+struct ParquetRowRange {
+	idx_t start;
+	idx_t end;
+};
+
 struct ParquetReaderScanState {
 	vector<idx_t> group_idx_list;
 	int64_t current_group;
@@ -77,6 +84,11 @@ struct ParquetReaderScanState {
 	unique_ptr<AdaptiveFilter> adaptive_filter;
 	//! Table filter list
 	vector<ParquetScanFilter> scan_filters;
+	//! The rows of the current row group that the page indexes rule out, sorted and non-overlapping
+	vector<ParquetRowRange> skipped_ranges;
+	idx_t skipped_range_idx = 0;
+	//! The amount of pages that were not read because of the page indexes (reset when reported)
+	idx_t pages_skipped = 0;
 
 	//! (optional) pointer to the PhysicalOperator for logging
 	optional_ptr<const PhysicalOperator> op;
@@ -177,6 +189,9 @@ public:
 
 	idx_t NumRows() const;
 	idx_t NumRowGroups() const;
+	//! Returns the row groups ordered by the statistics of the scan order column of a Top-N, or an empty list if the
+	//! row groups should be scanned in file order
+	vector<idx_t> GetRowGroupScanOrder(OrderType order_type);
 
 	const duckdb_parquet::FileMetaData *GetFileMetadata() const;
 
@@ -225,6 +240,11 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Rules out rows of the current row group using the page indexes (ColumnIndex/OffsetIndex) of the filtered columns
+	void PreparePageSkipping(ClientContext &context, ParquetReaderScanState &state);
+	//! The page indexes of a column in every row group, read once and kept in the metadata cache
+	shared_ptr<const vector<ParquetPageIndex>> GetPageIndexes(ClientContext &context, ParquetReaderScanState &state,
+	                                                          idx_t column_idx);
 	ParquetColumnSchema ParseColumnSchema(const SchemaElement &s_ele, idx_t max_define, idx_t max_repeat,
 	                                      idx_t schema_index, idx_t column_index,
 	                                      ParquetColumnSchemaType type = ParquetColumnSchemaType::COLUMN);
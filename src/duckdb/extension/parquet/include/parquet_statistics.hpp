@@ -26,6 +26,10 @@ struct ParquetStatisticsUtils {
 
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ParquetColumnSchema &reader,
 	                                                            const vector<ColumnChunk> &columns, bool can_have_nan);
+	//! Transforms the statistics of a leaf column covering num_values values, e.g., those of a single page
+	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ParquetColumnSchema &schema,
+	                                                            const duckdb_parquet::Statistics &parquet_stats,
+	                                                            idx_t num_values, bool can_have_nan);
 
 	static Value ConvertValue(const LogicalType &type, const ParquetColumnSchema &schema_ele, const std::string &stats);
 
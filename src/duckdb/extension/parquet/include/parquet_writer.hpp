@@ -72,6 +72,14 @@ struct ParquetBloomFilterEntry {
 	idx_t column_idx;
 };
 
+struct ParquetPageIndexEntry {
+	//! nullptr if the pages of the column could not all be described by min/max values
+	unique_ptr<duckdb_parquet::ColumnIndex> column_index;
+	unique_ptr<duckdb_parquet::OffsetIndex> offset_index;
+	idx_t row_group_idx;
+	idx_t column_idx;
+};
+
 enum class ParquetVersion : uint8_t {
 	V1 = 1, //! Excludes DELTA_BINARY_PACKED, DELTA_LENGTH_BYTE_ARRAY, BYTE_STREAM_SPLIT
 	V2 = 2, //! Includes the encodings above
@@ -85,7 +93,8 @@ public:
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, optional_idx dictionary_size_limit,
 	              idx_t string_dictionary_page_size_limit, bool enable_bloom_filters,
 	              double bloom_filter_false_positive_ratio, int64_t compression_level, bool debug_use_openssl,
-	              ParquetVersion parquet_version, GeoParquetVersion geoparquet_version);
+	              ParquetVersion parquet_version, GeoParquetVersion geoparquet_version, bool write_page_index,
+	              vector<idx_t> cluster_by);
 	~ParquetWriter();
 
 public:
@@ -131,6 +140,9 @@ public:
 	double BloomFilterFalsePositiveRatio() const {
 		return bloom_filter_false_positive_ratio;
 	}
+	bool WritePageIndex() const {
+		return write_page_index;
+	}
 	int64_t CompressionLevel() const {
 		return compression_level;
 	}
@@ -156,12 +168,17 @@ public:
 	                              optional_ptr<duckdb_parquet::Type::type> type = nullptr);
 
 	void BufferBloomFilter(idx_t col_idx, unique_ptr<ParquetBloomFilter> bloom_filter);
+	void BufferPageIndex(idx_t col_idx, unique_ptr<duckdb_parquet::ColumnIndex> column_index,
+	                     unique_ptr<duckdb_parquet::OffsetIndex> offset_index);
 	void SetWrittenStatistics(CopyFunctionFileStatistics &written_stats);
 	void FlushColumnStats(idx_t col_idx, duckdb_parquet::ColumnChunk &chunk,
 	                      optional_ptr<ColumnWriterStatistics> writer_stats);
 
 private:
 	void GatherWrittenStatistics();
+	//! Sorts the rows of a row group by the CLUSTER_BY columns
+	unique_ptr<ColumnDataCollection> ClusterRowGroup(ColumnDataCollection &buffer);
+	void WritePageIndexes();
 
 private:
 	ClientContext &context;
@@ -180,6 +197,9 @@ private:
 	shared_ptr<EncryptionUtil> encryption_util;
 	ParquetVersion parquet_version;
 	GeoParquetVersion geoparquet_version;
+	bool write_page_index;
+	//! The columns by which the rows are sorted within every row group
+	vector<idx_t> cluster_by;
 	vector<ParquetColumnSchema> column_schemas;
 
 	unique_ptr<BufferedFileWriter> writer;
@@ -194,6 +214,7 @@ private:
 
 	unique_ptr<GeoParquetFileMetadata> geoparquet_data;
 	vector<ParquetBloomFilterEntry> bloom_filters;
+	vector<ParquetPageIndexEntry> page_indexes;
 
 	optional_ptr<CopyFunctionFileStatistics> written_stats;
 	unique_ptr<ParquetStatsAccumulator> stats_accumulator;
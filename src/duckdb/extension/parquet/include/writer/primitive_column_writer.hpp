@@ -33,6 +33,8 @@ struct PageWriteInformation {
 	size_t compressed_size;
 	data_ptr_t compressed_data;
 	AllocatedData compressed_buf;
+	//! The statistics of only this page, tracked for data pages when writing the page index
+	unique_ptr<ColumnWriterStatistics> page_stats;
 };
 
 class PrimitiveColumnWriterState : public ColumnWriterState {
@@ -67,6 +69,8 @@ public:
 	//! Dictionary pages must be below 2GB. Unlike data pages, there's only one dictionary page.
 	//! For this reason we go with a much higher, but still a conservative upper bound of 1GB;
 	static constexpr const idx_t MAX_UNCOMPRESSED_DICT_PAGE_SIZE = 1073741824ULL;
+	//! Pages hold at most this many rows when writing the page index, so that readers can skip parts of a row group
+	static constexpr const idx_t MAX_PAGE_INDEX_PAGE_ROWS = 20000;
 
 public:
 	unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::RowGroup &row_group) override;
@@ -99,6 +103,11 @@ protected:
 	//! Writes a (subset of a) vector to the specified serializer. Only used for scalar types.
 	virtual void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
 	                         Vector &vector, idx_t chunk_start, idx_t chunk_end) = 0;
+	//! Updates the statistics of a single page with a (subset of a) vector. Pages of writers that do not track these
+	//! get no min/max in the page index
+	virtual void UpdatePageStatistics(ColumnWriterStatistics &page_stats, Vector &vector, idx_t chunk_start,
+	                                  idx_t chunk_end) {
+	}
 
 	virtual bool HasDictionary(PrimitiveColumnWriterState &state_p) {
 		return false;
@@ -109,6 +118,10 @@ protected:
 	virtual void FlushDictionary(PrimitiveColumnWriterState &state, ColumnWriterStatistics *stats);
 
 	void SetParquetStatistics(PrimitiveColumnWriterState &state, duckdb_parquet::ColumnChunk &column);
+	//! Whether the page index is written for this column - only for flat columns, for which pages start at rows
+	bool WritesPageIndex() const;
+	//! Creates the column index from the page statistics, or nullptr if not every page has bounds
+	unique_ptr<duckdb_parquet::ColumnIndex> CreateColumnIndex(PrimitiveColumnWriterState &state);
 	void RegisterToRowGroup(duckdb_parquet::RowGroup &row_group);
 };
 
@@ -283,6 +283,19 @@ public:
 		}
 	}
 
+	void UpdatePageStatistics(ColumnWriterStatistics &page_stats, Vector &input_column, idx_t chunk_start,
+	                          idx_t chunk_end) override {
+		const auto &mask = FlatVector::Validity(input_column);
+		const auto *data_ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			const TGT target_value = OP::template Operation<SRC, TGT>(data_ptr[r]);
+			OP::template HandleStats<SRC, TGT>(&page_stats, target_value);
+		}
+	}
+
 	void FlushDictionary(PrimitiveColumnWriterState &state_p, ColumnWriterStatistics *stats) override {
 		auto &state = state_p.Cast<StandardColumnWriterState<SRC, TGT, OP>>();
 		D_ASSERT(state.encoding == duckdb_parquet::Encoding::RLE_DICTIONARY);
@@ -23,6 +23,7 @@
 #include <vector>
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/catalog_entry/table_function_catalog_entry.hpp"
+#include "duckdb/common/bind_helpers.hpp"
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/enums/file_compression_type.hpp"
 #include "duckdb/common/file_system.hpp"
@@ -241,6 +242,11 @@ struct ParquetWriteBindData : public TableFunctionData {
 
 	//! Which geo-parquet version to use when writing
 	GeoParquetVersion geoparquet_version = GeoParquetVersion::V1;
+
+	//! Whether to write the column and offset indexes with the min/max and location of every page
+	bool write_page_index = false;
+	//! The columns by which the rows are sorted within every row group
+	vector<idx_t> cluster_by;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -295,6 +301,8 @@ static void ParquetListCopyOptions(ClientContext &context, CopyOptionsInput &inp
 	copy_options["file_row_number"] = CopyOption(LogicalType::BOOLEAN, CopyOptionMode::READ_ONLY);
 	copy_options["can_have_nan"] = CopyOption(LogicalType::BOOLEAN, CopyOptionMode::READ_ONLY);
 	copy_options["geoparquet_version"] = CopyOption(LogicalType::VARCHAR, CopyOptionMode::WRITE_ONLY);
+	copy_options["write_page_index"] = CopyOption(LogicalType::BOOLEAN, CopyOptionMode::WRITE_ONLY);
+	copy_options["cluster_by"] = CopyOption(LogicalType::ANY, CopyOptionMode::WRITE_ONLY);
 }
 
 static unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBindInput &input,
@@ -305,6 +313,12 @@ static unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFun
 	auto bind_data = make_uniq<ParquetWriteBindData>();
 	for (auto &option : input.info.options) {
 		const auto loption = StringUtil::Lower(option.first);
+		if (loption == "cluster_by") {
+			// a column list, like PARTITION_BY
+			auto column_names = names;
+			bind_data->cluster_by = ParseColumnsOrdered(ConvertVectorToValue(option.second), column_names, loption);
+			continue;
+		}
 		if (option.second.size() != 1) {
 			// All parquet write options require exactly one argument
 			throw BinderException("%s requires exactly one argument", StringUtil::Upper(loption));
@@ -397,6 +411,8 @@ static unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFun
 			bind_data->string_dictionary_page_size_limit = val;
 		} else if (loption == "write_bloom_filter") {
 			bind_data->enable_bloom_filters = BooleanValue::Get(option.second[0].DefaultCastAs(LogicalType::BOOLEAN));
+		} else if (loption == "write_page_index") {
+			bind_data->write_page_index = BooleanValue::Get(option.second[0].DefaultCastAs(LogicalType::BOOLEAN));
 		} else if (loption == "bloom_filter_false_positive_ratio") {
 			auto val = option.second[0].GetValue<double>();
 			if (val <= 0) {
@@ -475,7 +491,7 @@ static unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext
 	    parquet_bind.dictionary_size_limit, parquet_bind.string_dictionary_page_size_limit,
 	    parquet_bind.enable_bloom_filters, parquet_bind.bloom_filter_false_positive_ratio,
 	    parquet_bind.compression_level, parquet_bind.debug_use_openssl, parquet_bind.parquet_version,
-	    parquet_bind.geoparquet_version);
+	    parquet_bind.geoparquet_version, parquet_bind.write_page_index, parquet_bind.cluster_by);
 	return std::move(global_state);
 }
 
@@ -732,6 +748,9 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	                                    default_value.string_dictionary_page_size_limit);
 	serializer.WritePropertyWithDefault(116, "geoparquet_version", bind_data.geoparquet_version,
 	                                    default_value.geoparquet_version);
+	serializer.WritePropertyWithDefault(117, "write_page_index", bind_data.write_page_index,
+	                                    default_value.write_page_index);
+	serializer.WritePropertyWithDefault(118, "cluster_by", bind_data.cluster_by);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -766,6 +785,9 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	    115, "string_dictionary_page_size_limit", default_value.string_dictionary_page_size_limit);
 	data->geoparquet_version =
 	    deserializer.ReadPropertyWithExplicitDefault(116, "geoparquet_version", default_value.geoparquet_version);
+	data->write_page_index =
+	    deserializer.ReadPropertyWithExplicitDefault(117, "write_page_index", default_value.write_page_index);
+	deserializer.ReadPropertyWithDefault<vector<idx_t>>(118, "cluster_by", data->cluster_by);
 
 	return std::move(data);
 }
@@ -1021,6 +1043,10 @@ static void LoadInternal(ExtensionLoader &loader) {
 	config.AddExtensionOption("parquet_metadata_cache",
 	                          "Cache Parquet metadata - useful when reading the same files multiple times",
 	                          LogicalType::BOOLEAN, Value(false));
+	config.AddExtensionOption("parquet_metadata_cache_directory",
+	                          "Directory in which Parquet metadata is cached across restarts, keyed by file path, size "
+	                          "and modification time - disabled if empty",
+	                          LogicalType::VARCHAR, Value(""));
 	config.AddExtensionOption(
 	    "enable_geoparquet_conversion",
 	    "Attempt to decode/encode geometry data in/as GeoParquet files if the spatial extension is present.",
@@ -1,9 +1,22 @@
 #include "parquet_file_metadata_cache.hpp"
+#include "thrift_tools.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/external_file_cache.hpp"
 #include "duckdb/storage/caching_file_system.hpp"
 
 namespace duckdb {
 
+using duckdb_apache::thrift::protocol::TCompactProtocolT;
+using duckdb_apache::thrift::transport::TMemoryBuffer;
+
+//! Files in the cache directory start with this magic number and version
+static constexpr uint32_t PERSISTENT_CACHE_MAGIC = 0x4D515044; // "DPQM"
+static constexpr uint32_t PERSISTENT_CACHE_VERSION = 1;
+
 ParquetFileMetadataCache::ParquetFileMetadataCache(unique_ptr<duckdb_parquet::FileMetaData> file_metadata,
                                                    CachingFileHandle &handle,
                                                    unique_ptr<GeoParquetFileMetadata> geo_metadata, idx_t footer_size)
@@ -52,4 +65,190 @@ ParquetCacheValidity ParquetFileMetadataCache::IsValid(const OpenFileInfo &info)
 	return ParquetCacheValidity::INVALID;
 }
 
+//! Entries are named after the hash of the file path, which is stored in the entry as well to rule out collisions
+static string PersistentCachePath(FileSystem &fs, const string &directory, const string &path) {
+	return fs.JoinPath(directory, StringUtil::Format("%llx.parquet_metadata", Hash(path.c_str())));
+}
+
+static void WriteString(WriteStream &stream, const string &str) {
+	stream.Write<uint32_t>(NumericCast<uint32_t>(str.size()));
+	stream.WriteData(const_data_ptr_cast(str.c_str()), str.size());
+}
+
+static string ReadString(ReadStream &stream) {
+	auto size = stream.Read<uint32_t>();
+	string result(size, '\0');
+	stream.ReadData(data_ptr_cast(&result[0]), size);
+	return result;
+}
+
+shared_ptr<ParquetFileMetadataCache> ParquetFileMetadataCache::ReadPersistent(ClientContext &context,
+                                                                              const string &directory,
+                                                                              CachingFileHandle &handle) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	try {
+		auto cache_path = PersistentCachePath(fs, directory, handle.GetPath());
+		auto cache_file =
+		    fs.OpenFile(cache_path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+		if (!cache_file) {
+			return nullptr;
+		}
+		auto size = cache_file->GetFileSize();
+		auto buffer = make_unsafe_uniq_array_uninitialized<data_t>(size);
+		cache_file->Read(buffer.get(), size);
+		cache_file.reset();
+
+		MemoryStream stream(buffer.get(), size);
+		if (stream.Read<uint32_t>() != PERSISTENT_CACHE_MAGIC || stream.Read<uint32_t>() != PERSISTENT_CACHE_VERSION) {
+			return nullptr;
+		}
+		// the entry is only valid for the same file, with the same size and modification time
+		if (ReadString(stream) != handle.GetPath() || stream.Read<uint64_t>() != handle.GetFileSize() ||
+		    stream.Read<int64_t>() != handle.GetLastModifiedTime().value) {
+			return nullptr;
+		}
+		auto footer_size = stream.Read<uint32_t>();
+		auto metadata_size = stream.Read<uint32_t>();
+		if (metadata_size > size - stream.GetPosition()) {
+			return nullptr;
+		}
+		auto metadata_ptr = buffer.get() + stream.GetPosition();
+		auto transport = duckdb_base_std::make_shared<TMemoryBuffer>(metadata_ptr, metadata_size);
+		TCompactProtocolT<TMemoryBuffer> protocol(std::move(transport));
+		auto metadata = make_uniq<duckdb_parquet::FileMetaData>();
+		metadata->read(&protocol);
+
+		auto geo_metadata = GeoParquetFileMetadata::TryRead(*metadata, context);
+		return make_shared_ptr<ParquetFileMetadataCache>(std::move(metadata), handle, std::move(geo_metadata),
+		                                                 footer_size);
+	} catch (std::exception &ex) {
+		// an unreadable, truncated or otherwise corrupt entry is a cache miss - it is overwritten once the footer has
+		// been read, if the cache directory can be written
+		return nullptr;
+	}
+}
+
+//! Writes an entry to a temporary file first, so that concurrent readers never see a partially written entry
+static void WritePersistentEntry(FileSystem &fs, const string &directory, const string &cache_path, string &data) {
+	auto temp_path = cache_path + "." + UUID::ToString(UUID::GenerateRandomUUID()) + ".tmp";
+	try {
+		if (!fs.DirectoryExists(directory)) {
+			fs.CreateDirectoriesRecursive(directory);
+		}
+		{
+			auto flags = FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW;
+			auto temp_file = fs.OpenFile(temp_path, flags);
+			temp_file->Write(&data[0], data.size());
+			temp_file->Sync();
+		}
+		fs.MoveFile(temp_path, cache_path);
+	} catch (std::exception &ex) {
+		// the cache is an optimization only: a directory we cannot write to should not fail anything
+		fs.TryRemoveFile(temp_path);
+	}
+}
+
+//! Writes entries on the background threads of the database, so that a query that misses the cache does not wait
+//! for the entry to be written and synced
+class ParquetMetadataCacheWriter : public ObjectCacheEntry {
+public:
+	explicit ParquetMetadataCacheWriter(DatabaseInstance &db)
+	    : fs(FileSystem::GetFileSystem(db)), scheduler(TaskScheduler::GetScheduler(db)),
+	      token(scheduler.CreateProducer(TaskPriority::LOW)), pending(0) {
+	}
+	~ParquetMetadataCacheWriter() override {
+		// the tasks refer to the writer: run the ones that did not start yet, and wait for the others to finish
+		shared_ptr<Task> task;
+		while (scheduler.GetTaskFromProducer(*token, task)) {
+			task->Execute(TaskExecutionMode::PROCESS_ALL);
+			task.reset();
+		}
+		while (pending > 0) {
+			TaskScheduler::YieldThread();
+		}
+	}
+
+	FileSystem &fs;
+	TaskScheduler &scheduler;
+	unique_ptr<ProducerToken> token;
+	//! Scheduled tasks that did not finish yet
+	atomic<idx_t> pending;
+
+public:
+	static string ObjectType() {
+		return "parquet_metadata_cache_writer";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	void Write(const string &directory, const string &cache_path, string data);
+};
+
+class ParquetMetadataCacheWriteTask : public Task {
+public:
+	ParquetMetadataCacheWriteTask(ParquetMetadataCacheWriter &writer, string directory_p, string cache_path_p,
+	                              string data_p)
+	    : writer(writer), directory(std::move(directory_p)), cache_path(std::move(cache_path_p)),
+	      data(std::move(data_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		WritePersistentEntry(writer.fs, directory, cache_path, data);
+		writer.pending--;
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+	string TaskType() const override {
+		return "ParquetMetadataCacheWriteTask";
+	}
+
+private:
+	ParquetMetadataCacheWriter &writer;
+	string directory;
+	string cache_path;
+	string data;
+};
+
+void ParquetMetadataCacheWriter::Write(const string &directory, const string &cache_path, string data) {
+	if (scheduler.NumberOfThreads() <= 1) {
+		// there are no background threads that would pick the task up
+		WritePersistentEntry(fs, directory, cache_path, data);
+		return;
+	}
+	pending++;
+	scheduler.ScheduleTask(*token, make_shared_ptr<ParquetMetadataCacheWriteTask>(*this, directory, cache_path,
+	                                                                            std::move(data)));
+}
+
+void ParquetFileMetadataCache::WritePersistent(ClientContext &context, const string &directory,
+                                               CachingFileHandle &handle) const {
+	auto transport = duckdb_base_std::make_shared<TMemoryBuffer>();
+	TCompactProtocolT<TMemoryBuffer> protocol(transport);
+	metadata->write(&protocol);
+	uint8_t *metadata_ptr;
+	uint32_t metadata_size;
+	transport->getBuffer(&metadata_ptr, &metadata_size);
+
+	MemoryStream stream;
+	stream.Write<uint32_t>(PERSISTENT_CACHE_MAGIC);
+	stream.Write<uint32_t>(PERSISTENT_CACHE_VERSION);
+	WriteString(stream, handle.GetPath());
+	stream.Write<uint64_t>(handle.GetFileSize());
+	stream.Write<int64_t>(handle.GetLastModifiedTime().value);
+	stream.Write<uint32_t>(NumericCast<uint32_t>(footer_size));
+	stream.Write<uint32_t>(metadata_size);
+	stream.WriteData(metadata_ptr, metadata_size);
+
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto writer = ObjectCache::GetObjectCache(context).GetOrCreate<ParquetMetadataCacheWriter>(
+	    ParquetMetadataCacheWriter::ObjectType(), DatabaseInstance::GetDatabase(context));
+	if (!writer) {
+		return;
+	}
+	writer->Write(directory, PersistentCachePath(fs, directory, handle.GetPath()),
+	              string(const_char_ptr_cast(stream.GetData()), stream.GetPosition()));
+}
+
 } // namespace duckdb
@@ -33,15 +33,21 @@ struct ParquetReadBindData : public TableFunctionData {
 };
 
 struct ParquetReadGlobalState : public GlobalTableFunctionState {
-	explicit ParquetReadGlobalState(optional_ptr<const PhysicalOperator> op_p)
-	    : row_group_index(0), batch_index(0), op(op_p) {
+	ParquetReadGlobalState(optional_ptr<const PhysicalOperator> op_p, OrderType scan_order_type_p)
+	    : row_group_index(0), batch_index(0), op(op_p), scan_order_type(scan_order_type_p) {
 	}
 	//! Index of row group within file currently up for scanning
 	idx_t row_group_index;
+	//! (Optionally) the order in which the row groups of the current file are scanned
+	vector<idx_t> row_group_order;
 	//! Batch index of the next row group to be scanned
 	idx_t batch_index;
 	//! (Optional) pointer to physical operator performing the scan
 	optional_ptr<const PhysicalOperator> op;
+	//! (Optionally) the order of the Top-N above the scan, by which the row groups are scheduled
+	OrderType scan_order_type;
+	//! The amount of pages that were not read because of the page indexes
+	atomic<idx_t> pages_skipped {0};
 };
 
 struct ParquetReadLocalState : public LocalTableFunctionState {
@@ -506,6 +512,15 @@ void ParquetMultiFileInfo::GetVirtualColumns(ClientContext &, MultiFileBindData
 	                        TableColumn("file_row_number", LogicalType::BIGINT)));
 }
 
+void ParquetMultiFileInfo::DynamicToString(const GlobalTableFunctionState &global_state,
+                                           InsertionOrderPreservingMap<string> &result) {
+	auto &gstate = global_state.Cast<ParquetReadGlobalState>();
+	auto pages_skipped = gstate.pages_skipped.load();
+	if (pages_skipped > 0) {
+		result.insert(make_pair("Pages Skipped", std::to_string(pages_skipped)));
+	}
+}
+
 shared_ptr<BaseFileReader> ParquetMultiFileInfo::CreateReader(ClientContext &context, GlobalTableFunctionState &,
                                                               BaseUnionData &union_data_p,
                                                               const MultiFileBindData &bind_data_p) {
@@ -547,7 +562,7 @@ shared_ptr<BaseUnionData> ParquetReader::GetUnionData(idx_t file_idx) {
 
 unique_ptr<GlobalTableFunctionState> ParquetMultiFileInfo::InitializeGlobalState(ClientContext &, MultiFileBindData &,
                                                                                  MultiFileGlobalState &global_state) {
-	return make_uniq<ParquetReadGlobalState>(global_state.op);
+	return make_uniq<ParquetReadGlobalState>(global_state.op, global_state.scan_order_type);
 }
 
 unique_ptr<LocalTableFunctionState> ParquetMultiFileInfo::InitializeLocalState(ExecutionContext &,
@@ -563,8 +578,13 @@ bool ParquetReader::TryInitializeScan(ClientContext &context, GlobalTableFunctio
 		// scanned all row groups in this file
 		return false;
 	}
+	if (gstate.row_group_index == 0 && gstate.scan_order_type != OrderType::INVALID) {
+		gstate.row_group_order = GetRowGroupScanOrder(gstate.scan_order_type);
+	}
 	// The current reader has rowgroups left to be scanned
-	vector<idx_t> group_indexes {gstate.row_group_index};
+	auto row_group_idx =
+	    gstate.row_group_order.empty() ? gstate.row_group_index : gstate.row_group_order[gstate.row_group_index];
+	vector<idx_t> group_indexes {row_group_idx};
 	InitializeScan(context, lstate.scan_state, group_indexes);
 	gstate.row_group_index++;
 	return true;
@@ -573,6 +593,7 @@ bool ParquetReader::TryInitializeScan(ClientContext &context, GlobalTableFunctio
 void ParquetReader::FinishFile(ClientContext &context, GlobalTableFunctionState &gstate_p) {
 	auto &gstate = gstate_p.Cast<ParquetReadGlobalState>();
 	gstate.row_group_index = 0;
+	gstate.row_group_order.clear();
 }
 
 void ParquetReader::Scan(ClientContext &context, GlobalTableFunctionState &gstate_p,
@@ -581,6 +602,10 @@ void ParquetReader::Scan(ClientContext &context, GlobalTableFunctionState &gstat
 	auto &local_state = local_state_p.Cast<ParquetReadLocalState>();
 	local_state.scan_state.op = gstate.op;
 	Scan(context, local_state.scan_state, chunk);
+	if (local_state.scan_state.pages_skipped > 0) {
+		gstate.pages_skipped += local_state.scan_state.pages_skipped;
+		local_state.scan_state.pages_skipped = 0;
+	}
 }
 
 unique_ptr<MultiFileReaderInterface> ParquetMultiFileInfo::Copy() {
@@ -28,8 +28,10 @@
 #include "duckdb/storage/object_cache.hpp"
 #include "duckdb/optimizer/statistics_propagator.hpp"
 #include "duckdb/planner/table_filter_state.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
 #include "duckdb/common/multi_file/multi_file_reader.hpp"
 #include "duckdb/logging/log_manager.hpp"
+#include "utf8proc_wrapper.hpp"
 
 #include <cassert>
 #include <chrono>
@@ -174,6 +176,33 @@ LoadMetadata(ClientContext &context, Allocator &allocator, CachingFileHandle &fi
 	                                                 footer_len);
 }
 
+static string MetadataCacheDirectory(ClientContext &context) {
+	Value directory;
+	if (!context.TryGetCurrentSetting("parquet_metadata_cache_directory", directory) || directory.IsNull()) {
+		return string();
+	}
+	return StringValue::Get(directory);
+}
+
+//! Loads the metadata through the cache directory, if one is set: a restarted process does not have to read and
+//! parse the footers of all files again
+static shared_ptr<ParquetFileMetadataCache>
+LoadPersistentMetadata(ClientContext &context, Allocator &allocator, CachingFileHandle &file_handle,
+                       const shared_ptr<const ParquetEncryptionConfig> &encryption_config,
+                       const EncryptionUtil &encryption_util, optional_idx footer_size) {
+	auto directory = MetadataCacheDirectory(context);
+	if (directory.empty() || encryption_config) {
+		// the footers of encrypted files are never written to disk in plain text
+		return LoadMetadata(context, allocator, file_handle, encryption_config, encryption_util, footer_size);
+	}
+	auto metadata = ParquetFileMetadataCache::ReadPersistent(context, directory, file_handle);
+	if (!metadata) {
+		metadata = LoadMetadata(context, allocator, file_handle, encryption_config, encryption_util, footer_size);
+		metadata->WritePersistent(context, directory, file_handle);
+	}
+	return metadata;
+}
+
 LogicalType ParquetReader::DeriveLogicalType(const SchemaElement &s_ele, ParquetColumnSchema &schema) const {
 	// inner node
 	if (s_ele.type == Type::FIXED_LEN_BYTE_ARRAY && !s_ele.__isset.type_length) {
@@ -873,13 +902,13 @@ ParquetReader::ParquetReader(ClientContext &context_p, OpenFileInfo file_p, Parq
 	// or if the cached version already expired
 	if (!metadata_p) {
 		if (!MetadataCacheEnabled(context_p)) {
-			metadata = LoadMetadata(context_p, allocator, *file_handle, parquet_options.encryption_config,
-			                        *encryption_util, footer_size);
+			metadata = LoadPersistentMetadata(context_p, allocator, *file_handle, parquet_options.encryption_config,
+			                                  *encryption_util, footer_size);
 		} else {
 			metadata = ObjectCache::GetObjectCache(context_p).Get<ParquetFileMetadataCache>(file.path);
 			if (!metadata || !metadata->IsValid(*file_handle)) {
-				metadata = LoadMetadata(context_p, allocator, *file_handle, parquet_options.encryption_config,
-				                        *encryption_util, footer_size);
+				metadata = LoadPersistentMetadata(context_p, allocator, *file_handle, parquet_options.encryption_config,
+				                                  *encryption_util, footer_size);
 				ObjectCache::GetObjectCache(context_p).Put(file.path, metadata);
 			}
 		}
@@ -1141,6 +1170,26 @@ static FilterPropagateResult CheckParquetFloatFilter(ColumnReader &reader, const
 	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
 }
 
+static FilterPropagateResult CheckParquetStatistics(ColumnReader &reader, BaseStatistics &stats,
+                                                    const Statistics &pq_col_stats, bool can_have_nan,
+                                                    TableFilter &filter) {
+	bool has_min_max = pq_col_stats.__isset.min_value && pq_col_stats.__isset.max_value;
+	if (has_min_max && reader.Type().id() == LogicalTypeId::VARCHAR) {
+		// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
+		// however, when reading remote Parquet files, skipping row groups is really important
+		// here, we implement a special case to check the full length for string filters
+		return CheckParquetStringFilter(stats, pq_col_stats, filter);
+	}
+	if (has_min_max && (reader.Type().id() == LogicalTypeId::FLOAT || reader.Type().id() == LogicalTypeId::DOUBLE) &&
+	    can_have_nan) {
+		// floating point columns can have NaN values in addition to the min/max bounds defined in the file
+		// in order to do optimal pruning - we prune based on the [min, max] of the file followed by pruning
+		// based on nan
+		return CheckParquetFloatFilter(reader, pq_col_stats, filter);
+	}
+	return filter.CheckStatistics(stats);
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t i) {
 	auto &group = GetGroup(state);
 	auto col_idx = MultiFileLocalIndex(i);
@@ -1158,29 +1207,14 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t i
 			bool is_generated_column = column_reader.ColumnIndex() >= group.columns.size();
 			bool is_column = column_reader.Schema().schema_type == ParquetColumnSchemaType::COLUMN;
 			bool is_expression = column_reader.Schema().schema_type == ParquetColumnSchemaType::EXPRESSION;
-			bool has_min_max = false;
-			if (!is_generated_column) {
-				has_min_max = group.columns[column_reader.ColumnIndex()].meta_data.statistics.__isset.min_value &&
-				              group.columns[column_reader.ColumnIndex()].meta_data.statistics.__isset.max_value;
-			}
 			if (is_expression) {
 				// no pruning possible for expressions
 				prune_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
-			} else if (!is_generated_column && has_min_max && column_reader.Type().id() == LogicalTypeId::VARCHAR) {
-				// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
-				// however, when reading remote Parquet files, skipping row groups is really important
-				// here, we implement a special case to check the full length for string filters
-				prune_result = CheckParquetStringFilter(
-				    *stats, group.columns[column_reader.ColumnIndex()].meta_data.statistics, filter);
-			} else if (!is_generated_column && has_min_max &&
-			           (column_reader.Type().id() == LogicalTypeId::FLOAT ||
-			            column_reader.Type().id() == LogicalTypeId::DOUBLE) &&
-			           parquet_options.can_have_nan) {
-				// floating point columns can have NaN values in addition to the min/max bounds defined in the file
-				// in order to do optimal pruning - we prune based on the [min, max] of the file followed by pruning
-				// based on nan
-				prune_result = CheckParquetFloatFilter(
-				    column_reader, group.columns[column_reader.ColumnIndex()].meta_data.statistics, filter);
+			} else if (!is_generated_column) {
+				prune_result =
+				    CheckParquetStatistics(column_reader, *stats,
+				                           group.columns[column_reader.ColumnIndex()].meta_data.statistics,
+				                           parquet_options.can_have_nan, filter);
 			} else {
 				prune_result = filter.CheckStatistics(*stats);
 			}
@@ -1205,6 +1239,250 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t i
 	                                  *state.thrift_file_proto);
 }
 
+//! Reads a ColumnIndex or OffsetIndex structure stored at the given location of the file
+static bool ReadPageIndexStructure(TProtocol &protocol, int64_t offset, int32_t length,
+                                   duckdb_apache::thrift::TBase &object) {
+	auto &transport = reinterpret_cast<ThriftFileTransport &>(*protocol.getTransport());
+	if (offset <= 0 || length <= 0 || UnsafeNumericCast<idx_t>(offset + length) > transport.GetSize()) {
+		return false;
+	}
+	transport.SetLocation(UnsafeNumericCast<idx_t>(offset));
+	auto read_head = transport.GetReadHead(UnsafeNumericCast<idx_t>(offset));
+	if (!read_head || UnsafeNumericCast<idx_t>(offset + length) > read_head->GetEnd()) {
+		transport.Prefetch(UnsafeNumericCast<idx_t>(offset), UnsafeNumericCast<idx_t>(length));
+	}
+	object.read(&protocol);
+	return true;
+}
+
+static bool ReadOffsetIndex(TProtocol &protocol, const ColumnChunk &column_chunk,
+                            duckdb_parquet::OffsetIndex &offset_index) {
+	if (!column_chunk.__isset.offset_index_offset || !column_chunk.__isset.offset_index_length) {
+		return false;
+	}
+	return ReadPageIndexStructure(protocol, column_chunk.offset_index_offset, column_chunk.offset_index_length,
+	                              offset_index);
+}
+
+//! Extends [start, end) to the location of a ColumnIndex or OffsetIndex structure
+static void ExtendPageIndexRange(bool is_set, int64_t offset, int32_t length, idx_t &start, idx_t &end) {
+	if (!is_set || offset <= 0 || length <= 0) {
+		return;
+	}
+	start = MinValue<idx_t>(start, UnsafeNumericCast<idx_t>(offset));
+	end = MaxValue<idx_t>(end, UnsafeNumericCast<idx_t>(offset + length));
+}
+
+shared_ptr<const vector<ParquetPageIndex>>
+ParquetReader::GetPageIndexes(ClientContext &context, ParquetReaderScanState &state, idx_t column_idx) {
+	{
+		lock_guard<mutex> guard(metadata->page_index_lock);
+		auto entry = metadata->page_indexes.find(column_idx);
+		if (entry != metadata->page_indexes.end()) {
+			return entry->second;
+		}
+	}
+	// the page indexes are stored away from the column data: read them through their own transport
+	auto index_proto = CreateThriftFileProtocol(QueryContext(context), *state.file_handle, false);
+	auto &transport = reinterpret_cast<ThriftFileTransport &>(*index_proto->getTransport());
+	auto &row_groups = GetFileMetadata()->row_groups;
+
+	// writers store the page indexes of all row groups together: fetch the ones of this column in a single read
+	static constexpr idx_t MAX_PAGE_INDEX_READ = 16ULL * 1024ULL * 1024ULL;
+	idx_t range_start = NumericLimits<idx_t>::Maximum();
+	idx_t range_end = 0;
+	for (auto &row_group : row_groups) {
+		if (column_idx >= row_group.columns.size()) {
+			continue;
+		}
+		auto &column_chunk = row_group.columns[column_idx];
+		ExtendPageIndexRange(column_chunk.__isset.column_index_offset && column_chunk.__isset.column_index_length,
+		                     column_chunk.column_index_offset, column_chunk.column_index_length, range_start,
+		                     range_end);
+		ExtendPageIndexRange(column_chunk.__isset.offset_index_offset && column_chunk.__isset.offset_index_length,
+		                     column_chunk.offset_index_offset, column_chunk.offset_index_length, range_start,
+		                     range_end);
+	}
+	if (range_start < range_end && range_end <= transport.GetSize() && range_end - range_start <= MAX_PAGE_INDEX_READ) {
+		transport.Prefetch(range_start, range_end - range_start);
+	}
+
+	auto result = make_shared_ptr<vector<ParquetPageIndex>>(row_groups.size());
+	for (idx_t group_idx = 0; group_idx < row_groups.size(); group_idx++) {
+		if (column_idx >= row_groups[group_idx].columns.size()) {
+			continue;
+		}
+		auto &column_chunk = row_groups[group_idx].columns[column_idx];
+		auto &page_index = (*result)[group_idx];
+		if (column_chunk.__isset.column_index_offset && column_chunk.__isset.column_index_length) {
+			auto column_index = make_uniq<duckdb_parquet::ColumnIndex>();
+			if (ReadPageIndexStructure(*index_proto, column_chunk.column_index_offset,
+			                           column_chunk.column_index_length, *column_index)) {
+				page_index.column_index = std::move(column_index);
+			}
+		}
+		auto offset_index = make_shared_ptr<duckdb_parquet::OffsetIndex>();
+		if (ReadOffsetIndex(*index_proto, column_chunk, *offset_index)) {
+			page_index.offset_index = std::move(offset_index);
+		}
+	}
+
+	lock_guard<mutex> guard(metadata->page_index_lock);
+	// another thread may have read them in the meantime
+	return metadata->page_indexes.emplace(column_idx, std::move(result)).first->second;
+}
+
+//! Counts the pages that lie entirely within the skipped row ranges
+static idx_t CountSkippedPages(const duckdb_parquet::OffsetIndex &offset_index,
+                               const vector<ParquetRowRange> &skipped_ranges, idx_t group_rows) {
+	auto &pages = offset_index.page_locations;
+	idx_t skipped_count = 0;
+	idx_t range_idx = 0;
+	for (idx_t page_idx = 0; page_idx < pages.size(); page_idx++) {
+		auto page_start = UnsafeNumericCast<idx_t>(pages[page_idx].first_row_index);
+		auto page_end =
+		    page_idx + 1 < pages.size() ? UnsafeNumericCast<idx_t>(pages[page_idx + 1].first_row_index) : group_rows;
+		while (range_idx < skipped_ranges.size() && skipped_ranges[range_idx].end < page_end) {
+			range_idx++;
+		}
+		if (range_idx == skipped_ranges.size()) {
+			break;
+		}
+		if (skipped_ranges[range_idx].start <= page_start) {
+			skipped_count++;
+		}
+	}
+	return skipped_count;
+}
+
+//! Merges two sorted lists of non-overlapping row ranges
+static vector<ParquetRowRange> UnionRowRanges(const vector<ParquetRowRange> &left,
+                                              const vector<ParquetRowRange> &right) {
+	vector<ParquetRowRange> result;
+	idx_t left_idx = 0;
+	idx_t right_idx = 0;
+	while (left_idx < left.size() || right_idx < right.size()) {
+		const ParquetRowRange *next;
+		if (right_idx == right.size() || (left_idx < left.size() && left[left_idx].start < right[right_idx].start)) {
+			next = &left[left_idx++];
+		} else {
+			next = &right[right_idx++];
+		}
+		if (!result.empty() && next->start <= result.back().end) {
+			result.back().end = MaxValue(result.back().end, next->end);
+		} else {
+			result.push_back(*next);
+		}
+	}
+	return result;
+}
+
+void ParquetReader::PreparePageSkipping(ClientContext &context, ParquetReaderScanState &state) {
+	state.skipped_ranges.clear();
+	state.skipped_range_idx = 0;
+	auto &group = GetGroup(state);
+	auto group_rows = UnsafeNumericCast<idx_t>(group.num_rows);
+	if (!filters || parquet_options.encryption_config || state.offset_in_group >= group_rows) {
+		// FIXME: the page indexes of encrypted files are encrypted as well
+		return;
+	}
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	auto group_idx = state.group_idx_list[state.current_group];
+
+	for (auto &entry : filters->filters) {
+		auto &filter = *entry.second;
+		auto col_idx = MultiFileLocalIndex(entry.first);
+		auto column_id = column_ids[col_idx];
+		auto &column_reader = root_reader.GetChildReader(column_id);
+		if (!column_reader.SupportsPageSkipping() || column_reader.ColumnIndex() >= group.columns.size()) {
+			continue;
+		}
+		auto page_indexes = GetPageIndexes(context, state, column_reader.ColumnIndex());
+		auto &page_index = (*page_indexes)[group_idx];
+		if (!page_index.column_index || !page_index.offset_index) {
+			continue;
+		}
+		auto &column_index = *page_index.column_index;
+		auto &pages = page_index.offset_index->page_locations;
+		auto page_count = pages.size();
+		if (page_count == 0 || column_index.null_pages.size() != page_count ||
+		    column_index.min_values.size() != page_count || column_index.max_values.size() != page_count) {
+			continue;
+		}
+		bool has_null_counts = column_index.__isset.null_counts && column_index.null_counts.size() == page_count;
+
+		// evaluate the filter against the min/max/null count of every page
+		vector<ParquetRowRange> column_ranges;
+		for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+			auto page_start = UnsafeNumericCast<idx_t>(pages[page_idx].first_row_index);
+			auto page_end =
+			    page_idx + 1 < page_count ? UnsafeNumericCast<idx_t>(pages[page_idx + 1].first_row_index) : group_rows;
+			if (page_end <= page_start || page_end > group_rows) {
+				// invalid page locations - do not use the page index of this column
+				column_ranges.clear();
+				break;
+			}
+			duckdb_parquet::Statistics page_stats;
+			if (!column_index.null_pages[page_idx]) {
+				auto &min_value = column_index.min_values[page_idx];
+				auto &max_value = column_index.max_values[page_idx];
+				if (column_reader.Type().id() == LogicalTypeId::VARCHAR &&
+				    (Utf8Proc::Analyze(min_value.c_str(), min_value.size()) == UnicodeType::INVALID ||
+				     Utf8Proc::Analyze(max_value.c_str(), max_value.size()) == UnicodeType::INVALID)) {
+					// bounds truncated in the middle of a character
+					continue;
+				}
+				page_stats.__set_min_value(min_value);
+				page_stats.__set_max_value(max_value);
+			}
+			if (has_null_counts) {
+				page_stats.__set_null_count(column_index.null_counts[page_idx]);
+			} else if (column_index.null_pages[page_idx]) {
+				page_stats.__set_null_count(UnsafeNumericCast<int64_t>(page_end - page_start));
+			}
+			auto stats = ParquetStatisticsUtils::TransformColumnStatistics(
+			    column_reader.Schema(), page_stats, page_end - page_start, parquet_options.can_have_nan);
+			if (!stats) {
+				// no statistics for this type
+				break;
+			}
+			auto prune_result =
+			    CheckParquetStatistics(column_reader, *stats, page_stats, parquet_options.can_have_nan, filter);
+			if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				continue;
+			}
+			if (!column_ranges.empty() && column_ranges.back().end == page_start) {
+				column_ranges.back().end = page_end;
+			} else {
+				column_ranges.push_back(ParquetRowRange {page_start, page_end});
+			}
+		}
+		column_reader.SetOffsetIndex(page_index.offset_index);
+		state.skipped_ranges = UnionRowRanges(state.skipped_ranges, column_ranges);
+	}
+	if (state.skipped_ranges.empty()) {
+		return;
+	}
+
+	// the other columns can jump over the pages of the skipped rows as well
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		auto column_id = column_ids[MultiFileLocalIndex(i)];
+		auto &column_reader = root_reader.GetChildReader(column_id);
+		if (!column_reader.SupportsPageSkipping() || column_reader.ColumnIndex() >= group.columns.size()) {
+			continue;
+		}
+		if (!column_reader.GetOffsetIndex()) {
+			auto page_indexes = GetPageIndexes(context, state, column_reader.ColumnIndex());
+			auto &offset_index = (*page_indexes)[group_idx].offset_index;
+			if (!offset_index) {
+				continue;
+			}
+			column_reader.SetOffsetIndex(offset_index);
+		}
+		state.pages_skipped += CountSkippedPages(*column_reader.GetOffsetIndex(), state.skipped_ranges, group_rows);
+	}
+}
+
 idx_t ParquetReader::NumRows() const {
 	return GetFileMetadata()->num_rows;
 }
@@ -1213,6 +1491,39 @@ idx_t ParquetReader::NumRowGroups() const {
 	return GetFileMetadata()->row_groups.size();
 }
 
+vector<idx_t> ParquetReader::GetRowGroupScanOrder(OrderType order_type) {
+	vector<idx_t> result;
+	if (!scan_order_column.IsValid()) {
+		return result;
+	}
+	auto column_id = scan_order_column.GetIndex();
+	if (column_id >= root_schema->children.size() || expression_map.find(column_id) != expression_map.end()) {
+		return result;
+	}
+	auto &schema = root_schema->children[column_id];
+	if (schema.schema_type != ParquetColumnSchemaType::COLUMN) {
+		return result;
+	}
+	auto &file_meta_data = *GetFileMetadata();
+	vector<pair<Value, idx_t>> row_group_boundaries;
+	for (idx_t row_group_idx = 0; row_group_idx < file_meta_data.row_groups.size(); row_group_idx++) {
+		auto &row_group = file_meta_data.row_groups[row_group_idx];
+		if (schema.column_index >= row_group.columns.size()) {
+			return result;
+		}
+		auto stats = schema.Stats(file_meta_data, parquet_options, row_group_idx, row_group.columns);
+		row_group_boundaries.emplace_back(stats ? stats->GetOrderBoundary(order_type) : Value(), row_group_idx);
+	}
+	std::stable_sort(row_group_boundaries.begin(), row_group_boundaries.end(),
+	                 [&](const pair<Value, idx_t> &a, const pair<Value, idx_t> &b) {
+		                 return BaseStatistics::OrderBoundaryPrecedes(a.first, b.first, order_type);
+	                 });
+	for (auto &entry : row_group_boundaries) {
+		result.push_back(entry.second);
+	}
+	return result;
+}
+
 ParquetScanFilter::ParquetScanFilter(ClientContext &context, idx_t filter_idx, TableFilter &filter)
     : filter_idx(filter_idx), filter(filter) {
 	filter_state = TableFilterState::Initialize(context, filter);
@@ -1314,6 +1625,7 @@ bool ParquetReader::ScanInternal(ClientContext &context, ParquetReaderScanState
 			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx).TotalCompressedSize();
 		}
+		PreparePageSkipping(context, state);
 
 		auto &group = GetGroup(state);
 		if (state.op) {
@@ -1355,12 +1667,17 @@ bool ParquetReader::ScanInternal(ClientContext &context, ParquetReaderScanState
 					auto file_col_idx = column_ids[col_idx];
 					auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 
+					auto &child_reader = root_reader.GetChildReader(file_col_idx);
+					if (!state.skipped_ranges.empty() && child_reader.GetOffsetIndex()) {
+						// pages are fetched when they are read, so that the skipped pages are never fetched
+						continue;
+					}
 					bool has_filter = false;
 					if (filters) {
 						auto entry = filters->filters.find(col_idx);
 						has_filter = entry != filters->filters.end();
 					}
-					root_reader.GetChildReader(file_col_idx).RegisterPrefetch(trans, !(lazy_fetch && !has_filter));
+					child_reader.RegisterPrefetch(trans, !(lazy_fetch && !has_filter));
 				}
 
 				trans.FinalizeRegistration();
@@ -1373,7 +1690,26 @@ bool ParquetReader::ScanInternal(ClientContext &context, ParquetReaderScanState
 		return true;
 	}
 
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+
 	auto scan_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.offset_in_group);
+	if (state.skipped_range_idx < state.skipped_ranges.size()) {
+		auto &skipped_range = state.skipped_ranges[state.skipped_range_idx];
+		if (state.offset_in_group >= skipped_range.start) {
+			// the page indexes rule out these rows: skip them in every column without emitting anything
+			auto skip_count = skipped_range.end - state.offset_in_group;
+			for (idx_t i = 0; i < column_ids.size(); i++) {
+				auto file_col_idx = column_ids[MultiFileLocalIndex(i)];
+				root_reader.GetChildReader(file_col_idx).Skip(skip_count);
+			}
+			state.skipped_range_idx++;
+			rows_read += skip_count;
+			state.offset_in_group += skip_count;
+			return true;
+		}
+		// do not scan into the skipped rows
+		scan_count = MinValue<idx_t>(scan_count, skipped_range.start - state.offset_in_group);
+	}
 	result.SetCardinality(scan_count);
 
 	if (scan_count == 0) {
@@ -1389,8 +1725,6 @@ bool ParquetReader::ScanInternal(ClientContext &context, ParquetReaderScanState
 	auto define_ptr = (uint8_t *)state.define_buf.ptr;
 	auto repeat_ptr = (uint8_t *)state.repeat_buf.ptr;
 
-	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
-
 	if (filters || deletion_filter) {
 		idx_t filter_count = result.size();
 		D_ASSERT(filter_count == scan_count);
@@ -359,8 +359,16 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
+	return TransformColumnStatistics(schema, column_chunk.meta_data.statistics,
+	                                 UnsafeNumericCast<idx_t>(column_chunk.meta_data.num_values), can_have_nan);
+}
 
+unique_ptr<BaseStatistics>
+ParquetStatisticsUtils::TransformColumnStatistics(const ParquetColumnSchema &schema,
+                                                  const duckdb_parquet::Statistics &parquet_stats, idx_t num_values,
+                                                  bool can_have_nan) {
+	auto &type = schema.type;
+	unique_ptr<BaseStatistics> row_group_stats;
 	switch (type.id()) {
 	case LogicalTypeId::UTINYINT:
 	case LogicalTypeId::USMALLINT:
@@ -424,7 +432,7 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		if (parquet_stats.__isset.null_count && parquet_stats.null_count == 0) {
 			row_group_stats->Set(StatsInfo::CANNOT_HAVE_NULL_VALUES);
 		}
-		if (parquet_stats.__isset.null_count && parquet_stats.null_count == column_chunk.meta_data.num_values) {
+		if (parquet_stats.__isset.null_count && UnsafeNumericCast<idx_t>(parquet_stats.null_count) == num_values) {
 			row_group_stats->Set(StatsInfo::CANNOT_HAVE_VALID_VALUES);
 		}
 	}
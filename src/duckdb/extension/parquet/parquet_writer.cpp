@@ -11,6 +11,8 @@
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/write_stream.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/string_heap.hpp"
+#include "duckdb/function/create_sort_key.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
@@ -18,6 +20,8 @@
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/common/types/blob.hpp"
 
+#include <numeric>
+
 namespace duckdb {
 
 using namespace duckdb_apache::thrift;            // NOLINT
@@ -358,7 +362,7 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
                              optional_idx dictionary_size_limit_p, idx_t string_dictionary_page_size_limit_p,
                              bool enable_bloom_filters_p, double bloom_filter_false_positive_ratio_p,
                              int64_t compression_level_p, bool debug_use_openssl_p, ParquetVersion parquet_version,
-                             GeoParquetVersion geoparquet_version)
+                             GeoParquetVersion geoparquet_version, bool write_page_index_p, vector<idx_t> cluster_by_p)
     : context(context), file_name(std::move(file_name_p)), sql_types(std::move(types_p)),
       column_names(std::move(names_p)), codec(codec), field_ids(std::move(field_ids_p)),
       encryption_config(std::move(encryption_config_p)), dictionary_size_limit(dictionary_size_limit_p),
@@ -366,7 +370,7 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
       enable_bloom_filters(enable_bloom_filters_p),
       bloom_filter_false_positive_ratio(bloom_filter_false_positive_ratio_p), compression_level(compression_level_p),
       debug_use_openssl(debug_use_openssl_p), parquet_version(parquet_version), geoparquet_version(geoparquet_version),
-      total_written(0), num_row_groups(0) {
+      write_page_index(write_page_index_p), cluster_by(std::move(cluster_by_p)), total_written(0), num_row_groups(0) {
 
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
@@ -439,10 +443,59 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
 ParquetWriter::~ParquetWriter() {
 }
 
-void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result) {
+unique_ptr<ColumnDataCollection> ParquetWriter::ClusterRowGroup(ColumnDataCollection &buffer) {
+	auto &allocator = Allocator::Get(context);
+	const auto count = buffer.Count();
+
+	// compute the sort keys of the rows, these compare with memcmp
+	vector<OrderModifiers> modifiers(cluster_by.size(),
+	                                 OrderModifiers(OrderType::ASCENDING, OrderByNullType::NULLS_LAST));
+	StringHeap key_heap(allocator);
+	vector<string_t> keys;
+	keys.reserve(count);
+	for (auto &chunk : buffer.Chunks(cluster_by)) {
+		Vector key_vector(LogicalType::BLOB, chunk.size());
+		CreateSortKeyHelpers::CreateSortKey(chunk, modifiers, key_vector);
+		key_vector.Flatten(chunk.size());
+		auto key_data = FlatVector::GetData<string_t>(key_vector);
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			keys.push_back(key_heap.AddBlob(key_data[i]));
+		}
+	}
+	vector<sel_t> order(count);
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&](sel_t lhs, sel_t rhs) { return keys[lhs] < keys[rhs]; });
+
+	// gather the rows into a single chunk so we can slice them in sorted order
+	DataChunk rows;
+	rows.Initialize(allocator, buffer.Types(), count);
+	for (auto &chunk : buffer.Chunks()) {
+		rows.Append(chunk);
+	}
+	auto result = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), buffer.Types());
+	ColumnDataAppendState append_state;
+	result->InitializeAppend(append_state);
+	for (idx_t offset = 0; offset < count; offset += STANDARD_VECTOR_SIZE) {
+		const auto next = MinValue<idx_t>(count - offset, STANDARD_VECTOR_SIZE);
+		SelectionVector sel(order.data() + offset);
+		DataChunk sorted;
+		sorted.InitializeEmpty(buffer.Types());
+		sorted.Slice(rows, sel, next);
+		result->Append(append_state, sorted);
+	}
+	return result;
+}
+
+void ParquetWriter::PrepareRowGroup(ColumnDataCollection &input, PreparedRowGroup &result) {
 	// We write 8 columns at a time so that iterating over ColumnDataCollection is more efficient
 	static constexpr idx_t COLUMNS_PER_PASS = 8;
 
+	unique_ptr<ColumnDataCollection> clustered;
+	if (!cluster_by.empty() && input.Count() > 1) {
+		clustered = ClusterRowGroup(input);
+	}
+	auto &buffer = clustered ? *clustered : input;
+
 	// We want these to be buffer-managed
 	D_ASSERT(buffer.GetAllocatorType() == ColumnDataAllocatorType::BUFFER_MANAGER_ALLOCATOR);
 
@@ -939,8 +992,29 @@ void ParquetWriter::GatherWrittenStatistics() {
 	}
 }
 
+void ParquetWriter::WritePageIndexes() {
+	// all column indexes go first, then all offset indexes
+	for (auto &entry : page_indexes) {
+		if (!entry.column_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[entry.row_group_idx].columns[entry.column_idx];
+		column_chunk.__set_column_index_offset(NumericCast<int64_t>(writer->GetTotalWritten()));
+		column_chunk.__set_column_index_length(NumericCast<int32_t>(Write(*entry.column_index)));
+	}
+	for (auto &entry : page_indexes) {
+		auto &column_chunk = file_meta_data.row_groups[entry.row_group_idx].columns[entry.column_idx];
+		column_chunk.__set_offset_index_offset(NumericCast<int64_t>(writer->GetTotalWritten()));
+		column_chunk.__set_offset_index_length(NumericCast<int32_t>(Write(*entry.offset_index)));
+	}
+	page_indexes.clear();
+}
+
 void ParquetWriter::Finalize() {
 
+	// the page indexes are written after the last row group, not if stuff is encrypted
+	WritePageIndexes();
+
 	// dump the bloom filters right before footer, not if stuff is encrypted
 
 	for (auto &bloom_filter_entry : bloom_filters) {
@@ -1028,6 +1102,19 @@ void ParquetWriter::BufferBloomFilter(idx_t col_idx, unique_ptr<ParquetBloomFilt
 	bloom_filters.push_back(std::move(new_entry));
 }
 
+void ParquetWriter::BufferPageIndex(idx_t col_idx, unique_ptr<duckdb_parquet::ColumnIndex> column_index,
+                                    unique_ptr<duckdb_parquet::OffsetIndex> offset_index) {
+	if (encryption_config) {
+		return;
+	}
+	ParquetPageIndexEntry new_entry;
+	new_entry.column_index = std::move(column_index);
+	new_entry.offset_index = std::move(offset_index);
+	new_entry.column_idx = col_idx;
+	new_entry.row_group_idx = file_meta_data.row_groups.size();
+	page_indexes.push_back(std::move(new_entry));
+}
+
 void ParquetWriter::SetWrittenStatistics(CopyFunctionFileStatistics &written_stats_p) {
 	written_stats = written_stats_p;
 	stats_accumulator = make_uniq<ParquetStatsAccumulator>();
@@ -50,17 +50,26 @@ void PrimitiveColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterStat
 	idx_t vector_index = 0;
 	reference<PageInformation> page_info_ref = state.page_info.back();
 	col_chunk.meta_data.num_values += NumericCast<int64_t>(vcount);
+	const auto max_page_rows = WritesPageIndex() ? MAX_PAGE_INDEX_PAGE_ROWS : NumericLimits<idx_t>::Maximum();
 
 	const bool check_parent_empty = parent && !parent->is_empty.empty();
 	if (!check_parent_empty && validity.AllValid() && TypeIsConstantSize(vector.GetType().InternalType()) &&
 	    page_info_ref.get().estimated_page_size + GetRowSize(vector, vector_index, state) * vcount <
-	        MAX_UNCOMPRESSED_PAGE_SIZE) {
+	        MAX_UNCOMPRESSED_PAGE_SIZE &&
+	    page_info_ref.get().row_count + vcount <= max_page_rows) {
 		// Fast path: fixed-size type, all valid, and it fits on the current page
 		auto &page_info = page_info_ref.get();
 		page_info.row_count += vcount;
 		page_info.estimated_page_size += GetRowSize(vector, vector_index, state) * vcount;
 	} else {
 		for (idx_t i = 0; i < vcount; i++) {
+			if (page_info_ref.get().row_count >= max_page_rows) {
+				// the page is full - start a new one
+				PageInformation new_info;
+				new_info.offset = page_info_ref.get().offset + page_info_ref.get().row_count;
+				state.page_info.push_back(new_info);
+				page_info_ref = state.page_info.back();
+			}
 			auto &page_info = page_info_ref.get();
 			page_info.row_count++;
 			if (check_parent_empty && parent->is_empty[parent_index + i]) {
@@ -96,6 +105,7 @@ void PrimitiveColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	const auto write_page_index = WritesPageIndex();
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -125,6 +135,9 @@ void PrimitiveColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
+		if (write_page_index) {
+			write_info.page_stats = InitializeStatsState();
+		}
 
 		state.write_info.push_back(std::move(write_info));
 	}
@@ -246,6 +259,9 @@ void PrimitiveColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, id
 
 		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
 		            offset + write_count);
+		if (write_info.page_stats) {
+			UpdatePageStatistics(*write_info.page_stats, vector, offset, offset + write_count);
+		}
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -334,6 +350,35 @@ void PrimitiveColumnWriter::SetParquetStatistics(PrimitiveColumnWriterState &sta
 	}
 }
 
+bool PrimitiveColumnWriter::WritesPageIndex() const {
+	return writer.WritePageIndex() && MaxRepeat() == 0 && MaxDefine() <= 1;
+}
+
+unique_ptr<duckdb_parquet::ColumnIndex> PrimitiveColumnWriter::CreateColumnIndex(PrimitiveColumnWriterState &state) {
+	auto column_index = make_uniq<duckdb_parquet::ColumnIndex>();
+	idx_t page_idx = 0;
+	for (auto &write_info : state.write_info) {
+		if (write_info.page_header.type == PageType::DICTIONARY_PAGE) {
+			continue;
+		}
+		D_ASSERT(write_info.page_stats);
+		auto &page_info = state.page_info[page_idx++];
+		auto &page_stats = *write_info.page_stats;
+		const auto null_page = page_info.null_count == page_info.row_count;
+		if (!null_page && (!page_stats.HasStats() || page_stats.HasNaN())) {
+			// a page without bounds cannot be described by the column index
+			return nullptr;
+		}
+		column_index->null_pages.push_back(null_page);
+		column_index->min_values.push_back(null_page ? string() : page_stats.GetMinValue());
+		column_index->max_values.push_back(null_page ? string() : page_stats.GetMaxValue());
+		column_index->null_counts.push_back(NumericCast<int64_t>(page_info.null_count));
+	}
+	column_index->boundary_order = duckdb_parquet::BoundaryOrder::UNORDERED;
+	column_index->__isset.null_counts = true;
+	return column_index;
+}
+
 void PrimitiveColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<PrimitiveColumnWriterState>();
 	auto &column_chunk = state.row_group.columns[state.col_idx];
@@ -358,6 +403,10 @@ void PrimitiveColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	unique_ptr<duckdb_parquet::OffsetIndex> offset_index;
+	if (WritesPageIndex()) {
+		offset_index = make_uniq<duckdb_parquet::OffsetIndex>();
+	}
 	for (auto &write_info : state.write_info) {
 		// set the data page offset whenever we see the *first* data page
 		if (column_chunk.meta_data.data_page_offset == 0 && (write_info.page_header.type == PageType::DATA_PAGE ||
@@ -371,6 +420,16 @@ void PrimitiveColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+		if (offset_index && write_info.page_header.type != PageType::DICTIONARY_PAGE) {
+			// the page locations include the page header
+			auto &page_info = state.page_info[offset_index->page_locations.size()];
+			duckdb_parquet::PageLocation page_location;
+			page_location.offset = UnsafeNumericCast<int64_t>(header_start_offset);
+			page_location.compressed_page_size =
+			    UnsafeNumericCast<int32_t>(column_writer.GetTotalWritten() - header_start_offset);
+			page_location.first_row_index = UnsafeNumericCast<int64_t>(page_info.offset);
+			offset_index->page_locations.push_back(page_location);
+		}
 	}
 	column_chunk.meta_data.total_compressed_size =
 	    UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten() - start_offset);
@@ -380,6 +439,9 @@ void PrimitiveColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	if (state.bloom_filter) {
 		writer.BufferBloomFilter(state.col_idx, std::move(state.bloom_filter));
 	}
+	if (offset_index) {
+		writer.BufferPageIndex(state.col_idx, CreateColumnIndex(state), std::move(offset_index));
+	}
 
 	// finalize the stats
 	writer.FlushColumnStats(state.col_idx, column_chunk, state.stats_state.get());
@@ -16,6 +16,7 @@
 #include "duckdb/common/enums/access_mode.hpp"
 #include "duckdb/common/enums/aggregate_handling.hpp"
 #include "duckdb/common/enums/arrow_format_version.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/catalog_lookup_behavior.hpp"
 #include "duckdb/common/enums/catalog_type.hpp"
 #include "duckdb/common/enums/checkpoint_abort.hpp"
@@ -63,6 +64,7 @@
 #include "duckdb/common/enums/stream_execution_result.hpp"
 #include "duckdb/common/enums/subquery_type.hpp"
 #include "duckdb/common/enums/tableref_type.hpp"
+#include "duckdb/common/enums/task_priority.hpp"
 #include "duckdb/common/enums/thread_pin_mode.hpp"
 #include "duckdb/common/enums/tuple_data_layout_enums.hpp"
 #include "duckdb/common/enums/undo_flags.hpp"
@@ -707,6 +709,24 @@ BlockState EnumUtil::FromString<BlockState>(const char *value) {
 	return static_cast<BlockState>(StringUtil::StringToEnum(GetBlockStateValues(), 2, "BlockState", value));
 }
 
+const StringUtil::EnumStringLiteral *GetBufferEvictionPolicyValues() {
+	static constexpr StringUtil::EnumStringLiteral values[] {
+		{ static_cast<uint32_t>(BufferEvictionPolicy::LRU), "LRU" },
+		{ static_cast<uint32_t>(BufferEvictionPolicy::TWO_QUEUE), "TWO_QUEUE" }
+	};
+	return values;
+}
+
+template<>
+const char* EnumUtil::ToChars<BufferEvictionPolicy>(BufferEvictionPolicy value) {
+	return StringUtil::EnumToString(GetBufferEvictionPolicyValues(), 2, "BufferEvictionPolicy", static_cast<uint32_t>(value));
+}
+
+template<>
+BufferEvictionPolicy EnumUtil::FromString<BufferEvictionPolicy>(const char *value) {
+	return static_cast<BufferEvictionPolicy>(StringUtil::StringToEnum(GetBufferEvictionPolicyValues(), 2, "BufferEvictionPolicy", value));
+}
+
 const StringUtil::EnumStringLiteral *GetCAPIResultSetTypeValues() {
 	static constexpr StringUtil::EnumStringLiteral values[] {
 		{ static_cast<uint32_t>(CAPIResultSetType::CAPI_RESULT_TYPE_NONE), "CAPI_RESULT_TYPE_NONE" },
@@ -4361,19 +4381,20 @@ const StringUtil::EnumStringLiteral *GetTableFilterTypeValues() {
 		{ static_cast<uint32_t>(TableFilterType::OPTIONAL_FILTER), "OPTIONAL_FILTER" },
 		{ static_cast<uint32_t>(TableFilterType::IN_FILTER), "IN_FILTER" },
 		{ static_cast<uint32_t>(TableFilterType::DYNAMIC_FILTER), "DYNAMIC_FILTER" },
-		{ static_cast<uint32_t>(TableFilterType::EXPRESSION_FILTER), "EXPRESSION_FILTER" }
+		{ static_cast<uint32_t>(TableFilterType::EXPRESSION_FILTER), "EXPRESSION_FILTER" },
+		{ static_cast<uint32_t>(TableFilterType::BLOOM_FILTER), "BLOOM_FILTER" }
 	};
 	return values;
 }
 
 template<>
 const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
-	return StringUtil::EnumToString(GetTableFilterTypeValues(), 10, "TableFilterType", static_cast<uint32_t>(value));
+	return StringUtil::EnumToString(GetTableFilterTypeValues(), 11, "TableFilterType", static_cast<uint32_t>(value));
 }
 
 template<>
 TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
-	return static_cast<TableFilterType>(StringUtil::StringToEnum(GetTableFilterTypeValues(), 10, "TableFilterType", value));
+	return static_cast<TableFilterType>(StringUtil::StringToEnum(GetTableFilterTypeValues(), 11, "TableFilterType", value));
 }
 
 const StringUtil::EnumStringLiteral *GetTablePartitionInfoValues() {
@@ -4484,6 +4505,25 @@ TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value)
 	return static_cast<TaskExecutionResult>(StringUtil::StringToEnum(GetTaskExecutionResultValues(), 4, "TaskExecutionResult", value));
 }
 
+const StringUtil::EnumStringLiteral *GetTaskPriorityValues() {
+	static constexpr StringUtil::EnumStringLiteral values[] {
+		{ static_cast<uint32_t>(TaskPriority::HIGH), "HIGH" },
+		{ static_cast<uint32_t>(TaskPriority::NORMAL), "NORMAL" },
+		{ static_cast<uint32_t>(TaskPriority::LOW), "LOW" }
+	};
+	return values;
+}
+
+template<>
+const char* EnumUtil::ToChars<TaskPriority>(TaskPriority value) {
+	return StringUtil::EnumToString(GetTaskPriorityValues(), 3, "TaskPriority", static_cast<uint32_t>(value));
+}
+
+template<>
+TaskPriority EnumUtil::FromString<TaskPriority>(const char *value) {
+	return static_cast<TaskPriority>(StringUtil::StringToEnum(GetTaskPriorityValues(), 3, "TaskPriority", value));
+}
+
 const StringUtil::EnumStringLiteral *GetTemporaryBufferSizeValues() {
 	static constexpr StringUtil::EnumStringLiteral values[] {
 		{ static_cast<uint32_t>(TemporaryBufferSize::INVALID), "INVALID" },
@@ -866,6 +866,10 @@ bool MultiFileColumnMapper::EvaluateFilterAgainstConstant(TableFilter &filter, c
 		auto &expr_filter = filter.Cast<ExpressionFilter>();
 		return expr_filter.EvaluateWithConstant(context, constant);
 	}
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		return bloom_filter.Lookup(constant);
+	}
 	default:
 		throw NotImplementedException("Can't evaluate TableFilterType (%s) against a constant",
 		                              EnumUtil::ToString(type));
@@ -1024,6 +1028,14 @@ static unique_ptr<TableFilter> TryCastTableFilter(const TableFilter &global_filt
 	case TableFilterType::EXPRESSION_FILTER:
 		// unsupported
 		return nullptr;
+	case TableFilterType::BLOOM_FILTER: {
+		// the hashes of a different type do not match - only push the filter if the file has the same type
+		auto &bloom_filter = global_filter.Cast<BloomFilter>();
+		if (bloom_filter.key_type != target_type) {
+			return nullptr;
+		}
+		return global_filter.Copy();
+	}
 	default:
 		throw NotImplementedException("Can't convert TableFilterType (%s) from global to local indexes",
 		                              EnumUtil::ToString(type));
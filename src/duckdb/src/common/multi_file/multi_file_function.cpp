@@ -37,6 +37,10 @@ void MultiFileReaderInterface::GetVirtualColumns(ClientContext &context, MultiFi
                                                  virtual_column_map_t &result) {
 }
 
+void MultiFileReaderInterface::DynamicToString(const GlobalTableFunctionState &global_state,
+                                               InsertionOrderPreservingMap<string> &result) {
+}
+
 void MultiFileReaderInterface::FinishReading(ClientContext &context, GlobalTableFunctionState &global_state,
                                              LocalTableFunctionState &local_state) {
 }
@@ -17,6 +17,7 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/optional_filter.hpp"
@@ -746,6 +747,23 @@ void JoinFilterPushdownInfo::PushInFilter(const JoinFilterPushdownFilter &info,
 	return;
 }
 
+shared_ptr<BlockedBloomFilter> JoinFilterPushdownInfo::BuildBloomFilter(JoinHashTable &ht, idx_t filter_idx) const {
+	// hash the build keys chunk by chunk, with the same hash function the scans use to probe the filter
+	auto &data_collection = ht.GetDataCollection();
+	TupleDataScanState scan_state;
+	data_collection.InitializeScan(scan_state, {join_condition[filter_idx]});
+	DataChunk keys;
+	data_collection.InitializeScanChunk(scan_state, keys);
+	Vector hashes(LogicalType::HASH);
+
+	auto bloom_filter = make_shared_ptr<BlockedBloomFilter>(ht.Count());
+	while (data_collection.Scan(scan_state, keys)) {
+		VectorOperations::Hash(keys.data[0], hashes, keys.size());
+		bloom_filter->Insert(hashes, keys.size());
+	}
+	return bloom_filter;
+}
+
 unique_ptr<DataChunk> JoinFilterPushdownInfo::Finalize(ClientContext &context, optional_ptr<JoinHashTable> ht,
                                                        JoinFilterGlobalState &gstate,
                                                        const PhysicalComparisonJoin &op) const {
@@ -764,9 +782,12 @@ unique_ptr<DataChunk> JoinFilterPushdownInfo::Finalize(ClientContext &context, o
 	}
 
 	auto dynamic_or_filter_threshold = DBConfig::GetSetting<DynamicOrFilterThresholdSetting>(context);
+	auto dynamic_bloom_filter_threshold = DBConfig::GetSetting<DynamicBloomFilterThresholdSetting>(context);
 	// create a filter for each of the aggregates
 	for (idx_t filter_idx = 0; filter_idx < join_condition.size(); filter_idx++) {
 		const auto cmp = op.conditions[join_condition[filter_idx]].comparison;
+		// the Bloom filter is built once per join condition and shared by all the scans it is pushed into
+		shared_ptr<BlockedBloomFilter> bloom_filter;
 		for (auto &info : probe_info) {
 			auto filter_col_idx = info.columns[filter_idx].probe_column_index.column_index;
 			auto min_idx = filter_idx * 2;
@@ -786,6 +807,15 @@ unique_ptr<DataChunk> JoinFilterPushdownInfo::Finalize(ClientContext &context, o
 			    cmp == ExpressionType::COMPARE_EQUAL) {
 				PushInFilter(info, *ht, op, filter_idx, filter_col_idx);
 			}
+			// if the HT is too large for that, a Bloom filter still removes most probe tuples without a partner
+			auto &key_type = final_min_max->data[min_idx].GetType();
+			if (ht && ht->Count() > dynamic_or_filter_threshold && ht->Count() <= dynamic_bloom_filter_threshold &&
+			    cmp == ExpressionType::COMPARE_EQUAL && BloomFilter::SupportsType(key_type)) {
+				if (!bloom_filter) {
+					bloom_filter = BuildBloomFilter(*ht, filter_idx);
+				}
+				info.dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<BloomFilter>(bloom_filter, key_type));
+			}
 
 			if (Value::NotDistinctFrom(min_val, max_val)) {
 				// min = max - single value
@@ -33,6 +33,8 @@ public:
 			auto filters = table_filters ? *table_filters : GetTableFilters(op);
 			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, filters,
 			                             op.extra_info.sample_options, &op);
+			input.scan_order_column = op.extra_info.scan_order_column;
+			input.scan_order_type = op.extra_info.scan_order_type;
 
 			global_state = op.function.init_global(context, input);
 			if (global_state) {
@@ -0,0 +1,73 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBBufferPoolData : public GlobalTableFunctionState {
+	DuckDBBufferPoolData() : finished(false) {
+	}
+
+	BufferEvictionPolicy policy;
+	BufferPoolStatistics statistics;
+	bool finished;
+};
+
+static unique_ptr<FunctionData> DuckDBBufferPoolBind(ClientContext &context, TableFunctionBindInput &input,
+                                                     vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("eviction_policy");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("evictions");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("hit_ratio");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBBufferPoolInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBBufferPoolData>();
+	auto &buffer_pool = BufferManager::GetBufferManager(context).GetBufferPool();
+	result->policy = buffer_pool.GetEvictionPolicy();
+	result->statistics = buffer_pool.GetStatistics();
+	return std::move(result);
+}
+
+void DuckDBBufferPoolFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBBufferPoolData>();
+	if (data.finished) {
+		// finished returning values
+		return;
+	}
+	auto &stats = data.statistics;
+	auto pins = stats.hits + stats.misses;
+	idx_t col = 0;
+	// eviction_policy, VARCHAR
+	output.SetValue(col++, 0, StringUtil::Lower(EnumUtil::ToString(data.policy)));
+	// hits, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(stats.hits));
+	// misses, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(stats.misses));
+	// evictions, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(stats.evictions));
+	// hit_ratio, DOUBLE
+	output.SetValue(col++, 0,
+	                pins == 0 ? Value(LogicalType::DOUBLE) : Value::DOUBLE(double(stats.hits) / double(pins)));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void DuckDBBufferPoolFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_buffer_pool", {}, DuckDBBufferPoolFunction, DuckDBBufferPoolBind, DuckDBBufferPoolInit));
+}
+
+} // namespace duckdb
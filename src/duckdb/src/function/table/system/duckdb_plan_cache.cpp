@@ -0,0 +1,64 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/plan_cache.hpp"
+
+namespace duckdb {
+
+struct DuckDBPlanCacheData : public GlobalTableFunctionState {
+	DuckDBPlanCacheData() : finished(false) {
+	}
+
+	PlanCacheStatistics statistics;
+	bool finished;
+};
+
+static unique_ptr<FunctionData> DuckDBPlanCacheBind(ClientContext &context, TableFunctionBindInput &input,
+                                                    vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("entries");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("hit_ratio");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBPlanCacheInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBPlanCacheData>();
+	result->statistics = PlanCache::Get(context).GetStatistics();
+	return std::move(result);
+}
+
+void DuckDBPlanCacheFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBPlanCacheData>();
+	if (data.finished) {
+		// finished returning values
+		return;
+	}
+	auto &stats = data.statistics;
+	auto lookups = stats.hits + stats.misses;
+	idx_t col = 0;
+	// hits, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(stats.hits));
+	// misses, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(stats.misses));
+	// entries, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(stats.entries));
+	// hit_ratio, DOUBLE
+	output.SetValue(col++, 0,
+	                lookups == 0 ? Value(LogicalType::DOUBLE) : Value::DOUBLE(double(stats.hits) / double(lookups)));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void DuckDBPlanCacheFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_plan_cache", {}, DuckDBPlanCacheFunction, DuckDBPlanCacheBind, DuckDBPlanCacheInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,70 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/query_result_cache.hpp"
+
+namespace duckdb {
+
+struct DuckDBQueryResultCacheData : public GlobalTableFunctionState {
+	DuckDBQueryResultCacheData() : finished(false) {
+	}
+
+	QueryResultCacheStatistics statistics;
+	bool finished;
+};
+
+static unique_ptr<FunctionData> DuckDBQueryResultCacheBind(ClientContext &context, TableFunctionBindInput &input,
+                                                           vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("entries");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("cached_rows");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("hit_ratio");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBQueryResultCacheInit(ClientContext &context,
+                                                                TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBQueryResultCacheData>();
+	result->statistics = QueryResultCache::Get(context).GetStatistics();
+	return std::move(result);
+}
+
+void DuckDBQueryResultCacheFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBQueryResultCacheData>();
+	if (data.finished) {
+		// finished returning values
+		return;
+	}
+	auto &stats = data.statistics;
+	auto lookups = stats.hits + stats.misses;
+	idx_t col = 0;
+	// hits, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(stats.hits));
+	// misses, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(stats.misses));
+	// entries, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(stats.entries));
+	// cached_rows, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(stats.cached_rows));
+	// hit_ratio, DOUBLE
+	output.SetValue(col++, 0,
+	                lookups == 0 ? Value(LogicalType::DOUBLE) : Value::DOUBLE(double(stats.hits) / double(lookups)));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void DuckDBQueryResultCacheFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_query_result_cache", {}, DuckDBQueryResultCacheFunction,
+	                              DuckDBQueryResultCacheBind, DuckDBQueryResultCacheInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,581 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/parser/expression/columnref_expression.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
+#include "duckdb/parser/expression/function_expression.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+#include "duckdb/parser/parser.hpp"
+#include "duckdb/parser/qualified_name.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/parser/tableref/basetableref.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
+
+namespace duckdb {
+
+// A materialized view keeps the partial aggregates of its query per group in a state table, and a view computes the
+// final aggregates from these states. The base table has to be append-only: rows are appended in commit order, so the
+// row ids below the watermark of the view are exactly the rows that have been aggregated into the states. A refresh
+// aggregates the rows appended since, merges them into the states and advances the watermark. The registry stores the
+// commit id of the last delete or update of the base table, so that a refresh fails once rows have been deleted or
+// updated without scanning the rows below the watermark. Commit ids start over when the database is restarted: the
+// first refresh after a restart counts the rows below the watermark instead, which detects deletes only.
+
+//! The registry of the materialized views of a schema: the definition and the watermark of every view
+static constexpr const char *MATERIALIZED_VIEW_REGISTRY = "__materialized_views";
+static constexpr const char *MATERIALIZED_VIEW_STATE_PREFIX = "__mv_";
+//! The temporary table holding the partial aggregates of the rows appended since the last refresh
+static constexpr const char *MATERIALIZED_VIEW_DELTA = "__mv_delta";
+
+struct MaterializedViewNames {
+	string catalog;
+	string schema;
+	//! The unqualified name of the view, as stored in the registry
+	string name;
+	string view;
+	string state;
+	string registry;
+};
+
+struct MaterializedViewDefinition {
+	//! The base table, qualified
+	string base_table;
+	QualifiedName base_table_name;
+	//! The WHERE clause of the definition (if any)
+	string filter;
+	//! The GROUP BY expressions, stored in the columns g0, g1, ... of the state table
+	vector<string> groups;
+	//! The partial aggregates, stored in the columns s0, s1, ... of the state table
+	vector<string> states;
+	//! The aggregates merging two partial aggregates (sum, min or max)
+	vector<string> merge_functions;
+	//! The columns of the view, computed from the state table
+	vector<string> columns;
+};
+
+static MaterializedViewNames GetMaterializedViewNames(ClientContext &context, const string &input) {
+	auto qualified = QualifiedName::Parse(input);
+	if (qualified.catalog.empty()) {
+		qualified.catalog = DatabaseManager::GetDefaultDatabase(context);
+	}
+	if (qualified.schema.empty()) {
+		qualified.schema = ClientData::Get(context).catalog_search_path->GetDefault().schema;
+	}
+	auto prefix = KeywordHelper::WriteOptionallyQuoted(qualified.catalog) + "." +
+	              KeywordHelper::WriteOptionallyQuoted(qualified.schema) + ".";
+	MaterializedViewNames result;
+	result.catalog = qualified.catalog;
+	result.schema = qualified.schema;
+	result.name = qualified.name;
+	result.view = prefix + KeywordHelper::WriteOptionallyQuoted(qualified.name);
+	result.state = prefix + KeywordHelper::WriteOptionallyQuoted(MATERIALIZED_VIEW_STATE_PREFIX + qualified.name);
+	result.registry = prefix + MATERIALIZED_VIEW_REGISTRY;
+	return result;
+}
+
+static unique_ptr<SelectStatement> ParseMaterializedViewQuery(ClientContext &context, const string &query) {
+	Parser parser(context.GetParserOptions());
+	parser.ParseQuery(query);
+	if (parser.statements.size() != 1 || parser.statements[0]->type != StatementType::SELECT_STATEMENT) {
+		throw InvalidInputException("A materialized view must be defined by a single SELECT statement");
+	}
+	auto statement = unique_ptr_cast<SQLStatement, SelectStatement>(std::move(parser.statements[0]));
+	auto &node = *statement->node;
+	if (node.type != QueryNodeType::SELECT_NODE || !node.modifiers.empty() || !node.cte_map.map.empty()) {
+		throw InvalidInputException("A materialized view must be defined by a single SELECT statement without "
+		                            "set operations, common table expressions, DISTINCT, ORDER BY or LIMIT");
+	}
+	auto &select = node.Cast<SelectNode>();
+	if (!select.from_table || select.from_table->type != TableReferenceType::BASE_TABLE ||
+	    select.from_table->sample || select.from_table->Cast<BaseTableRef>().at_clause) {
+		throw InvalidInputException("A materialized view must select from a single table");
+	}
+	if (select.having || select.qualify || select.sample || select.groups.grouping_sets.size() > 1) {
+		throw InvalidInputException(
+		    "A materialized view does not support HAVING, QUALIFY, USING SAMPLE, GROUPING SETS, ROLLUP or CUBE");
+	}
+	return statement;
+}
+
+static bool IsMaterializedViewAggregate(const ParsedExpression &expr) {
+	if (expr.GetExpressionClass() != ExpressionClass::FUNCTION) {
+		return false;
+	}
+	auto &function = expr.Cast<FunctionExpression>();
+	auto name = StringUtil::Lower(function.function_name);
+	return function.catalog.empty() && function.schema.empty() &&
+	       (name == "sum" || name == "count" || name == "count_star" || name == "min" || name == "max" ||
+	        name == "avg");
+}
+
+//! Resolves references to the SELECT list (GROUP BY 1, GROUP BY alias) in a GROUP BY expression
+static unique_ptr<ParsedExpression> ResolveGroup(SelectNode &select, ParsedExpression &group) {
+	if (group.GetExpressionClass() == ExpressionClass::CONSTANT) {
+		auto &constant = group.Cast<ConstantExpression>().value;
+		if (constant.type().IsIntegral()) {
+			auto index = constant.GetValue<int64_t>();
+			if (index < 1 || index > int64_t(select.select_list.size())) {
+				throw InvalidInputException("GROUP BY term out of range - should be between 1 and %d",
+				                            select.select_list.size());
+			}
+			return select.select_list[NumericCast<idx_t>(index - 1)]->Copy();
+		}
+	}
+	if (group.GetExpressionClass() == ExpressionClass::COLUMN_REF) {
+		auto &colref = group.Cast<ColumnRefExpression>();
+		if (!colref.IsQualified()) {
+			for (auto &expr : select.select_list) {
+				if (!IsMaterializedViewAggregate(*expr) && StringUtil::CIEquals(expr->alias, colref.GetColumnName())) {
+					return expr->Copy();
+				}
+			}
+		}
+	}
+	return group.Copy();
+}
+
+static MaterializedViewDefinition GetMaterializedViewDefinition(ClientContext &context, const string &query) {
+	auto statement = ParseMaterializedViewQuery(context, query);
+	auto &select = statement->node->Cast<SelectNode>();
+
+	MaterializedViewDefinition result;
+	result.base_table = select.from_table->ToString();
+	auto &ref = select.from_table->Cast<BaseTableRef>();
+	result.base_table_name.catalog = ref.catalog_name;
+	result.base_table_name.schema = ref.schema_name;
+	result.base_table_name.name = ref.table_name;
+	if (select.where_clause) {
+		result.filter = select.where_clause->ToString();
+	}
+	vector<unique_ptr<ParsedExpression>> groups;
+	if (select.aggregate_handling == AggregateHandling::FORCE_AGGREGATES) {
+		// GROUP BY ALL
+		for (auto &expr : select.select_list) {
+			if (!IsMaterializedViewAggregate(*expr)) {
+				groups.push_back(expr->Copy());
+			}
+		}
+	} else {
+		for (auto &group : select.groups.group_expressions) {
+			groups.push_back(ResolveGroup(select, *group));
+		}
+	}
+	for (auto &group : groups) {
+		group->alias.clear();
+		result.groups.push_back(group->ToString());
+	}
+
+	for (auto &expr : select.select_list) {
+		auto column_name = KeywordHelper::WriteOptionallyQuoted(expr->GetName());
+		if (!IsMaterializedViewAggregate(*expr)) {
+			auto group_expr = expr->Copy();
+			group_expr->alias.clear();
+			idx_t group_index;
+			for (group_index = 0; group_index < groups.size(); group_index++) {
+				if (groups[group_index]->Equals(*group_expr)) {
+					break;
+				}
+			}
+			if (group_index == groups.size()) {
+				throw InvalidInputException("Column \"%s\" of a materialized view must either be an aggregate "
+				                            "(SUM, COUNT, MIN, MAX or AVG) or appear in the GROUP BY clause",
+				                            expr->GetName());
+			}
+			result.columns.push_back(StringUtil::Format("g%d AS %s", group_index, column_name));
+			continue;
+		}
+		auto &function = expr->Cast<FunctionExpression>();
+		auto name = StringUtil::Lower(function.function_name);
+		auto has_order = function.order_bys && !function.order_bys->orders.empty();
+		if (function.distinct || function.filter || has_order || function.export_state ||
+		    function.children.size() != (name == "count_star" ? 0 : 1)) {
+			throw InvalidInputException("Aggregate \"%s\" of a materialized view must have a single argument, "
+			                            "without DISTINCT, FILTER or ORDER BY",
+			                            expr->GetName());
+		}
+		auto state_index = result.states.size();
+		if (name == "count_star") {
+			result.states.push_back("count_star()");
+			result.merge_functions.push_back("sum");
+		} else if (name == "avg") {
+			auto argument = function.children[0]->ToString();
+			result.states.push_back("sum(" + argument + ")");
+			result.merge_functions.push_back("sum");
+			result.states.push_back("count(" + argument + ")");
+			result.merge_functions.push_back("sum");
+			result.columns.push_back(StringUtil::Format("s%d / s%d AS %s", state_index, state_index + 1, column_name));
+			continue;
+		} else {
+			result.states.push_back(name + "(" + function.children[0]->ToString() + ")");
+			result.merge_functions.push_back(name == "count" ? "sum" : name);
+		}
+		result.columns.push_back(StringUtil::Format("s%d AS %s", state_index, column_name));
+	}
+	return result;
+}
+
+//! Returns the query aggregating the rows in [start_row, end_row) of the base table into partial aggregates
+static string GetDeltaQuery(const MaterializedViewDefinition &definition, int64_t start_row, int64_t end_row) {
+	vector<string> select_list;
+	for (idx_t i = 0; i < definition.groups.size(); i++) {
+		select_list.push_back(StringUtil::Format("%s AS g%d", definition.groups[i], i));
+	}
+	for (idx_t i = 0; i < definition.states.size(); i++) {
+		select_list.push_back(StringUtil::Format("%s AS s%d", definition.states[i], i));
+	}
+	// the row id bounds are constants, so that the scan skips the row groups that were aggregated before
+	auto query = StringUtil::Format("SELECT %s FROM %s WHERE rowid >= %lld AND rowid < %lld",
+	                                StringUtil::Join(select_list, ", "), definition.base_table, start_row, end_row);
+	if (!definition.filter.empty()) {
+		query += " AND (" + definition.filter + ")";
+	}
+	if (!definition.groups.empty()) {
+		query += " GROUP BY " + StringUtil::Join(definition.groups, ", ");
+	}
+	return query;
+}
+
+static unique_ptr<MaterializedQueryResult> RunQuery(Connection &con, const string &query) {
+	auto result = con.Query(query);
+	if (result->HasError()) {
+		result->ThrowError();
+	}
+	return result;
+}
+
+//! Returns the expression merging the partial aggregate of the delta (d) into the one of the state (s)
+static string GetMergeExpression(const string &merge_function, idx_t state_index) {
+	auto state = StringUtil::Format("s.s%d", state_index);
+	auto delta = StringUtil::Format("d.s%d", state_index);
+	if (merge_function == "sum") {
+		// the sum of no rows is NULL
+		return StringUtil::Format("coalesce(%s + %s, %s, %s)", state, delta, state, delta);
+	}
+	// least and greatest ignore NULL
+	return StringUtil::Format("%s(%s, %s)", merge_function == "min" ? "least" : "greatest", state, delta);
+}
+
+//! The rows appended to the base table since the watermark of a view
+struct BaseTableRows {
+	//! The watermark covering all rows
+	int64_t next_rowid;
+	//! The rows at or above the previous watermark, which are aggregated by the refresh
+	int64_t appended_rows;
+};
+
+//! Only the row groups at or above the watermark are scanned: the row id filter is checked against their zonemaps
+static BaseTableRows GetAppendedRows(Connection &con, const MaterializedViewDefinition &definition,
+                                     int64_t start_row) {
+	auto query = StringUtil::Format("SELECT coalesce(max(rowid) + 1, %lld), count(*) FROM %s WHERE rowid >= %lld",
+	                                start_row, definition.base_table, start_row);
+	auto result = RunQuery(con, query);
+	BaseTableRows rows;
+	rows.next_rowid = result->GetValue(0, 0).GetValue<int64_t>();
+	rows.appended_rows = result->GetValue(1, 0).GetValue<int64_t>();
+	return rows;
+}
+
+//! Identifies the deletes and updates of the base table, see DataTableInfo
+struct BaseTableVersion {
+	uint64_t incarnation;
+	//! The commit id of the last transaction that deleted or updated rows of the base table
+	transaction_t delete_or_update_commit_id;
+};
+
+static BaseTableVersion GetBaseTableVersion(Connection &con, const MaterializedViewDefinition &definition) {
+	auto &name = definition.base_table_name;
+	auto &table = Catalog::GetEntry<TableCatalogEntry>(*con.context, name.catalog, name.schema, name.name);
+	if (!table.IsDuckTable()) {
+		throw InvalidInputException("A materialized view can only be defined over a DuckDB table");
+	}
+	auto &info = *table.Cast<DuckTableEntry>().GetStorage().GetDataTableInfo();
+	BaseTableVersion version;
+	version.incarnation = info.GetIncarnation();
+	version.delete_or_update_commit_id = info.GetLastDeleteOrUpdateCommitId();
+	return version;
+}
+
+//! The maintenance statements run on a connection of their own, and commit independently of the calling transaction
+static void CheckAutoCommit(ClientContext &context, const string &function_name) {
+	if (!context.transaction.IsAutoCommit()) {
+		throw TransactionException("%s cannot be called in a transaction started with BEGIN: it maintains the view in "
+		                           "a transaction of its own, which a ROLLBACK would not undo",
+		                           function_name);
+	}
+}
+
+template <class FUNC>
+static void RunInTransaction(Connection &con, FUNC fun) {
+	con.BeginTransaction();
+	try {
+		fun();
+		con.Commit();
+	} catch (...) {
+		if (con.HasActiveTransaction()) {
+			con.Rollback();
+		}
+		throw;
+	}
+}
+
+struct MaterializedViewBindData : public TableFunctionData {
+	MaterializedViewNames names;
+	//! The definition of the view, with the base table qualified (create only)
+	string query;
+};
+
+struct MaterializedViewState : public GlobalTableFunctionState {
+	MaterializedViewState() : finished(false) {
+	}
+
+	bool finished;
+};
+
+static unique_ptr<GlobalTableFunctionState> MaterializedViewInit(ClientContext &context,
+                                                                 TableFunctionInitInput &input) {
+	return make_uniq<MaterializedViewState>();
+}
+
+static void CheckMaterializedViewName(const Value &name) {
+	if (name.IsNull()) {
+		throw BinderException("The name of a materialized view cannot be NULL");
+	}
+}
+
+static unique_ptr<FunctionData> CreateMaterializedViewBind(ClientContext &context, TableFunctionBindInput &input,
+                                                           vector<LogicalType> &return_types, vector<string> &names) {
+	CheckMaterializedViewName(input.inputs[0]);
+	if (input.inputs[1].IsNull()) {
+		throw BinderException("The query of a materialized view cannot be NULL");
+	}
+	auto result = make_uniq<MaterializedViewBindData>();
+	result->names = GetMaterializedViewNames(context, StringValue::Get(input.inputs[0]));
+
+	// qualify the base table: the views are maintained by connections with a different search path
+	auto statement = ParseMaterializedViewQuery(context, StringValue::Get(input.inputs[1]));
+	auto &ref = statement->node->Cast<SelectNode>().from_table->Cast<BaseTableRef>();
+	auto &table = Catalog::GetEntry<TableCatalogEntry>(context, ref.catalog_name, ref.schema_name, ref.table_name);
+	if (!table.IsDuckTable()) {
+		throw BinderException("A materialized view can only be defined over a DuckDB table");
+	}
+	ref.catalog_name = table.ParentCatalog().GetName();
+	ref.schema_name = table.ParentSchema().name;
+	result->query = statement->ToString();
+	// verify the definition
+	GetMaterializedViewDefinition(context, result->query);
+
+	names.emplace_back("appended_rows");
+	return_types.emplace_back(LogicalType::BIGINT);
+	return std::move(result);
+}
+
+static void CreateMaterializedViewFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<MaterializedViewState>();
+	if (state.finished) {
+		return;
+	}
+	auto &bind_data = data_p.bind_data->Cast<MaterializedViewBindData>();
+	auto &names = bind_data.names;
+	CheckAutoCommit(context, "create_materialized_view");
+	auto definition = GetMaterializedViewDefinition(context, bind_data.query);
+
+	// the view is maintained in a transaction of its own
+	Connection con(*context.db);
+	int64_t appended_rows = 0;
+	RunInTransaction(con, [&]() {
+		RunQuery(con, StringUtil::Format("CREATE TABLE IF NOT EXISTS %s (view_name VARCHAR PRIMARY KEY, definition "
+		                                 "VARCHAR NOT NULL, next_rowid BIGINT NOT NULL, aggregated_rows BIGINT NOT "
+		                                 "NULL, base_incarnation UBIGINT NOT NULL, base_commit_id UBIGINT NOT NULL)",
+		                                 names.registry));
+		auto version = GetBaseTableVersion(con, definition);
+		auto rows = GetAppendedRows(con, definition, 0);
+		appended_rows = rows.appended_rows;
+		RunQuery(con, StringUtil::Format("CREATE TABLE %s AS %s", names.state,
+		                                 GetDeltaQuery(definition, 0, rows.next_rowid)));
+		RunQuery(con, StringUtil::Format("INSERT INTO %s VALUES (%s, %s, %lld, %lld, %llu, %llu)", names.registry,
+		                                 KeywordHelper::WriteQuoted(names.name, '\''),
+		                                 KeywordHelper::WriteQuoted(bind_data.query, '\''), rows.next_rowid,
+		                                 rows.appended_rows, version.incarnation, version.delete_or_update_commit_id));
+		RunQuery(con, StringUtil::Format("CREATE VIEW %s AS SELECT %s FROM %s", names.view,
+		                                 StringUtil::Join(definition.columns, ", "), names.state));
+	});
+	output.SetValue(0, 0, Value::BIGINT(appended_rows));
+	output.SetCardinality(1);
+	state.finished = true;
+}
+
+static unique_ptr<FunctionData> RefreshMaterializedViewBind(ClientContext &context, TableFunctionBindInput &input,
+                                                            vector<LogicalType> &return_types, vector<string> &names) {
+	CheckMaterializedViewName(input.inputs[0]);
+	auto result = make_uniq<MaterializedViewBindData>();
+	result->names = GetMaterializedViewNames(context, StringValue::Get(input.inputs[0]));
+	names.emplace_back("appended_rows");
+	return_types.emplace_back(LogicalType::BIGINT);
+	return std::move(result);
+}
+
+struct RegisteredView {
+	string definition;
+	//! The first row id of the base table that has not been aggregated
+	int64_t next_rowid;
+	//! The rows of the base table below next_rowid when the view was last refreshed
+	int64_t aggregated_rows;
+	//! The version of the base table when the view was last refreshed
+	BaseTableVersion base_version;
+};
+
+//! Returns the definition and the watermark of a materialized view from the registry
+static RegisteredView GetRegisteredView(Connection &con, const MaterializedViewNames &names) {
+	auto registry_table = Catalog::GetEntry<TableCatalogEntry>(*con.context, names.catalog, names.schema,
+	                                                           MATERIALIZED_VIEW_REGISTRY,
+	                                                           OnEntryNotFound::RETURN_NULL);
+	if (registry_table) {
+		auto query = StringUtil::Format("SELECT definition, next_rowid, aggregated_rows, base_incarnation, "
+		                                "base_commit_id FROM %s WHERE view_name = %s",
+		                                names.registry, KeywordHelper::WriteQuoted(names.name, '\''));
+		auto result = RunQuery(con, query);
+		if (result->RowCount() == 1) {
+			RegisteredView view;
+			view.definition = result->GetValue(0, 0).ToString();
+			view.next_rowid = result->GetValue(1, 0).GetValue<int64_t>();
+			view.aggregated_rows = result->GetValue(2, 0).GetValue<int64_t>();
+			view.base_version.incarnation = result->GetValue(3, 0).GetValue<uint64_t>();
+			view.base_version.delete_or_update_commit_id = result->GetValue(4, 0).GetValue<uint64_t>();
+			return view;
+		}
+	}
+	throw CatalogException("Materialized view with name %s does not exist", names.view);
+}
+
+//! Merges the partial aggregates of the rows in [start_row, end_row) into the states of their groups: only the groups
+//! that received rows are written
+static void MergeAppendedRows(Connection &con, const MaterializedViewNames &names,
+                              const MaterializedViewDefinition &definition, int64_t start_row, int64_t end_row) {
+	RunQuery(con, StringUtil::Format("CREATE TEMPORARY TABLE %s AS %s", MATERIALIZED_VIEW_DELTA,
+	                                 GetDeltaQuery(definition, start_row, end_row)));
+	vector<string> conditions;
+	for (idx_t i = 0; i < definition.groups.size(); i++) {
+		conditions.push_back(StringUtil::Format("s.g%d IS NOT DISTINCT FROM d.g%d", i, i));
+	}
+	vector<string> assignments;
+	for (idx_t i = 0; i < definition.states.size(); i++) {
+		assignments.push_back(StringUtil::Format("s%d = %s", i, GetMergeExpression(definition.merge_functions[i], i)));
+	}
+	auto update = StringUtil::Format("UPDATE %s AS s SET %s FROM %s AS d", names.state,
+	                                 StringUtil::Join(assignments, ", "), MATERIALIZED_VIEW_DELTA);
+	if (!conditions.empty()) {
+		update += " WHERE " + StringUtil::Join(conditions, " AND ");
+	}
+	RunQuery(con, update);
+	if (!conditions.empty()) {
+		// without GROUP BY the state table always has a single row
+		RunQuery(con, StringUtil::Format("INSERT INTO %s SELECT * FROM %s AS d WHERE NOT EXISTS (SELECT 1 FROM %s "
+		                                 "AS s WHERE %s)",
+		                                 names.state, MATERIALIZED_VIEW_DELTA, names.state,
+		                                 StringUtil::Join(conditions, " AND ")));
+	}
+	RunQuery(con, StringUtil::Format("DROP TABLE %s", MATERIALIZED_VIEW_DELTA));
+}
+
+static void RefreshMaterializedViewFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<MaterializedViewState>();
+	if (state.finished) {
+		return;
+	}
+	CheckAutoCommit(context, "refresh_materialized_view");
+	auto &names = data_p.bind_data->Cast<MaterializedViewBindData>().names;
+
+	Connection con(*context.db);
+	int64_t appended_rows = 0;
+	RunInTransaction(con, [&]() {
+		auto view = GetRegisteredView(con, names);
+		auto definition = GetMaterializedViewDefinition(*con.context, view.definition);
+		auto version = GetBaseTableVersion(con, definition);
+		auto restarted = version.incarnation != view.base_version.incarnation;
+		if (!restarted && version.delete_or_update_commit_id != view.base_version.delete_or_update_commit_id) {
+			throw InvalidInputException("Materialized view %s requires %s to be append-only, but rows have been "
+			                            "deleted or updated since its last refresh - drop and create the view again",
+			                            names.view, definition.base_table);
+		}
+		if (restarted) {
+			auto result = RunQuery(con, StringUtil::Format("SELECT count(*) FROM %s WHERE rowid < %lld",
+			                                               definition.base_table, view.next_rowid));
+			auto aggregated_rows = result->GetValue(0, 0).GetValue<int64_t>();
+			if (aggregated_rows != view.aggregated_rows) {
+				throw InvalidInputException("Materialized view %s requires %s to be append-only, but %lld of the rows "
+				                            "it aggregated have been deleted since - drop and create the view again",
+				                            names.view, definition.base_table, view.aggregated_rows - aggregated_rows);
+			}
+		}
+		auto rows = GetAppendedRows(con, definition, view.next_rowid);
+		appended_rows = rows.appended_rows;
+		if (appended_rows == 0 && !restarted) {
+			return;
+		}
+		if (appended_rows > 0) {
+			MergeAppendedRows(con, names, definition, view.next_rowid, rows.next_rowid);
+		}
+		// concurrent refreshes of the same view conflict on the registry
+		RunQuery(con, StringUtil::Format("UPDATE %s SET next_rowid = %lld, aggregated_rows = %lld, base_incarnation = "
+		                                 "%llu, base_commit_id = %llu WHERE view_name = %s",
+		                                 names.registry, rows.next_rowid, view.aggregated_rows + appended_rows,
+		                                 version.incarnation, version.delete_or_update_commit_id,
+		                                 KeywordHelper::WriteQuoted(names.name, '\'')));
+	});
+	output.SetValue(0, 0, Value::BIGINT(appended_rows));
+	output.SetCardinality(1);
+	state.finished = true;
+}
+
+static unique_ptr<FunctionData> DropMaterializedViewBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	CheckMaterializedViewName(input.inputs[0]);
+	auto result = make_uniq<MaterializedViewBindData>();
+	result->names = GetMaterializedViewNames(context, StringValue::Get(input.inputs[0]));
+	names.emplace_back("Success");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+	return std::move(result);
+}
+
+static void DropMaterializedViewFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<MaterializedViewState>();
+	if (state.finished) {
+		return;
+	}
+	CheckAutoCommit(context, "drop_materialized_view");
+	auto &names = data_p.bind_data->Cast<MaterializedViewBindData>().names;
+
+	Connection con(*context.db);
+	RunInTransaction(con, [&]() {
+		GetRegisteredView(con, names);
+		RunQuery(con, "DROP VIEW IF EXISTS " + names.view);
+		RunQuery(con, "DROP TABLE IF EXISTS " + names.state);
+		RunQuery(con, StringUtil::Format("DELETE FROM %s WHERE view_name = %s", names.registry,
+		                                 KeywordHelper::WriteQuoted(names.name, '\'')));
+	});
+	state.finished = true;
+}
+
+void MaterializedViewFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("create_materialized_view", {LogicalType::VARCHAR, LogicalType::VARCHAR},
+	                              CreateMaterializedViewFunction, CreateMaterializedViewBind, MaterializedViewInit));
+	set.AddFunction(TableFunction("refresh_materialized_view", {LogicalType::VARCHAR},
+	                              RefreshMaterializedViewFunction, RefreshMaterializedViewBind, MaterializedViewInit));
+	set.AddFunction(TableFunction("drop_materialized_view", {LogicalType::VARCHAR}, DropMaterializedViewFunction,
+	                              DropMaterializedViewBind, MaterializedViewInit));
+}
+
+} // namespace duckdb
@@ -20,12 +20,15 @@ void BuiltinFunctions::RegisterSQLiteFunctions() {
 
 	DuckDBConnectionCountFun::RegisterFunction(*this);
 	DuckDBApproxDatabaseCountFun::RegisterFunction(*this);
+	DuckDBBufferPoolFun::RegisterFunction(*this);
 	DuckDBColumnsFun::RegisterFunction(*this);
 	DuckDBConstraintsFun::RegisterFunction(*this);
 	DuckDBDatabasesFun::RegisterFunction(*this);
 	DuckDBFunctionsFun::RegisterFunction(*this);
 	DuckDBKeywordsFun::RegisterFunction(*this);
 	DuckDBPreparedStatementsFun::RegisterFunction(*this);
+	DuckDBPlanCacheFun::RegisterFunction(*this);
+	DuckDBQueryResultCacheFun::RegisterFunction(*this);
 	DuckDBLogFun::RegisterFunction(*this);
 	DuckDBLogContextFun::RegisterFunction(*this);
 	DuckDBIndexesFun::RegisterFunction(*this);
@@ -47,6 +50,7 @@ void BuiltinFunctions::RegisterSQLiteFunctions() {
 	DuckDBVariablesFun::RegisterFunction(*this);
 	DuckDBViewsFun::RegisterFunction(*this);
 	EnableLoggingFun::RegisterFunction(*this);
+	MaterializedViewFun::RegisterFunction(*this);
 	TestAllTypesFun::RegisterFunction(*this);
 	TestVectorTypesFun::RegisterFunction(*this);
 }
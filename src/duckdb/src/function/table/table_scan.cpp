@@ -330,13 +330,19 @@ unique_ptr<GlobalTableFunctionState> DuckTableScanInitGlobal(ClientContext &cont
                                                              DataTable &storage, const TableScanBindData &bind_data) {
 	auto g_state = make_uniq<DuckTableScanState>(context, input.bind_data.get());
 	storage.InitializeParallelScan(context, g_state->state);
+	auto &duck_table = bind_data.table.Cast<DuckTableEntry>();
+	const auto &columns = duck_table.GetColumns();
+	if (input.scan_order_column.IsValid() && input.scan_order_column.GetIndex() < columns.LogicalColumnCount()) {
+		auto &column = columns.GetColumn(LogicalIndex(input.scan_order_column.GetIndex()));
+		if (!column.Generated()) {
+			storage.SetParallelScanOrder(g_state->state, column.Physical(), input.scan_order_type);
+		}
+	}
 	if (!input.CanRemoveFilterColumns()) {
 		return std::move(g_state);
 	}
 
 	g_state->projection_ids = input.projection_ids;
-	auto &duck_table = bind_data.table.Cast<DuckTableEntry>();
-	const auto &columns = duck_table.GetColumns();
 	for (const auto &col_idx : input.column_indexes) {
 		if (col_idx.IsRowIdColumn()) {
 			g_state->scanned_types.emplace_back(LogicalType::ROW_TYPE);
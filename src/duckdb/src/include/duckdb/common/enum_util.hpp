@@ -86,6 +86,8 @@ enum class BlockIteratorStateType : int8_t;
 
 enum class BlockState : uint8_t;
 
+enum class BufferEvictionPolicy : uint8_t;
+
 enum class CAPIResultSetType : uint8_t;
 
 enum class CSVState : uint8_t;
@@ -400,6 +402,8 @@ enum class TaskExecutionMode : uint8_t;
 
 enum class TaskExecutionResult : uint8_t;
 
+enum class TaskPriority : uint8_t;
+
 enum class TemporaryBufferSize : uint64_t;
 
 enum class TemporaryCompressionLevel : int;
@@ -528,6 +532,9 @@ const char* EnumUtil::ToChars<BlockIteratorStateType>(BlockIteratorStateType val
 template<>
 const char* EnumUtil::ToChars<BlockState>(BlockState value);
 
+template<>
+const char* EnumUtil::ToChars<BufferEvictionPolicy>(BufferEvictionPolicy value);
+
 template<>
 const char* EnumUtil::ToChars<CAPIResultSetType>(CAPIResultSetType value);
 
@@ -999,6 +1006,9 @@ const char* EnumUtil::ToChars<TaskExecutionMode>(TaskExecutionMode value);
 template<>
 const char* EnumUtil::ToChars<TaskExecutionResult>(TaskExecutionResult value);
 
+template<>
+const char* EnumUtil::ToChars<TaskPriority>(TaskPriority value);
+
 template<>
 const char* EnumUtil::ToChars<TemporaryBufferSize>(TemporaryBufferSize value);
 
@@ -1150,6 +1160,9 @@ BlockIteratorStateType EnumUtil::FromString<BlockIteratorStateType>(const char *
 template<>
 BlockState EnumUtil::FromString<BlockState>(const char *value);
 
+template<>
+BufferEvictionPolicy EnumUtil::FromString<BufferEvictionPolicy>(const char *value);
+
 template<>
 CAPIResultSetType EnumUtil::FromString<CAPIResultSetType>(const char *value);
 
@@ -1621,6 +1634,9 @@ TaskExecutionMode EnumUtil::FromString<TaskExecutionMode>(const char *value);
 template<>
 TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value);
 
+template<>
+TaskPriority EnumUtil::FromString<TaskPriority>(const char *value);
+
 template<>
 TemporaryBufferSize EnumUtil::FromString<TemporaryBufferSize>(const char *value);
 
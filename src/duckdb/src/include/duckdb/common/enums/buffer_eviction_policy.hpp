@@ -0,0 +1,20 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/buffer_eviction_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+enum class BufferEvictionPolicy : uint8_t {
+	LRU = 0,      //! Evict persistent blocks in the order in which they were last unpinned
+	TWO_QUEUE = 1 //! Evict persistent blocks that were used once before blocks that were used again (2Q)
+};
+
+} // namespace duckdb
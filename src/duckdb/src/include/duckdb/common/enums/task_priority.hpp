@@ -0,0 +1,18 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/task_priority.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The workload class of the tasks of a query, the scheduler dequeues the classes weighted by their priority
+enum class TaskPriority : uint8_t { HIGH = 0, NORMAL = 1, LOW = 2 };
+
+} // namespace duckdb
@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include "duckdb/common/enums/order_type.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/optional_idx.hpp"
 #include "duckdb/parser/parsed_data/sample_options.hpp"
@@ -22,7 +23,8 @@ public:
 	ExtraOperatorInfo() : file_filters(""), sample_options(nullptr) {
 	}
 	ExtraOperatorInfo(ExtraOperatorInfo &&extra_info) noexcept
-	    : file_filters(std::move(extra_info.file_filters)), sample_options(std::move(extra_info.sample_options)) {
+	    : file_filters(std::move(extra_info.file_filters)), sample_options(std::move(extra_info.sample_options)),
+	      scan_order_column(extra_info.scan_order_column), scan_order_type(extra_info.scan_order_type) {
 		if (extra_info.total_files.IsValid()) {
 			total_files = extra_info.total_files.GetIndex();
 		}
@@ -40,13 +42,16 @@ public:
 				filtered_files = extra_info.filtered_files.GetIndex();
 			}
 			sample_options = std::move(extra_info.sample_options);
+			scan_order_column = extra_info.scan_order_column;
+			scan_order_type = extra_info.scan_order_type;
 		}
 		return *this;
 	}
 
 	bool operator==(const ExtraOperatorInfo &other) const {
 		return file_filters == other.file_filters && total_files == other.total_files &&
-		       filtered_files == other.filtered_files && sample_options == other.sample_options;
+		       filtered_files == other.filtered_files && sample_options == other.sample_options &&
+		       scan_order_column == other.scan_order_column && scan_order_type == other.scan_order_type;
 	}
 
 	//! Filters that have been pushed down into the main file list
@@ -57,6 +62,11 @@ public:
 	optional_idx filtered_files;
 	//! Sample options that have been pushed down into the table scan
 	unique_ptr<SampleOptions> sample_options;
+	//! (Optionally) the column by whose statistics the scan orders its row groups, so that the dynamic filter of a
+	//! Top-N above the scan becomes selective early
+	optional_idx scan_order_column;
+	//! DESCENDING scans the row groups with the highest maximum first, ASCENDING those with the lowest minimum first
+	OrderType scan_order_type = OrderType::INVALID;
 
 	void Serialize(Serializer &serializer) const;
 	static ExtraOperatorInfo Deserialize(Deserializer &deserializer);
@@ -49,6 +49,8 @@ public:
 	unordered_map<column_t, unique_ptr<Expression>> expression_map;
 	//! The final types for various expressions - this is ONLY used if UseCastMap() is explicitly enabled
 	unordered_map<column_t, LogicalType> cast_map;
+	//! (Optionally) the local column by whose statistics the row groups are scheduled, below a Top-N
+	optional_idx scan_order_column;
 
 	//! (Optionally) The deletion filter (generated by the multi file reader)
 	unique_ptr<DeleteFilter> deletion_filter;
@@ -13,6 +13,7 @@
 #include "duckdb/function/copy_function.hpp"
 #include "duckdb/common/exception/conversion_exception.hpp"
 #include "duckdb/common/multi_file/multi_file_data.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include <numeric>
 
 namespace duckdb {
@@ -55,6 +56,9 @@ struct MultiFileReaderInterface {
 	                           LocalTableFunctionState &local_state);
 	virtual unique_ptr<NodeStatistics> GetCardinality(const MultiFileBindData &bind_data, idx_t file_count) = 0;
 	virtual void GetVirtualColumns(ClientContext &context, MultiFileBindData &bind_data, virtual_column_map_t &result);
+	//! Adds reader-specific information about the running scan (e.g., to EXPLAIN ANALYZE)
+	virtual void DynamicToString(const GlobalTableFunctionState &global_state,
+	                             InsertionOrderPreservingMap<string> &result);
 	virtual unique_ptr<MultiFileReaderInterface> Copy();
 	virtual FileGlobInput GetGlobInput();
 };
@@ -252,8 +256,32 @@ public:
 		// 1. The MultiFileReader::Bind call
 		// 2. The 'schema' parquet option
 		auto &global_columns = bind_data.reader_bind.schema.empty() ? bind_data.columns : bind_data.reader_bind.schema;
-		return bind_data.multi_file_reader->InitializeReader(reader_data, bind_data, global_columns, global_column_ids,
-		                                                     table_filters, context, global_state);
+		auto result = bind_data.multi_file_reader->InitializeReader(reader_data, bind_data, global_columns,
+		                                                            global_column_ids, table_filters, context,
+		                                                            global_state);
+		SetScanOrderColumn(reader_data, global_column_ids, global_state);
+		return result;
+	}
+
+	//! Maps the scan order column to the column of the file, if the file column is read as is
+	static void SetScanOrderColumn(MultiFileReaderData &reader_data, const vector<ColumnIndex> &global_column_ids,
+	                               const MultiFileGlobalState &global_state) {
+		if (!global_state.scan_order_column.IsValid()) {
+			return;
+		}
+		auto &reader = *reader_data.reader;
+		for (idx_t i = 0; i < global_column_ids.size() && i < reader_data.expressions.size(); i++) {
+			if (global_column_ids[i].GetPrimaryIndex() != global_state.scan_order_column.GetIndex()) {
+				continue;
+			}
+			auto &expr = *reader_data.expressions[i];
+			if (expr.GetExpressionType() == ExpressionType::BOUND_REF) {
+				// not a constant and not cast: the statistics of the file column order the rows the same way
+				auto local_idx = MultiFileLocalIndex(expr.Cast<BoundReferenceExpression>().index);
+				reader.scan_order_column = reader.column_ids[local_idx].GetId();
+			}
+			return;
+		}
 	}
 
 	//! Helper function that try to start opening a next file. Parallel lock should be locked when calling.
@@ -510,6 +538,8 @@ public:
 		result->column_indexes = input.column_indexes;
 		result->filters = input.filters.get();
 		result->op = input.op;
+		result->scan_order_column = input.scan_order_column;
+		result->scan_order_type = input.scan_order_type;
 		result->global_state = bind_data.interface->InitializeGlobalState(context, bind_data, *result);
 		result->max_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
 
@@ -759,9 +789,13 @@ public:
 	}
 
 	static InsertionOrderPreservingMap<string> MultiFileDynamicToString(TableFunctionDynamicToStringInput &input) {
+		auto &bind_data = input.bind_data->Cast<MultiFileBindData>();
 		auto &gstate = input.global_state->Cast<MultiFileGlobalState>();
 		InsertionOrderPreservingMap<string> result;
 		result.insert(make_pair("Total Files Read", std::to_string(gstate.file_index.load())));
+		if (gstate.global_state) {
+			bind_data.interface->DynamicToString(*gstate.global_state, result);
+		}
 		return result;
 	}
 
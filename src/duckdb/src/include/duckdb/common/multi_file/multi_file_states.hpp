@@ -12,6 +12,7 @@
 #include "duckdb/common/multi_file/multi_file_options.hpp"
 #include "duckdb/common/multi_file/base_file_reader.hpp"
 #include "duckdb/common/multi_file/multi_file_list.hpp"
+#include "duckdb/common/enums/order_type.hpp"
 
 namespace duckdb {
 struct MultiFileReaderInterface;
@@ -170,6 +171,9 @@ struct MultiFileGlobalState : public GlobalTableFunctionState {
 	unique_ptr<GlobalTableFunctionState> global_state;
 
 	optional_ptr<const PhysicalOperator> op;
+	//! (Optionally) the column of a Top-N by whose statistics readers should schedule their row groups, and the order
+	optional_idx scan_order_column;
+	OrderType scan_order_type = OrderType::INVALID;
 
 	idx_t MaxThreads() const override {
 		return max_threads;
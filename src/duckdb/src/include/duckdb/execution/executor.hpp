@@ -115,6 +115,12 @@ public:
 	void UnregisterTask() {
 		executor_tasks--;
 	}
+	//! Reserves up to max_tasks pipeline tasks within the max_threads_per_query limit of the query, returns the number
+	//! reserved - at least one, so that every pipeline can make progress
+	idx_t ReservePipelineTasks(idx_t max_tasks);
+	void ReleasePipelineTask() {
+		pipeline_tasks--;
+	}
 
 	idx_t GetTotalPipelines() const {
 		return total_pipelines;
@@ -187,6 +193,8 @@ private:
 
 	//! Currently alive executor tasks
 	atomic<idx_t> executor_tasks;
+	//! Pipeline tasks of the query that are scheduled or running
+	atomic<idx_t> pipeline_tasks;
 
 	//! Total time blocked while waiting on tasks. In ticks. One tick corresponds to WAIT_TIME.
 	atomic<idx_t> blocked_thread_time;
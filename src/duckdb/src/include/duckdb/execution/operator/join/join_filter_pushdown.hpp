@@ -13,6 +13,7 @@
 #include "duckdb/planner/table_filter.hpp"
 
 namespace duckdb {
+class BlockedBloomFilter;
 class DataChunk;
 class DynamicTableFilterSet;
 class LogicalGet;
@@ -76,6 +77,7 @@ public:
 private:
 	void PushInFilter(const JoinFilterPushdownFilter &info, JoinHashTable &ht, const PhysicalOperator &op,
 	                  idx_t filter_idx, idx_t filter_col_idx) const;
+	shared_ptr<BlockedBloomFilter> BuildBloomFilter(JoinHashTable &ht, idx_t filter_idx) const;
 };
 
 } // namespace duckdb
@@ -59,6 +59,10 @@ struct DuckDBColumnsFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBBufferPoolFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBConstraintsFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -119,6 +123,14 @@ struct DuckDBOptimizersFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBPlanCacheFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct DuckDBQueryResultCacheFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBSecretTypesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -159,6 +171,10 @@ struct EnableLoggingFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct MaterializedViewFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct TestType {
 	TestType(LogicalType type_p, string name_p)
 	    : type(std::move(type_p)), name(std::move(name_p)), min_value(Value::MinimumValue(type)),
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/enums/operator_result_type.hpp"
+#include "duckdb/common/enums/order_type.hpp"
 #include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/execution/execution_context.hpp"
 #include "duckdb/function/function.hpp"
@@ -138,6 +139,9 @@ struct TableFunctionInitInput {
 	optional_ptr<TableFilterSet> filters;
 	optional_ptr<SampleOptions> sample_options;
 	optional_ptr<const PhysicalOperator> op;
+	//! (Optionally) the column by whose statistics the row groups (or files) should be scanned, see ExtraOperatorInfo
+	optional_idx scan_order_column;
+	OrderType scan_order_type = OrderType::INVALID;
 
 	bool CanRemoveFilterColumns() const {
 		if (projection_ids.empty()) {
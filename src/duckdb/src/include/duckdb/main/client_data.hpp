@@ -21,6 +21,7 @@ class FileOpener;
 class FileSystem;
 class QueryProfiler;
 class PreparedStatementData;
+class QueryResultCache;
 class RandomEngine;
 class BufferManager;
 
@@ -37,6 +38,8 @@ public:
 	shared_ptr<AttachedDatabase> temporary_objects;
 	//! The set of bound prepared statements belonging to this client.
 	case_insensitive_map_t<shared_ptr<PreparedStatementData>> prepared_statements;
+	//! The cached results of read-only queries of this client.
+	unique_ptr<QueryResultCache> query_result_cache;
 
 	//! The random generator used by random().
 	//! Its seed value can be set by setseed().
@@ -16,6 +16,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/encryption_state.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/thread_pin_mode.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
 #include "duckdb/common/enums/optimizer_type.hpp"
@@ -132,6 +133,8 @@ struct DBConfigOptions {
 	bool trim_free_blocks = false;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool buffer_manager_track_eviction_timestamps = false;
+	//! The policy with which persistent blocks are evicted from the buffer pool
+	BufferEvictionPolicy buffer_eviction_policy = BufferEvictionPolicy::LRU;
 	//! Whether or not to allow printing unredacted secrets
 	bool allow_unredacted_secrets = false;
 	//! Disables invalidating the database instance when encountering a fatal error.
@@ -0,0 +1,84 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/plan_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/statement_type.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class DatabaseInstance;
+class LogicalOperator;
+class PreparedStatementData;
+class SQLStatement;
+
+struct PlanCacheStatistics {
+	idx_t hits = 0;
+	idx_t misses = 0;
+	idx_t entries = 0;
+};
+
+//! The PlanCache holds the optimized logical plans of the SELECT statements prepared by the connections of a
+//! database. Plans are kept serialized: a connection preparing a cached statement deserializes its own copy of the
+//! plan instead of binding and optimizing the statement again. A plan is only reused while the catalogs it was bound
+//! against are unchanged
+class PlanCache {
+public:
+	static PlanCache &Get(ClientContext &context);
+
+	//! Returns the key of the statement, or an empty string if its plan cannot be shared with other connections
+	static string GetKey(ClientContext &context, SQLStatement &statement);
+
+	//! Returns a copy of the cached plan and sets the names, types, properties and parameters of the statement, or
+	//! returns nullptr if there is no (current) plan
+	unique_ptr<LogicalOperator> Lookup(ClientContext &context, const string &key, PreparedStatementData &statement);
+	//! Caches the optimized plan. The plan is replaced by its deserialized copy, so that the connection storing the
+	//! plan executes the same plan as the connections that reuse it
+	void Store(ClientContext &context, const string &key, unique_ptr<LogicalOperator> &plan,
+	           PreparedStatementData &statement);
+	//! Called before a SET or RESET statement runs. Settings of the connection and variables are part of the key, a
+	//! global setting can change the plans of all connections and drops all cached plans
+	void SettingChanged(ClientContext &context, SQLStatement &statement);
+	//! Drops all cached plans
+	void Clear();
+
+	PlanCacheStatistics GetStatistics();
+
+private:
+	struct CachedPlan {
+		unsafe_unique_array<data_t> serialized_plan;
+		idx_t serialized_size;
+		vector<string> names;
+		vector<LogicalType> types;
+		StatementProperties properties;
+		//! The types of all parameters, including those the optimizer removed from the plan
+		case_insensitive_map_t<LogicalType> parameter_types;
+	};
+	struct CacheEntry {
+		shared_ptr<CachedPlan> plan;
+		//! The position of the key in the LRU list
+		list<string>::iterator lru_position;
+	};
+
+	mutex lock;
+	unordered_map<string, CacheEntry> entries;
+	//! The keys of the entries, most recently used first
+	list<string> lru;
+	//! Lookups that returned a plan, and lookups that did not
+	atomic<idx_t> hits {0};
+	atomic<idx_t> misses {0};
+};
+
+} // namespace duckdb
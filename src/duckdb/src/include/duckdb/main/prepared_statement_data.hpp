@@ -19,6 +19,7 @@
 namespace duckdb {
 class CatalogEntry;
 class ClientContext;
+class DataTable;
 class PhysicalPlan;
 class SQLStatement;
 
@@ -46,6 +47,10 @@ public:
 	bound_parameter_map_t value_map;
 	//! Whether we are creating a streaming result or not
 	bool is_streaming = false;
+	//! The key of the statement in the query result cache, empty if its result cannot be cached
+	string result_cache_key;
+	//! The tables scanned by the statement, if its result can be cached
+	vector<weak_ptr<DataTable>> result_cache_tables;
 
 public:
 	void CheckParameterCount(idx_t parameter_count);
@@ -0,0 +1,87 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class DataTable;
+class LogicalOperator;
+class PreparedStatementData;
+struct PendingQueryParameters;
+
+struct QueryResultCacheStatistics {
+	idx_t hits = 0;
+	idx_t misses = 0;
+	idx_t entries = 0;
+	idx_t cached_rows = 0;
+};
+
+//! The QueryResultCache holds the materialized results of the read-only queries of a single connection. A result is
+//! reused for as long as no transaction has committed changes to any of the tables the query scans; entries are
+//! evicted in least-recently-used order
+class QueryResultCache {
+public:
+	//! The maximum amount of results held by the cache
+	static constexpr idx_t MAX_ENTRIES = 64;
+	//! Results with more rows than this are not cached
+	static constexpr idx_t MAX_ROWS = 100000;
+
+public:
+	static QueryResultCache &Get(ClientContext &context);
+
+	//! Sets the cache key and the scanned tables of a prepared SELECT statement, if its result can be reused at all
+	static void PrepareStatement(ClientContext &context, string statement_key, LogicalOperator &plan,
+	                             PreparedStatementData &statement);
+	//! Returns the key of the result of executing the statement with these parameters, or an empty string if the
+	//! result cannot be taken from or stored in the cache
+	static string GetKey(ClientContext &context, PreparedStatementData &statement,
+	                     const PendingQueryParameters &parameters);
+	//! Creates a plan that scans a cached result in place of executing the statement
+	static shared_ptr<PreparedStatementData> CreateCachedPlan(ClientContext &context,
+	                                                          PreparedStatementData &statement,
+	                                                          shared_ptr<ColumnDataCollection> result);
+
+	//! Returns the cached result, or nullptr if there is none or the scanned tables have changed since
+	shared_ptr<ColumnDataCollection> Lookup(ClientContext &context, const string &key,
+	                                        PreparedStatementData &statement);
+	//! Stores a copy of the result of the statement
+	void Store(ClientContext &context, const string &key, PreparedStatementData &statement,
+	           ColumnDataCollection &result);
+	//! Drops all cached results
+	void Clear();
+
+	QueryResultCacheStatistics GetStatistics();
+
+private:
+	struct CacheEntry {
+		//! The scanned tables and the commit id of their last change when the result was computed
+		vector<weak_ptr<DataTable>> tables;
+		vector<transaction_t> table_versions;
+		shared_ptr<ColumnDataCollection> result;
+		//! The position of the key in the LRU list
+		list<string>::iterator lru_position;
+	};
+
+	bool IsValid(ClientContext &context, const CacheEntry &entry, PreparedStatementData &statement);
+	void Erase(unordered_map<string, CacheEntry>::iterator entry);
+
+	unordered_map<string, CacheEntry> entries;
+	//! The keys of the entries, most recently used first
+	list<string> lru;
+	idx_t hits = 0;
+	idx_t misses = 0;
+	idx_t cached_rows = 0;
+};
+
+} // namespace duckdb
@@ -11,11 +11,13 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/setting_info.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/checkpoint_abort.hpp"
 #include "duckdb/common/enums/debug_vector_verification.hpp"
 #include "duckdb/common/enums/window_aggregation_mode.hpp"
 #include "duckdb/common/enums/order_type.hpp"
 #include "duckdb/common/enums/output_type.hpp"
+#include "duckdb/common/enums/task_priority.hpp"
 #include "duckdb/common/enums/thread_pin_mode.hpp"
 #include "duckdb/common/enums/arrow_format_version.hpp"
 
@@ -236,6 +238,17 @@ struct AutoloadKnownExtensionsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BufferEvictionPolicySetting {
+	using RETURN_TYPE = BufferEvictionPolicy;
+	static constexpr const char *Name = "buffer_eviction_policy";
+	static constexpr const char *Description =
+	    "The policy with which persistent blocks are evicted from the buffer pool (LRU or TWO_QUEUE)";
+	static constexpr const char *InputType = "VARCHAR";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct CatalogErrorMaxSchemasSetting {
 	using RETURN_TYPE = idx_t;
 	static constexpr const char *Name = "catalog_error_max_schemas";
@@ -481,6 +494,16 @@ struct DuckDBAPISetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct DynamicBloomFilterThresholdSetting {
+	using RETURN_TYPE = idx_t;
+	static constexpr const char *Name = "dynamic_bloom_filter_threshold";
+	static constexpr const char *Description =
+	    "The maximum amount of build-side rows for which a hash join pushes a Bloom filter into its probe-side scans";
+	static constexpr const char *InputType = "UBIGINT";
+	static constexpr const char *DefaultValue = "16777216";
+	static constexpr SetScope DefaultScope = SetScope::SESSION;
+};
+
 struct DynamicOrFilterThresholdSetting {
 	using RETURN_TYPE = idx_t;
 	static constexpr const char *Name = "dynamic_or_filter_threshold";
@@ -609,6 +632,26 @@ struct EnableProgressBarPrintSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableQueryResultCacheSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "enable_query_result_cache";
+	static constexpr const char *Description =
+	    "Reuse the results of repeated read-only queries as long as the tables they scan are unchanged";
+	static constexpr const char *InputType = "BOOLEAN";
+	static constexpr const char *DefaultValue = "false";
+	static constexpr SetScope DefaultScope = SetScope::SESSION;
+};
+
+struct EnableTopNScanOrderSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "enable_top_n_scan_order";
+	static constexpr const char *Description =
+	    "Scan the row groups below a Top-N ordered by the statistics of its key, so that its filter prunes the rest";
+	static constexpr const char *InputType = "BOOLEAN";
+	static constexpr const char *DefaultValue = "true";
+	static constexpr SetScope DefaultScope = SetScope::SESSION;
+};
+
 struct EnableViewDependenciesSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "enable_view_dependencies";
@@ -919,6 +962,16 @@ struct MaxTempDirectorySizeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct MaxThreadsPerQuerySetting {
+	using RETURN_TYPE = idx_t;
+	static constexpr const char *Name = "max_threads_per_query";
+	static constexpr const char *Description =
+	    "The maximum amount of threads that execute the pipelines of a query at the same time (0 for no limit)";
+	static constexpr const char *InputType = "UBIGINT";
+	static constexpr const char *DefaultValue = "0";
+	static constexpr SetScope DefaultScope = SetScope::SESSION;
+};
+
 struct MaxVacuumTasksSetting {
 	using RETURN_TYPE = idx_t;
 	static constexpr const char *Name = "max_vacuum_tasks";
@@ -1046,6 +1099,17 @@ struct PivotLimitSetting {
 	static constexpr SetScope DefaultScope = SetScope::SESSION;
 };
 
+struct PlanCacheSizeSetting {
+	using RETURN_TYPE = idx_t;
+	static constexpr const char *Name = "plan_cache_size";
+	static constexpr const char *Description =
+	    "The maximum amount of optimized SELECT plans shared between the connections of the database (0 disables "
+	    "the plan cache). Plans with a Top-N (ORDER BY ... LIMIT) are not shared";
+	static constexpr const char *InputType = "UBIGINT";
+	static constexpr const char *DefaultValue = "0";
+	static constexpr SetScope DefaultScope = SetScope::GLOBAL;
+};
+
 struct PreferRangeJoinsSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "prefer_range_joins";
@@ -1202,6 +1266,17 @@ struct StreamingBufferSizeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TaskPrioritySetting {
+	using RETURN_TYPE = TaskPriority;
+	static constexpr const char *Name = "task_priority";
+	static constexpr const char *Description =
+	    "The priority with which the tasks of queries are scheduled (HIGH, NORMAL or LOW)";
+	static constexpr const char *InputType = "VARCHAR";
+	static constexpr const char *DefaultValue = "NORMAL";
+	static constexpr SetScope DefaultScope = SetScope::SESSION;
+	static void OnSet(SettingCallbackInfo &info, Value &input);
+};
+
 struct TempDirectorySetting {
 	using RETURN_TYPE = string;
 	static constexpr const char *Name = "temp_directory";
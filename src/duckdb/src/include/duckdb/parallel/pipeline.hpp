@@ -28,7 +28,9 @@ class PipelineTask : public ExecutorTask {
 	static constexpr const idx_t PARTIAL_CHUNK_COUNT = 50;
 
 public:
+	//! The task takes over one of the pipeline tasks reserved with Executor::ReservePipelineTasks
 	explicit PipelineTask(Pipeline &pipeline_p, shared_ptr<Event> event_p);
+	~PipelineTask() override;
 
 	Pipeline &pipeline;
 	unique_ptr<PipelineExecutor> pipeline_executor;
@@ -43,6 +45,10 @@ public:
 
 public:
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override;
+
+private:
+	//! Whether the task still counts towards the pipeline tasks of the executor
+	bool reserved = true;
 };
 
 class PipelineBuildState {
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/task_priority.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
@@ -25,11 +26,13 @@ class TaskScheduler;
 struct SchedulerThread;
 
 struct ProducerToken {
-	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
+	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token, TaskPriority priority);
 	~ProducerToken();
 
 	TaskScheduler &scheduler;
 	unique_ptr<QueueProducerToken> token;
+	//! The priority of all tasks scheduled through this token
+	TaskPriority priority;
 	mutex producer_lock;
 };
 
@@ -45,7 +48,7 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(ClientContext &context);
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
-	unique_ptr<ProducerToken> CreateProducer();
+	unique_ptr<ProducerToken> CreateProducer(TaskPriority priority = TaskPriority::NORMAL);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	void ScheduleTasks(ProducerToken &producer, vector<shared_ptr<Task>> &tasks);
@@ -94,7 +97,7 @@ private:
 
 private:
 	DatabaseInstance &db;
-	//! The task queue
+	//! The task queue, with a separate queue per task priority
 	unique_ptr<ConcurrentQueue> queue;
 	//! Lock for modifying the thread count
 	mutex thread_lock;
@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+
+namespace duckdb {
+class Vector;
+struct BloomFilterState;
+struct UnifiedVectorFormat;
+struct SelectionVector;
+
+//! A split block Bloom filter over 64-bit hashes: every key sets one bit in each of the eight 32-bit words of a
+//! single 256-bit block, so that inserting or probing a key touches a single cache line
+class BlockedBloomFilter {
+public:
+	explicit BlockedBloomFilter(idx_t key_count);
+
+	//! Bits reserved per inserted key, gives a false positive rate of about 0.5%
+	static constexpr idx_t BITS_PER_KEY = 16;
+
+public:
+	//! Inserts the (flat or constant) hash vector - not thread-safe
+	void Insert(Vector &hashes, idx_t count);
+	void Insert(hash_t hash) {
+		auto block = GetBlock(hash);
+		for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+			block[i] |= GetMask(hash, i);
+		}
+	}
+	//! Whether the key with this hash may have been inserted
+	bool Lookup(hash_t hash) const {
+		auto block = GetBlock(hash);
+		for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+			if (!(block[i] & GetMask(hash, i))) {
+				return false;
+			}
+		}
+		return true;
+	}
+	idx_t SizeInBytes() const {
+		return block_count * WORDS_PER_BLOCK * sizeof(uint32_t);
+	}
+
+private:
+	static constexpr idx_t WORDS_PER_BLOCK = 8;
+
+	uint32_t *GetBlock(hash_t hash) const {
+		// the upper half of the hash picks the block, the lower half the bits within it
+		auto block_idx = ((hash >> 32) * block_count) >> 32;
+		return blocks.get() + block_idx * WORDS_PER_BLOCK;
+	}
+	static uint32_t GetMask(hash_t hash, idx_t word_idx);
+
+	idx_t block_count;
+	unsafe_unique_array<uint32_t> blocks;
+};
+
+//! Removes tuples whose values are certainly not among the keys of a hash join build side. The filter is optional
+//! for correctness: tuples that pass it may still not have a join partner
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+
+public:
+	BloomFilter();
+	BloomFilter(shared_ptr<BlockedBloomFilter> filter, LogicalType key_type);
+
+	//! The filter shared by all scans it was pushed into, empty (letting everything pass) after deserialization
+	shared_ptr<BlockedBloomFilter> filter;
+	//! The type of the hashed keys
+	LogicalType key_type;
+
+public:
+	//! Whether keys of this type can be hashed and probed by the filter
+	static bool SupportsType(const LogicalType &type);
+
+	//! Refines sel to the tuples whose values may be in the filter, NULL values never are
+	idx_t Select(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count,
+	             BloomFilterState &state) const;
+	//! Whether a (non-NULL) constant of the key type may be in the filter
+	bool Lookup(const Value &value) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) const override;
+	string ToString(const string &column_name) const override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -45,6 +45,14 @@ public:
 	vector<unique_ptr<TableFilterState>> child_states;
 };
 
+struct BloomFilterState : public TableFilterState {
+public:
+	//! Tuples probed and tuples that passed, the filter is disabled once it turns out not to remove enough
+	idx_t probed_count = 0;
+	idx_t passed_count = 0;
+	bool disabled = false;
+};
+
 struct ExpressionFilterState : public TableFilterState {
 public:
 	ExpressionFilterState(ClientContext &context, const Expression &expression);
@@ -130,6 +130,20 @@ public:
 		return eviction_queue_idx;
 	}
 
+	//! Moves a persistent block between the probation (INVALID_INDEX) and the protected (0) eviction queue
+	void SetPersistentEvictionQueueIndex(const idx_t index) {
+		D_ASSERT(GetBufferType() == FileBufferType::BLOCK || GetBufferType() == FileBufferType::EXTERNAL_FILE);
+		eviction_queue_idx = index;
+	}
+
+	idx_t GetProbationInsertion() const {
+		return probation_insertion;
+	}
+
+	void SetProbationInsertion(const idx_t insertion) {
+		probation_insertion = insertion;
+	}
+
 	FileBufferType GetBufferType() const {
 		return buffer_type;
 	}
@@ -208,8 +222,11 @@ private:
 	BufferPoolReservation memory_charge;
 	//! Does the block contain any memory pointers?
 	const char *unswizzled;
-	//! Index for eviction queue (FileBufferType::MANAGED_BUFFER only, for now)
+	//! Index for eviction queue (FileBufferType::MANAGED_BUFFER, or persistent blocks under the 2Q policy)
 	atomic<idx_t> eviction_queue_idx;
+	//! Insertions into the probation queue when the block entered it, used to tell correlated re-references of a
+	//! persistent block (e.g., by the same scan) from re-references that promote it to the protected queue
+	atomic<idx_t> probation_insertion;
 };
 
 } // namespace duckdb
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/array.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -32,6 +33,16 @@ struct BufferEvictionNode {
 	shared_ptr<BlockHandle> TryGetBlockHandle();
 };
 
+//! Counters of the buffer pool since it was created
+struct BufferPoolStatistics {
+	//! Pins of blocks that were already loaded
+	idx_t hits = 0;
+	//! Pins of blocks that had to be loaded
+	idx_t misses = 0;
+	//! Blocks that were unloaded to make room for others
+	idx_t evictions = 0;
+};
+
 //! The BufferPool is in charge of handling memory management for one or more databases. It defines memory limits
 //! and implements priority eviction among all users of the pool.
 class BufferPool {
@@ -62,6 +73,14 @@ public:
 
 	TemporaryMemoryManager &GetTemporaryMemoryManager();
 
+	//! Set the policy with which persistent blocks are evicted
+	void SetEvictionPolicy(BufferEvictionPolicy policy);
+	BufferEvictionPolicy GetEvictionPolicy() const;
+
+	//! Count a pin of a block, which is a hit if the block was already loaded
+	void RecordPin(bool hit);
+	BufferPoolStatistics GetStatistics() const;
+
 protected:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
@@ -90,13 +109,21 @@ protected:
 	EvictionQueue &GetEvictionQueueForBlockHandle(const BlockHandle &handle);
 	//! Increments the dead nodes for the queue with specified type
 	void IncrementDeadNodes(const BlockHandle &handle);
+	//! Moves a persistent block between the probation and the protected queue according to the eviction policy
+	void UpdatePersistentEvictionQueue(BlockHandle &handle, idx_t eviction_seq_num);
+	//! Counts the eviction of a block, and returns it to probation if it was a protected persistent block
+	void RecordEviction(BlockHandle &handle);
 
 	//! How many eviction queue types we have (BLOCK and EXTERNAL_FILE go into same queue)
 	static constexpr idx_t EVICTION_QUEUE_TYPES = FILE_BUFFER_TYPE_COUNT - 1;
 	//! How many eviction queues we have for the different FileBufferTypes
-	static constexpr idx_t BLOCK_AND_EXTERNAL_FILE_QUEUE_SIZE = 1;
+	//! BLOCK and EXTERNAL_FILE have a probation queue, which is evicted first, and a protected queue (2Q policy)
+	static constexpr idx_t BLOCK_AND_EXTERNAL_FILE_QUEUE_SIZE = 2;
 	static constexpr idx_t MANAGED_BUFFER_QUEUE_SIZE = 6;
 	static constexpr idx_t TINY_BUFFER_QUEUE_SIZE = 1;
+	//! A persistent block that is re-used within this many insertions into the probation queue is not promoted to the
+	//! protected queue, as these re-uses are correlated (e.g., a scan pinning several segments of the same block)
+	static constexpr idx_t CORRELATED_REFERENCE_PERIOD = 1024;
 	//! Mapping and priority order for the eviction queues
 	const array<idx_t, EVICTION_QUEUE_TYPES> eviction_queue_sizes;
 
@@ -152,6 +179,12 @@ protected:
 	atomic<idx_t> allocator_bulk_deallocation_flush_threshold;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool track_eviction_timestamps;
+	//! The policy with which persistent blocks are evicted
+	atomic<BufferEvictionPolicy> eviction_policy;
+	//! Counters for duckdb_buffer_pool()
+	atomic<idx_t> pin_hits;
+	atomic<idx_t> pin_misses;
+	atomic<idx_t> evictions;
 	//! Eviction queues
 	vector<unique_ptr<EvictionQueue>> queues;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
@@ -85,6 +85,8 @@ public:
 	//! Returns the maximum amount of threads that should be assigned to scan this data table
 	idx_t MaxThreads(ClientContext &context) const;
 	void InitializeParallelScan(ClientContext &context, ParallelTableScanState &state);
+	//! Scans the row groups of the table (but not the transaction-local rows) ordered by the statistics of a column
+	void SetParallelScanOrder(ParallelTableScanState &state, PhysicalIndex column, OrderType order_type);
 	bool NextParallelScan(ClientContext &context, ParallelTableScanState &state, TableScanState &scan_state);
 
 	//! Scans up to STANDARD_VECTOR_SIZE elements from the table starting
@@ -211,6 +213,13 @@ public:
 	bool IsRoot() const {
 		return IsMainTable();
 	}
+	//! The commit id of the last transaction that changed the rows of this table
+	transaction_t GetLastCommitId() const {
+		return last_commit_id;
+	}
+	void SetLastCommitId(transaction_t commit_id) {
+		last_commit_id = commit_id;
+	}
 	string TableModification() const;
 
 	//! Get statistics of a physical column within the table
@@ -314,5 +323,7 @@ private:
 	shared_ptr<RowGroupCollection> row_groups;
 	//! The version of the data table
 	atomic<DataTableVersion> version;
+	//! The commit id of the last transaction that changed the rows of this table
+	atomic<transaction_t> last_commit_id;
 };
 } // namespace duckdb
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/expression_type.hpp"
+#include "duckdb/common/enums/order_type.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/types.hpp"
 #include "duckdb/common/types/value.hpp"
@@ -111,6 +112,12 @@ public:
 
 	idx_t GetDistinctCount();
 	static BaseStatistics FromConstant(const Value &input);
+	//! Returns the minimum (ASCENDING) or maximum (DESCENDING) of numeric or string statistics, or NULL if there is
+	//! none. Scans use it to read the row groups that most likely hold the first rows of an ordering first
+	Value GetOrderBoundary(OrderType order_type) const;
+	//! Whether the row group with the order boundary "left" should be scanned before the one with "right"; row groups
+	//! without a boundary are scanned last
+	static bool OrderBoundaryPrecedes(const Value &left, const Value &right, OrderType order_type);
 
 	template <class T>
 	void UpdateNumericStats(T new_value) {
@@ -52,6 +52,19 @@ public:
 	string GetTableName();
 	void SetTableName(string name);
 
+	//! Identifies this instance of the table: commit ids are only comparable within the same incarnation, as they
+	//! start over when the database is restarted
+	uint64_t GetIncarnation() const {
+		return incarnation;
+	}
+	//! The commit id of the last transaction that deleted or updated rows of the table, or 0 if none did
+	transaction_t GetLastDeleteOrUpdateCommitId() const {
+		return last_delete_or_update_commit_id;
+	}
+	void SetLastDeleteOrUpdateCommitId(transaction_t commit_id) {
+		last_delete_or_update_commit_id = commit_id;
+	}
+
 private:
 	//! The database instance of the table
 	AttachedDatabase &db;
@@ -69,6 +82,10 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! A random identifier of this instance of the table
+	uint64_t incarnation;
+	//! The commit id of the last transaction that deleted or updated rows of the table
+	atomic<transaction_t> last_delete_or_update_commit_id;
 };
 
 } // namespace duckdb
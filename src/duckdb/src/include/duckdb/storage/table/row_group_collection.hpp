@@ -69,6 +69,8 @@ public:
 	static bool InitializeScanInRowGroup(CollectionScanState &state, RowGroupCollection &collection,
 	                                     RowGroup &row_group, idx_t vector_index, idx_t max_row);
 	void InitializeParallelScan(ParallelCollectionScanState &state);
+	//! Scans the row groups ordered by their minimum (ASCENDING) or maximum (DESCENDING) of a column instead
+	void SetParallelScanOrder(ParallelCollectionScanState &state, PhysicalIndex column, OrderType order_type);
 	bool NextParallelScan(ClientContext &context, ParallelCollectionScanState &state, CollectionScanState &scan_state);
 
 	bool Scan(DuckTransaction &transaction, const vector<StorageIndex> &column_ids,
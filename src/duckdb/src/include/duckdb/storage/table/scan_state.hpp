@@ -276,6 +276,9 @@ struct ParallelCollectionScanState {
 	//! The row group collection we are scanning
 	RowGroupCollection *collection;
 	RowGroup *current_row_group;
+	//! (Optionally) the order in which the row groups are scanned, instead of the order in which they are stored
+	vector<RowGroup *> row_group_order;
+	idx_t row_group_order_index;
 	idx_t vector_index;
 	idx_t max_row;
 	idx_t batch_index;
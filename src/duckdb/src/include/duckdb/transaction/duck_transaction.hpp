@@ -91,7 +91,7 @@ public:
 	shared_ptr<CheckpointLock> SharedLockTable(DataTableInfo &info);
 
 	//! Hold an owning reference of the table, needed to safely reference it inside the transaction commit/undo logic
-	void ModifyTable(DataTable &tbl);
+	void ModifyTable(DataTable &tbl, bool deletes_or_updates_rows = false);
 
 private:
 	DuckTransactionManager &transaction_manager;
@@ -110,6 +110,8 @@ private:
 	mutex modified_tables_lock;
 	//! Tables that are modified by this transaction
 	reference_map_t<DataTable, shared_ptr<DataTable>> modified_tables;
+	//! The modified tables of which this transaction deleted or updated rows
+	reference_set_t<DataTable> delete_or_update_tables;
 	//! Lock for the active_locks map
 	mutex active_locks_lock;
 	struct ActiveTableLock {
@@ -20,7 +20,9 @@
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/relation.hpp"
 #include "duckdb/main/stream_query_result.hpp"
@@ -64,6 +66,8 @@ public:
 	unique_ptr<Executor> executor;
 	//! The progress bar
 	unique_ptr<ProgressBar> progress_bar;
+	//! The key under which the result is stored in the query result cache (if any)
+	string result_cache_key;
 
 public:
 	void SetOpenResult(BaseQueryResult &result) {
@@ -339,6 +343,15 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 	// we have a result collector - fetch the result directly from the result collector
 	result = executor.GetResult();
 	if (!create_stream_result) {
+		if (!active_query->result_cache_key.empty() && result->type == QueryResultType::MATERIALIZED_RESULT &&
+		    !result->HasError()) {
+			auto &collection = result->Cast<MaterializedQueryResult>().Collection();
+			try {
+				QueryResultCache::Get(*this).Store(*this, active_query->result_cache_key, prepared, collection);
+			} catch (std::exception &) {
+				// caching the result is best-effort (e.g. the memory limit may not leave room for a copy)
+			}
+		}
 		CleanupInternal(lock, result.get(), false);
 	} else {
 		active_query->SetOpenResult(*result);
@@ -367,40 +380,65 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 	auto &profiler = QueryProfiler::Get(*this);
 	profiler.StartQuery(query, IsExplainAnalyze(statement.get()), true);
 	profiler.StartPhase(MetricsType::PLANNER);
-	Planner logical_planner(*this);
-	if (values) {
-		auto &parameter_values = *values;
-		for (auto &value : parameter_values) {
-			logical_planner.parameter_data.emplace(value.first, BoundParameterData(value.second));
+	// the normalized statement identifies the result of the query in the query result cache
+	string result_cache_key;
+	if (statement_type == StatementType::SELECT_STATEMENT &&
+	    DBConfig::GetSetting<EnableQueryResultCacheSetting>(*this)) {
+		result_cache_key = statement->ToString();
+	}
+	// statements prepared without parameter values can reuse the plan another connection already optimized
+	string plan_cache_key;
+	if (!values || values->empty()) {
+		plan_cache_key = PlanCache::GetKey(*this, *statement);
+	}
+	unique_ptr<LogicalOperator> logical_plan;
+	if (!plan_cache_key.empty()) {
+		logical_plan = PlanCache::Get(*this).Lookup(*this, plan_cache_key, *result);
+	}
+	if (!logical_plan) {
+		Planner logical_planner(*this);
+		if (values) {
+			auto &parameter_values = *values;
+			for (auto &value : parameter_values) {
+				logical_planner.parameter_data.emplace(value.first, BoundParameterData(value.second));
+			}
 		}
-	}
 
-	logical_planner.CreatePlan(std::move(statement));
-	D_ASSERT(logical_planner.plan || !logical_planner.properties.bound_all_parameters);
-	profiler.EndPhase();
+		logical_planner.CreatePlan(std::move(statement));
+		D_ASSERT(logical_planner.plan || !logical_planner.properties.bound_all_parameters);
+		profiler.EndPhase();
 
-	auto logical_plan = std::move(logical_planner.plan);
-	// extract the result column names from the plan
-	result->properties = logical_planner.properties;
-	result->names = logical_planner.names;
-	result->types = logical_planner.types;
-	result->value_map = std::move(logical_planner.value_map);
-	if (!logical_planner.properties.bound_all_parameters) {
-		return result;
-	}
+		logical_plan = std::move(logical_planner.plan);
+		// extract the result column names from the plan
+		result->properties = logical_planner.properties;
+		result->names = logical_planner.names;
+		result->types = logical_planner.types;
+		result->value_map = std::move(logical_planner.value_map);
+		if (!logical_planner.properties.bound_all_parameters) {
+			return result;
+		}
 #ifdef DEBUG
-	logical_plan->Verify(*this);
+		logical_plan->Verify(*this);
 #endif
-	if (config.enable_optimizer && logical_plan->RequireOptimizer()) {
-		profiler.StartPhase(MetricsType::ALL_OPTIMIZERS);
-		Optimizer optimizer(*logical_planner.binder, *this);
-		logical_plan = optimizer.Optimize(std::move(logical_plan));
-		D_ASSERT(logical_plan);
-		profiler.EndPhase();
+		if (config.enable_optimizer && logical_plan->RequireOptimizer()) {
+			profiler.StartPhase(MetricsType::ALL_OPTIMIZERS);
+			Optimizer optimizer(*logical_planner.binder, *this);
+			logical_plan = optimizer.Optimize(std::move(logical_plan));
+			D_ASSERT(logical_plan);
+			profiler.EndPhase();
 
 #ifdef DEBUG
-		logical_plan->Verify(*this);
+			logical_plan->Verify(*this);
 #endif
+		}
+		if (!plan_cache_key.empty()) {
+			PlanCache::Get(*this).Store(*this, plan_cache_key, logical_plan, *result);
+		}
+	} else {
+		profiler.EndPhase();
+	}
+	if (!result_cache_key.empty()) {
+		QueryResultCache::PrepareStatement(*this, std::move(result_cache_key), *logical_plan, *result);
 	}
 
 	// Convert the logical query plan into a physical query plan.
@@ -519,6 +557,28 @@ ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock,
                                                 shared_ptr<PreparedStatementData> statement_data_p,
                                                 const PendingQueryParameters &parameters) {
 	D_ASSERT(active_query);
+	auto &result_cache = QueryResultCache::Get(*this);
+	if (statement_data_p->statement_type == StatementType::SET_STATEMENT ||
+	    statement_data_p->statement_type == StatementType::VARIABLE_SET_STATEMENT) {
+		// settings and variables can change the results and plans of queries that are otherwise unchanged
+		result_cache.Clear();
+		auto &unbound_statement = statement_data_p->unbound_statement;
+		if (unbound_statement && unbound_statement->type == StatementType::SET_STATEMENT) {
+			PlanCache::Get(*this).SettingChanged(*this, *unbound_statement);
+		} else {
+			PlanCache::Get(*this).Clear();
+		}
+	}
+	auto result_cache_key = QueryResultCache::GetKey(*this, *statement_data_p, parameters);
+	if (!result_cache_key.empty()) {
+		auto cached_result = result_cache.Lookup(*this, result_cache_key, *statement_data_p);
+		if (cached_result) {
+			// none of the scanned tables changed: scan the cached result instead of executing the query
+			statement_data_p = QueryResultCache::CreateCachedPlan(*this, *statement_data_p, std::move(cached_result));
+			result_cache_key.clear();
+		}
+	}
+	active_query->result_cache_key = std::move(result_cache_key);
 	auto &statement_data = *statement_data_p;
 	BindPreparedStatementParameters(statement_data, parameters);
 
@@ -0,0 +1,280 @@
+#include "duckdb/main/plan_cache.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_context_state.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/main/settings.hpp"
+#include "duckdb/optimizer/join_filter_pushdown_optimizer.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/parser/sql_statement.hpp"
+#include "duckdb/parser/statement/set_statement.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_parameter_data.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
+#include "duckdb/transaction/transaction.hpp"
+
+namespace duckdb {
+
+PlanCache &PlanCache::Get(ClientContext &context) {
+	return DatabaseInstance::GetDatabase(context).GetPlanCache();
+}
+
+//! The settings a connection changed that are kept in fields of its client config rather than in its set_variables
+class PlanCacheLocalSettings : public ClientContextState {
+public:
+	static constexpr const char *NAME = "plan_cache_local_settings";
+
+	case_insensitive_set_t names;
+};
+
+string PlanCache::GetKey(ClientContext &context, SQLStatement &statement) {
+	if (statement.type != StatementType::SELECT_STATEMENT || DBConfig::GetSetting<PlanCacheSizeSetting>(context) == 0) {
+		return string();
+	}
+	// temporary objects are private to a connection and can shadow the tables the other connections bind to
+	auto &temporary_objects = ClientData::Get(context).temporary_objects;
+	auto temporary_version = temporary_objects->GetCatalog().GetCatalogVersion(context);
+	if (!temporary_version.IsValid() || temporary_version.GetIndex() != 0) {
+		return string();
+	}
+	// the plan depends on the search path and the settings of the connection, besides the statement itself
+	auto key = statement.ToString();
+	key += "\n" + DatabaseManager::GetDefaultDatabase(context);
+	key += "\n" + CatalogSearchEntry::ListToString(ClientData::Get(context).catalog_search_path->Get());
+	vector<string> setting_keys;
+	for (auto &entry : ClientConfig::GetConfig(context).set_variables) {
+		setting_keys.push_back(entry.first + "=" + entry.second.ToSQLString());
+	}
+	// getvariable() is bound to the value of the variable, which is folded into the plan
+	for (auto &entry : ClientConfig::GetConfig(context).user_variables) {
+		setting_keys.push_back("getvariable('" + entry.first + "')=" + entry.second.ToSQLString());
+	}
+	auto local_settings = context.registered_state->Get<PlanCacheLocalSettings>(PlanCacheLocalSettings::NAME);
+	if (local_settings) {
+		for (auto &name : local_settings->names) {
+			auto option = DBConfig::GetOptionByName(name);
+			setting_keys.push_back(name + "=" + option->get_setting(context).ToSQLString());
+		}
+	}
+	std::sort(setting_keys.begin(), setting_keys.end());
+	for (auto &setting_key : setting_keys) {
+		key += "\n" + setting_key;
+	}
+	return key;
+}
+
+static bool IsCurrentCatalog(ClientContext &context, const string &name,
+                             const StatementProperties::CatalogIdentity &identity) {
+	auto database = DatabaseManager::Get(context).GetDatabase(context, name);
+	if (!database) {
+		return false;
+	}
+	Transaction::Get(context, *database);
+	auto &catalog = database->GetCatalog();
+	return StatementProperties::CatalogIdentity {catalog.GetOid(), catalog.GetCatalogVersion(context)} == identity;
+}
+
+static bool SupportsSerialization(LogicalOperator &op) {
+	for (auto &child : op.children) {
+		if (!SupportsSerialization(*child)) {
+			return false;
+		}
+	}
+	return op.SupportSerialization();
+}
+
+//! The filter a Top-N pushes into the scans below it is updated at runtime through state that is not serialized, so
+//! a deserialized copy of the plan would not filter anything
+static bool HasDynamicFilters(LogicalOperator &op) {
+	for (auto &child : op.children) {
+		if (HasDynamicFilters(*child)) {
+			return true;
+		}
+	}
+	return op.type == LogicalOperatorType::LOGICAL_TOP_N && op.Cast<LogicalTopN>().dynamic_filter;
+}
+
+//! Join filter pushdown links a join with the scans it filters through state that is not serialized either. Unlike
+//! the filter of a Top-N, it is only derived from the join conditions, so it is set up again on every deserialized
+//! copy of a plan the way the optimizer set it up on the original
+static void PushdownJoinFilters(ClientContext &context, LogicalOperator &plan) {
+	if (!ClientConfig::GetConfig(context).enable_optimizer ||
+	    Optimizer::OptimizerDisabled(context, OptimizerType::JOIN_FILTER_PUSHDOWN)) {
+		return;
+	}
+	auto binder = Binder::CreateBinder(context);
+	Optimizer optimizer(*binder, context);
+	JoinFilterPushdownOptimizer join_filter_pushdown(optimizer);
+	join_filter_pushdown.VisitOperator(plan);
+}
+
+unique_ptr<LogicalOperator> PlanCache::Lookup(ClientContext &context, const string &key,
+                                              PreparedStatementData &statement) {
+	shared_ptr<CachedPlan> plan;
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = entries.find(key);
+		if (entry == entries.end()) {
+			misses++;
+			return nullptr;
+		}
+		lru.splice(lru.begin(), lru, entry->second.lru_position);
+		plan = entry->second.plan;
+	}
+	for (auto &entry : plan->properties.read_databases) {
+		if (!IsCurrentCatalog(context, entry.first, entry.second)) {
+			// the catalog changed since: the plan is replaced once the statement has been planned again
+			misses++;
+			return nullptr;
+		}
+	}
+	MemoryStream stream(plan->serialized_plan.get(), plan->serialized_size);
+	bound_parameter_map_t parameters;
+	unique_ptr<LogicalOperator> result;
+	try {
+		result = BinaryDeserializer::Deserialize<LogicalOperator>(stream, context, parameters);
+		PushdownJoinFilters(context, *result);
+	} catch (std::exception &) {
+		// planning the statement from scratch reports any error
+		misses++;
+		return nullptr;
+	}
+	for (auto &entry : plan->parameter_types) {
+		if (parameters.find(entry.first) == parameters.end()) {
+			auto parameter_data = make_shared_ptr<BoundParameterData>();
+			parameter_data->return_type = entry.second;
+			parameters.emplace(entry.first, std::move(parameter_data));
+		}
+	}
+	statement.names = plan->names;
+	statement.types = plan->types;
+	statement.properties = plan->properties;
+	statement.value_map = std::move(parameters);
+	hits++;
+	return result;
+}
+
+void PlanCache::Store(ClientContext &context, const string &key, unique_ptr<LogicalOperator> &plan,
+                      PreparedStatementData &statement) {
+	auto &properties = statement.properties;
+	if (!properties.IsReadOnly() || properties.always_require_rebind || !properties.bound_all_parameters) {
+		return;
+	}
+	for (auto &entry : properties.read_databases) {
+		if (!entry.second.catalog_version.IsValid()) {
+			// without a catalog version there is no way to tell whether the plan is still current
+			return;
+		}
+	}
+	if (!SupportsSerialization(*plan) || HasDynamicFilters(*plan)) {
+		return;
+	}
+	MemoryStream stream(Allocator::Get(context));
+	bound_parameter_map_t parameters;
+	unique_ptr<LogicalOperator> plan_copy;
+	try {
+		SerializationOptions options;
+		options.serialization_compatibility = SerializationCompatibility::Latest();
+		BinarySerializer::Serialize(*plan, stream, options);
+		MemoryStream reader(stream.GetData(), stream.GetPosition());
+		plan_copy = BinaryDeserializer::Deserialize<LogicalOperator>(reader, context, parameters);
+		PushdownJoinFilters(context, *plan_copy);
+	} catch (std::exception &) {
+		// not all operators, functions and their bind data can be serialized
+		return;
+	}
+
+	auto cached_plan = make_shared_ptr<CachedPlan>();
+	cached_plan->serialized_size = stream.GetPosition();
+	cached_plan->serialized_plan = make_unsafe_uniq_array_uninitialized<data_t>(cached_plan->serialized_size);
+	memcpy(cached_plan->serialized_plan.get(), stream.GetData(), cached_plan->serialized_size);
+	cached_plan->names = statement.names;
+	cached_plan->types = statement.types;
+	cached_plan->properties = properties;
+	for (auto &entry : statement.value_map) {
+		cached_plan->parameter_types.emplace(entry.first, entry.second->return_type);
+		parameters.emplace(entry.first, entry.second);
+	}
+	plan = std::move(plan_copy);
+	statement.value_map = std::move(parameters);
+
+	auto max_entries = DBConfig::GetSetting<PlanCacheSizeSetting>(context);
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(key);
+	if (entry != entries.end()) {
+		lru.erase(entry->second.lru_position);
+		entries.erase(entry);
+	}
+	while (!entries.empty() && entries.size() >= max_entries) {
+		entries.erase(lru.back());
+		lru.pop_back();
+	}
+	lru.push_front(key);
+	CacheEntry new_entry;
+	new_entry.plan = std::move(cached_plan);
+	new_entry.lru_position = lru.begin();
+	entries.emplace(key, std::move(new_entry));
+}
+
+void PlanCache::SettingChanged(ClientContext &context, SQLStatement &statement) {
+	auto &set = statement.Cast<SetStatement>();
+	auto scope = set.scope;
+	if (scope == SetScope::VARIABLE) {
+		return;
+	}
+	// resolve the scope the way PhysicalSet and PhysicalReset do
+	auto option = DBConfig::GetOptionByName(set.name);
+	if (option) {
+		if (scope == SetScope::AUTOMATIC) {
+			if (option->set_local) {
+				scope = SetScope::SESSION;
+			} else if (option->set_global) {
+				scope = SetScope::GLOBAL;
+			} else {
+				scope = option->default_scope;
+			}
+		}
+		if (scope == SetScope::SESSION && option->set_local && option->get_setting) {
+			// not in set_variables: the key includes the value of the setting from now on
+			auto local_settings =
+			    context.registered_state->GetOrCreate<PlanCacheLocalSettings>(PlanCacheLocalSettings::NAME);
+			local_settings->names.insert(option->name);
+			return;
+		}
+	} else if (scope == SetScope::AUTOMATIC) {
+		auto &extension_parameters = DBConfig::GetConfig(context).extension_parameters;
+		auto entry = extension_parameters.find(set.name);
+		// the setting of an extension that is not loaded yet may be global
+		scope = entry == extension_parameters.end() ? SetScope::GLOBAL : entry->second.default_scope;
+	}
+	if (scope == SetScope::GLOBAL) {
+		Clear();
+	}
+}
+
+void PlanCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	entries.clear();
+	lru.clear();
+}
+
+PlanCacheStatistics PlanCache::GetStatistics() {
+	PlanCacheStatistics result;
+	result.hits = hits;
+	result.misses = misses;
+	lock_guard<mutex> guard(lock);
+	result.entries = entries.size();
+	return result;
+}
+
+} // namespace duckdb
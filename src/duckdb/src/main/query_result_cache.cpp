@@ -0,0 +1,222 @@
+#include "duckdb/main/query_result_cache.hpp"
+
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/main/settings.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/meta_transaction.hpp"
+
+namespace duckdb {
+
+//! Collects the tables scanned by a plan, and whether its result only depends on the contents of these tables
+class ResultCacheTableCollector : public LogicalOperatorVisitor {
+public:
+	void VisitOperator(LogicalOperator &op) override {
+		switch (op.type) {
+		case LogicalOperatorType::LOGICAL_GET: {
+			auto &get = op.Cast<LogicalGet>();
+			auto table = get.GetTable();
+			if (!table || !table->IsDuckTable()) {
+				// table functions (reading files, generating rows, ...) are not versioned
+				cacheable = false;
+				break;
+			}
+			tables.push_back(table->GetStorage().shared_from_this());
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_SAMPLE:
+			cacheable = false;
+			break;
+		default:
+			break;
+		}
+		LogicalOperatorVisitor::VisitOperator(op);
+	}
+
+	void VisitExpression(unique_ptr<Expression> *expression) override {
+		if ((*expression)->IsVolatile()) {
+			cacheable = false;
+		}
+	}
+
+	vector<weak_ptr<DataTable>> tables;
+	bool cacheable = true;
+};
+
+QueryResultCache &QueryResultCache::Get(ClientContext &context) {
+	return *ClientData::Get(context).query_result_cache;
+}
+
+void QueryResultCache::PrepareStatement(ClientContext &context, string statement_key, LogicalOperator &plan,
+                                        PreparedStatementData &statement) {
+	auto &properties = statement.properties;
+	if (!properties.IsReadOnly() || properties.return_type != StatementReturnType::QUERY_RESULT) {
+		return;
+	}
+	ResultCacheTableCollector collector;
+	collector.VisitOperator(plan);
+	if (!collector.cacheable) {
+		return;
+	}
+	// a change to the catalog (e.g. replacing a view) changes the result without touching the scanned tables
+	vector<string> database_keys;
+	for (auto &entry : properties.read_databases) {
+		auto &identity = entry.second;
+		database_keys.push_back(StringUtil::Format(
+		    "%s:%llu:%s", entry.first, identity.catalog_oid,
+		    identity.catalog_version.IsValid() ? to_string(identity.catalog_version.GetIndex()) : "-"));
+	}
+	std::sort(database_keys.begin(), database_keys.end());
+	for (auto &database_key : database_keys) {
+		statement_key += "\n" + database_key;
+	}
+	statement.result_cache_key = std::move(statement_key);
+	statement.result_cache_tables = std::move(collector.tables);
+}
+
+string QueryResultCache::GetKey(ClientContext &context, PreparedStatementData &statement,
+                                const PendingQueryParameters &parameters) {
+	if (statement.result_cache_key.empty() || statement.properties.always_require_rebind ||
+	    !DBConfig::GetSetting<EnableQueryResultCacheSetting>(context)) {
+		return string();
+	}
+	if (MetaTransaction::Get(context).ModifiedDatabase()) {
+		// the transaction sees its own uncommitted changes, which are not reflected by the table versions
+		return string();
+	}
+	auto key = statement.result_cache_key;
+	if (parameters.parameters) {
+		vector<string> parameter_keys;
+		for (auto &entry : *parameters.parameters) {
+			parameter_keys.push_back("$" + entry.first + "=" + entry.second.GetValue().ToSQLString());
+		}
+		std::sort(parameter_keys.begin(), parameter_keys.end());
+		for (auto &parameter_key : parameter_keys) {
+			key += "\n" + parameter_key;
+		}
+	}
+	return key;
+}
+
+shared_ptr<PreparedStatementData> QueryResultCache::CreateCachedPlan(ClientContext &context,
+                                                                     PreparedStatementData &statement,
+                                                                     shared_ptr<ColumnDataCollection> result) {
+	auto cached = make_shared_ptr<PreparedStatementData>(statement.statement_type);
+	cached->names = statement.names;
+	cached->types = statement.types;
+	cached->properties = statement.properties;
+	cached->physical_plan = make_uniq<PhysicalPlan>(Allocator::Get(context));
+	auto count = result->Count();
+	auto &scan = cached->physical_plan->Make<PhysicalColumnDataScan>(
+	    statement.types, PhysicalOperatorType::COLUMN_DATA_SCAN, count,
+	    optionally_owned_ptr<ColumnDataCollection>(std::move(result)));
+	cached->physical_plan->SetRoot(scan);
+	return cached;
+}
+
+bool QueryResultCache::IsValid(ClientContext &context, const CacheEntry &entry, PreparedStatementData &statement) {
+	if (entry.tables.size() != statement.result_cache_tables.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < entry.tables.size(); i++) {
+		auto table = entry.tables[i].lock();
+		if (!table || table != statement.result_cache_tables[i].lock()) {
+			// the statement was bound to different tables, e.g. after changing the search path
+			return false;
+		}
+		// the table must not have changed since, and its last change must be visible to this transaction
+		auto &transaction = DuckTransaction::Get(context, table->db);
+		if (table->GetLastCommitId() != entry.table_versions[i] || entry.table_versions[i] >= transaction.start_time) {
+			return false;
+		}
+	}
+	return true;
+}
+
+shared_ptr<ColumnDataCollection> QueryResultCache::Lookup(ClientContext &context, const string &key,
+                                                          PreparedStatementData &statement) {
+	auto entry = entries.find(key);
+	if (entry == entries.end()) {
+		misses++;
+		return nullptr;
+	}
+	if (!IsValid(context, entry->second, statement)) {
+		Erase(entry);
+		misses++;
+		return nullptr;
+	}
+	lru.splice(lru.begin(), lru, entry->second.lru_position);
+	hits++;
+	return entry->second.result;
+}
+
+void QueryResultCache::Store(ClientContext &context, const string &key, PreparedStatementData &statement,
+                             ColumnDataCollection &result) {
+	if (result.Count() > MAX_ROWS) {
+		return;
+	}
+	CacheEntry new_entry;
+	for (auto &table_ref : statement.result_cache_tables) {
+		auto table = table_ref.lock();
+		if (!table) {
+			return;
+		}
+		auto version = table->GetLastCommitId();
+		if (version >= DuckTransaction::Get(context, table->db).start_time) {
+			// a transaction that started after this one changed the table: the result is already out of date
+			return;
+		}
+		new_entry.tables.push_back(table);
+		new_entry.table_versions.push_back(version);
+	}
+	// copy the result into buffer-managed memory, so that cached results count towards the memory limit
+	new_entry.result = make_shared_ptr<ColumnDataCollection>(BufferManager::GetBufferManager(context), result.Types());
+	ColumnDataAppendState append_state;
+	new_entry.result->InitializeAppend(append_state);
+	for (auto &chunk : result.Chunks()) {
+		new_entry.result->Append(append_state, chunk);
+	}
+
+	auto entry = entries.find(key);
+	if (entry != entries.end()) {
+		Erase(entry);
+	}
+	while (entries.size() >= MAX_ENTRIES) {
+		Erase(entries.find(lru.back()));
+	}
+	cached_rows += new_entry.result->Count();
+	lru.push_front(key);
+	new_entry.lru_position = lru.begin();
+	entries.emplace(key, std::move(new_entry));
+}
+
+void QueryResultCache::Erase(unordered_map<string, CacheEntry>::iterator entry) {
+	cached_rows -= entry->second.result->Count();
+	lru.erase(entry->second.lru_position);
+	entries.erase(entry);
+}
+
+void QueryResultCache::Clear() {
+	entries.clear();
+	lru.clear();
+	cached_rows = 0;
+}
+
+QueryResultCacheStatistics QueryResultCache::GetStatistics() {
+	QueryResultCacheStatistics result;
+	result.hits = hits;
+	result.misses = misses;
+	result.entries = entries.size();
+	result.cached_rows = cached_rows;
+	return result;
+}
+
+} // namespace duckdb
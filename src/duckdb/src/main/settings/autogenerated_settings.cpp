@@ -528,6 +528,13 @@ Value SchedulerProcessPartialSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.scheduler_process_partial);
 }
 
+//===----------------------------------------------------------------------===//
+// Task Priority
+//===----------------------------------------------------------------------===//
+void TaskPrioritySetting::OnSet(SettingCallbackInfo &info, Value &parameter) {
+	EnumUtil::FromString<TaskPriority>(StringValue::Get(parameter));
+}
+
 //===----------------------------------------------------------------------===//
 // Zstd Min String Length
 //===----------------------------------------------------------------------===//
@@ -285,6 +285,29 @@ Value AllowedPathsSetting::GetSetting(const ClientContext &context) {
 	return Value::LIST(LogicalType::VARCHAR, std::move(allowed_paths));
 }
 
+//===----------------------------------------------------------------------===//
+// Buffer Eviction Policy
+//===----------------------------------------------------------------------===//
+void BufferEvictionPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto str_input = StringUtil::Upper(input.GetValue<string>());
+	config.options.buffer_eviction_policy = EnumUtil::FromString<BufferEvictionPolicy>(str_input);
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+void BufferEvictionPolicySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.buffer_eviction_policy = DBConfigOptions().buffer_eviction_policy;
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+Value BufferEvictionPolicySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::Lower(EnumUtil::ToString(config.options.buffer_eviction_policy)));
+}
+
 //===----------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===----------------------------------------------------------------------===//
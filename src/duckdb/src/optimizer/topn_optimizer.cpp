@@ -11,6 +11,7 @@
 #include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
 #include "duckdb/optimizer/join_filter_pushdown_optimizer.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/main/settings.hpp"
 
 namespace duckdb {
 
@@ -58,6 +59,19 @@ bool TopN::CanOptimize(LogicalOperator &op, optional_ptr<ClientContext> context)
 	return false;
 }
 
+//! Returns the scan below the Top-N if there are only projections and filters in between, i.e. if the order in which
+//! the scan produces its rows does not affect the result
+static optional_ptr<LogicalGet> GetReorderableScan(LogicalOperator &op) {
+	auto child = &op;
+	while (child->type == LogicalOperatorType::LOGICAL_PROJECTION || child->type == LogicalOperatorType::LOGICAL_FILTER) {
+		child = child->children[0].get();
+	}
+	if (child->type != LogicalOperatorType::LOGICAL_GET) {
+		return nullptr;
+	}
+	return &child->Cast<LogicalGet>();
+}
+
 void TopN::PushdownDynamicFilters(LogicalTopN &op) {
 	// pushdown dynamic filters through the Top-N operator
 	if (op.orders[0].null_order == OrderByNullType::NULLS_FIRST) {
@@ -110,6 +124,11 @@ void TopN::PushdownDynamicFilters(LogicalTopN &op) {
 	// put the filter into the Top-N clause
 	op.dynamic_filter = filter_data;
 
+	auto reorderable_scan = GetReorderableScan(*op.children[0]);
+	if (!DBConfig::GetSetting<EnableTopNScanOrderSetting>(context)) {
+		reorderable_scan = nullptr;
+	}
+
 	for (auto &target : pushdown_targets) {
 		auto &get = target.get;
 		D_ASSERT(target.columns.size() == 1);
@@ -122,6 +141,12 @@ void TopN::PushdownDynamicFilters(LogicalTopN &op) {
 		// push the filter into the table scan
 		auto &column_index = get.GetColumnIds()[col_idx];
 		get.table_filters.PushFilter(column_index, std::move(optional_filter));
+
+		if (reorderable_scan.get() == &get && !column_index.IsVirtualColumn()) {
+			// scan the row groups most likely to hold the top rows first, so that the filter prunes the others
+			get.extra_info.scan_order_column = column_index.GetPrimaryIndex();
+			get.extra_info.scan_order_type = op.orders[0].type;
+		}
 	}
 }
 
@@ -8,6 +8,7 @@
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/main/settings.hpp"
 #include "duckdb/parallel/meta_pipeline.hpp"
 #include "duckdb/parallel/pipeline_complete_event.hpp"
 #include "duckdb/parallel/pipeline_event.hpp"
@@ -23,7 +24,8 @@
 
 namespace duckdb {
 
-Executor::Executor(ClientContext &context) : context(context), executor_tasks(0), blocked_thread_time(0) {
+Executor::Executor(ClientContext &context)
+    : context(context), executor_tasks(0), pipeline_tasks(0), blocked_thread_time(0) {
 }
 
 Executor::~Executor() {
@@ -34,6 +36,21 @@ Executor &Executor::Get(ClientContext &context) {
 	return context.GetExecutor();
 }
 
+idx_t Executor::ReservePipelineTasks(idx_t max_tasks) {
+	max_tasks = MaxValue<idx_t>(max_tasks, 1);
+	auto max_threads_per_query = DBConfig::GetSetting<MaxThreadsPerQuerySetting>(context);
+	if (max_threads_per_query == 0) {
+		pipeline_tasks += max_tasks;
+		return max_tasks;
+	}
+	auto current = pipeline_tasks.load();
+	idx_t reserved;
+	do {
+		reserved = current < max_threads_per_query ? MinValue(max_tasks, max_threads_per_query - current) : 1;
+	} while (!pipeline_tasks.compare_exchange_weak(current, current + reserved));
+	return reserved;
+}
+
 void Executor::AddEvent(shared_ptr<Event> event) {
 	lock_guard<mutex> elock(executor_lock);
 	if (cancelled) {
@@ -387,7 +404,7 @@ void Executor::InitializeInternal(PhysicalOperator &plan) {
 
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
-		this->producer = scheduler.CreateProducer();
+		this->producer = scheduler.CreateProducer(DBConfig::GetSetting<TaskPrioritySetting>(context));
 
 		// build and ready the pipelines
 		PipelineBuildState state;
@@ -20,6 +20,12 @@ PipelineTask::PipelineTask(Pipeline &pipeline_p, shared_ptr<Event> event_p)
     : ExecutorTask(pipeline_p.executor, std::move(event_p)), pipeline(pipeline_p) {
 }
 
+PipelineTask::~PipelineTask() {
+	if (reserved) {
+		executor.ReleasePipelineTask();
+	}
+}
+
 bool PipelineTask::TaskBlockedOnResult() const {
 	// If this returns true, it means the pipeline this task belongs to has a cached chunk
 	// that was the result of the Sink method returning BLOCKED
@@ -62,6 +68,8 @@ TaskExecutionResult PipelineTask::ExecuteTask(TaskExecutionMode mode) {
 
 	event->FinishTask();
 	pipeline_executor.reset();
+	executor.ReleasePipelineTask();
+	reserved = false;
 	return TaskExecutionResult::TASK_FINISHED;
 }
 
@@ -93,6 +101,7 @@ bool Pipeline::GetProgress(ProgressData &progress) {
 }
 
 void Pipeline::ScheduleSequentialTask(shared_ptr<Event> &event) {
+	executor.ReservePipelineTasks(1);
 	vector<shared_ptr<Task>> tasks;
 	tasks.push_back(make_uniq<PipelineTask>(*this, event));
 	event->SetTasks(std::move(tasks));
@@ -131,7 +140,16 @@ bool Pipeline::ScheduleParallel(shared_ptr<Event> &event) {
 	if (max_threads > active_threads) {
 		max_threads = active_threads;
 	}
-	return LaunchScanTasks(event, max_threads);
+	if (max_threads <= 1) {
+		return false;
+	}
+	// stay within max_threads_per_query together with the pipelines of the query that are running already
+	max_threads = executor.ReservePipelineTasks(max_threads);
+	if (!LaunchScanTasks(event, max_threads)) {
+		executor.ReleasePipelineTask();
+		return false;
+	}
+	return true;
 }
 
 bool Pipeline::IsOrderDependent() const {
@@ -179,7 +197,7 @@ bool Pipeline::LaunchScanTasks(shared_ptr<Event> &event, idx_t max_threads) {
 		return false;
 	}
 
-	// launch a task for every thread
+	// launch a task for every thread, the tasks were reserved by the caller
 	vector<shared_ptr<Task>> tasks;
 	for (idx_t i = 0; i < max_threads; i++) {
 		tasks.push_back(make_uniq<PipelineTask>(*this, event));
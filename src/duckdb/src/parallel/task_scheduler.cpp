@@ -39,8 +39,13 @@ struct SchedulerThread {
 typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
+static constexpr idx_t TASK_PRIORITY_COUNT = 3;
+//! Out of every 21 dequeues, 16 serve HIGH priority tasks first, 4 NORMAL and 1 LOW
+static constexpr idx_t TASK_PRIORITY_WEIGHTS[TASK_PRIORITY_COUNT] = {16, 4, 1};
+static constexpr idx_t TASK_PRIORITY_TOTAL_WEIGHT = 21;
+
 struct ConcurrentQueue {
-	ConcurrentQueue() : tasks_in_queue(0) {
+	ConcurrentQueue() : tasks_in_queue(0), dequeue_count(0) {
 	}
 
 	lightweight_semaphore_t semaphore;
@@ -53,17 +58,19 @@ struct ConcurrentQueue {
 	idx_t GetApproxSize() const;
 	idx_t GetProducerCount() const;
 	idx_t GetTaskCountForProducer(ProducerToken &token) const;
-	concurrent_queue_t &GetQueue() {
-		return q;
+	concurrent_queue_t &GetQueue(TaskPriority priority) {
+		return q[static_cast<idx_t>(priority)];
 	}
 
 private:
-	concurrent_queue_t q;
+	concurrent_queue_t q[TASK_PRIORITY_COUNT];
 	atomic<idx_t> tasks_in_queue;
+	//! The position in the weighted round-robin over the priorities
+	atomic<idx_t> dequeue_count;
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.GetQueue()) {
+	QueueProducerToken(ConcurrentQueue &queue, TaskPriority priority) : queue_token(queue.GetQueue(priority)) {
 	}
 
 	duckdb_moodycamel::ProducerToken queue_token;
@@ -72,7 +79,7 @@ struct QueueProducerToken {
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
 	task->token = token;
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
+	if (GetQueue(token.priority).enqueue(token.token->queue_token, std::move(task))) {
 		++tasks_in_queue;
 		semaphore.signal();
 	} else {
@@ -86,7 +93,8 @@ void ConcurrentQueue::EnqueueBulk(ProducerToken &token, vector<shared_ptr<Task>>
 	for (auto &task : tasks) {
 		task->token = token;
 	}
-	if (q.enqueue_bulk(token.token->queue_token, std::make_move_iterator(tasks.begin()), tasks.size())) {
+	auto &priority_queue = GetQueue(token.priority);
+	if (priority_queue.enqueue_bulk(token.token->queue_token, std::make_move_iterator(tasks.begin()), tasks.size())) {
 		tasks_in_queue += tasks.size();
 		semaphore.signal(NumericCast<ssize_t>(tasks.size()));
 	} else {
@@ -96,7 +104,7 @@ void ConcurrentQueue::EnqueueBulk(ProducerToken &token, vector<shared_ptr<Task>>
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (!q.try_dequeue_from_producer(token.token->queue_token, task)) {
+	if (!GetQueue(token.priority).try_dequeue_from_producer(token.token->queue_token, task)) {
 		return false;
 	}
 	--tasks_in_queue;
@@ -104,7 +112,19 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task>
 }
 
 bool ConcurrentQueue::Dequeue(shared_ptr<Task> &task) {
-	if (!q.try_dequeue(task)) {
+	// serve the priorities in proportion to their weights, so that lower priorities progress as well
+	auto position = dequeue_count++ % TASK_PRIORITY_TOTAL_WEIGHT;
+	idx_t first = 0;
+	while (position >= TASK_PRIORITY_WEIGHTS[first]) {
+		position -= TASK_PRIORITY_WEIGHTS[first];
+		first++;
+	}
+	bool dequeued = q[first].try_dequeue(task);
+	// if that priority has no tasks, take one from the others in order of priority rather than idling
+	for (idx_t i = 0; !dequeued && i < TASK_PRIORITY_COUNT; i++) {
+		dequeued = i != first && q[i].try_dequeue(task);
+	}
+	if (!dequeued) {
 		return false;
 	}
 	--tasks_in_queue;
@@ -115,15 +135,23 @@ idx_t ConcurrentQueue::GetTasksInQueue() const {
 	return tasks_in_queue;
 }
 idx_t ConcurrentQueue::GetApproxSize() const {
-	return q.size_approx();
+	idx_t size = 0;
+	for (auto &priority_queue : q) {
+		size += priority_queue.size_approx();
+	}
+	return size;
 }
 idx_t ConcurrentQueue::GetProducerCount() const {
-	return q.size_producers_approx();
+	idx_t producer_count = 0;
+	for (auto &priority_queue : q) {
+		producer_count += priority_queue.size_producers_approx();
+	}
+	return producer_count;
 }
 
 idx_t ConcurrentQueue::GetTaskCountForProducer(ProducerToken &token) const {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.size_producer_approx(token.token->queue_token);
+	return q[static_cast<idx_t>(token.priority)].size_producer_approx(token.token->queue_token);
 }
 
 #else
@@ -202,7 +230,7 @@ idx_t ConcurrentQueue::GetTaskCountForProducer(ProducerToken &token) const {
 }
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue(&queue) {
+	QueueProducerToken(ConcurrentQueue &queue, TaskPriority priority) : queue(&queue) {
 	}
 
 	~QueueProducerToken() {
@@ -215,8 +243,8 @@ private:
 };
 #endif
 
-ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
-    : scheduler(scheduler), token(std::move(token)) {
+ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token, TaskPriority priority)
+    : scheduler(scheduler), token(std::move(token)), priority(priority) {
 }
 
 ProducerToken::~ProducerToken() {
@@ -248,9 +276,9 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 	return db.GetScheduler();
 }
 
-unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
-	auto token = make_uniq<QueueProducerToken>(*queue);
-	return make_uniq<ProducerToken>(*this, std::move(token));
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(TaskPriority priority) {
+	auto token = make_uniq<QueueProducerToken>(*queue, priority);
+	return make_uniq<ProducerToken>(*this, std::move(token), priority);
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
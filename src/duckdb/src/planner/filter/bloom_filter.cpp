@@ -0,0 +1,241 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/types/hugeint.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/table_filter_state.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// BlockedBloomFilter
+//===--------------------------------------------------------------------===//
+// odd multipliers from the Parquet split block Bloom filter specification
+static constexpr uint32_t BLOOM_FILTER_SALT[] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+BlockedBloomFilter::BlockedBloomFilter(idx_t key_count) {
+	auto bits = MaxValue<idx_t>(key_count, 1) * BITS_PER_KEY;
+	block_count = (bits + WORDS_PER_BLOCK * 32 - 1) / (WORDS_PER_BLOCK * 32);
+	blocks = make_unsafe_uniq_array<uint32_t>(block_count * WORDS_PER_BLOCK);
+}
+
+uint32_t BlockedBloomFilter::GetMask(hash_t hash, idx_t word_idx) {
+	return 1U << ((static_cast<uint32_t>(hash) * BLOOM_FILTER_SALT[word_idx]) >> 27);
+}
+
+void BlockedBloomFilter::Insert(Vector &hashes, idx_t count) {
+	D_ASSERT(hashes.GetType().id() == LogicalTypeId::HASH);
+	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		Insert(*ConstantVector::GetData<hash_t>(hashes));
+		return;
+	}
+	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto data = FlatVector::GetData<hash_t>(hashes);
+	for (idx_t i = 0; i < count; i++) {
+		Insert(data[i]);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// BloomFilter
+//===--------------------------------------------------------------------===//
+//! Once this many tuples have been probed, a filter that lets more than 95% of them pass is no longer evaluated
+static constexpr idx_t BLOOM_FILTER_ADAPTIVE_THRESHOLD = 64 * STANDARD_VECTOR_SIZE;
+//! Zonemaps spanning at most this many distinct integers are pruned by probing every value in them
+static constexpr idx_t BLOOM_FILTER_MAX_PROBED_RANGE = 256;
+
+BloomFilter::BloomFilter() : TableFilter(TableFilterType::BLOOM_FILTER) {
+}
+
+BloomFilter::BloomFilter(shared_ptr<BlockedBloomFilter> filter_p, LogicalType key_type_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), filter(std::move(filter_p)), key_type(std::move(key_type_p)) {
+}
+
+bool BloomFilter::SupportsType(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+template <class T>
+static void TemplatedBloomFilterSelect(const BlockedBloomFilter &filter, UnifiedVectorFormat &vdata,
+                                       SelectionVector &sel, idx_t &approved_tuple_count) {
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		auto vector_idx = vdata.sel->get_index(idx);
+		if (vdata.validity.RowIsValid(vector_idx) && filter.Lookup(duckdb::Hash<T>(data[vector_idx]))) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+}
+
+idx_t BloomFilter::Select(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel,
+                          idx_t &approved_tuple_count, BloomFilterState &state) const {
+	if (!filter || state.disabled || approved_tuple_count == 0) {
+		return approved_tuple_count;
+	}
+	auto probed_count = approved_tuple_count;
+	switch (vector.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+		TemplatedBloomFilterSelect<bool>(*filter, vdata, sel, approved_tuple_count);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedBloomFilterSelect<uint8_t>(*filter, vdata, sel, approved_tuple_count);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedBloomFilterSelect<uint16_t>(*filter, vdata, sel, approved_tuple_count);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedBloomFilterSelect<uint32_t>(*filter, vdata, sel, approved_tuple_count);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedBloomFilterSelect<uint64_t>(*filter, vdata, sel, approved_tuple_count);
+		break;
+	case PhysicalType::UINT128:
+		TemplatedBloomFilterSelect<uhugeint_t>(*filter, vdata, sel, approved_tuple_count);
+		break;
+	case PhysicalType::INT8:
+		TemplatedBloomFilterSelect<int8_t>(*filter, vdata, sel, approved_tuple_count);
+		break;
+	case PhysicalType::INT16:
+		TemplatedBloomFilterSelect<int16_t>(*filter, vdata, sel, approved_tuple_count);
+		break;
+	case PhysicalType::INT32:
+		TemplatedBloomFilterSelect<int32_t>(*filter, vdata, sel, approved_tuple_count);
+		break;
+	case PhysicalType::INT64:
+		TemplatedBloomFilterSelect<int64_t>(*filter, vdata, sel, approved_tuple_count);
+		break;
+	case PhysicalType::INT128:
+		TemplatedBloomFilterSelect<hugeint_t>(*filter, vdata, sel, approved_tuple_count);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedBloomFilterSelect<float>(*filter, vdata, sel, approved_tuple_count);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedBloomFilterSelect<double>(*filter, vdata, sel, approved_tuple_count);
+		break;
+	case PhysicalType::VARCHAR:
+		TemplatedBloomFilterSelect<string_t>(*filter, vdata, sel, approved_tuple_count);
+		break;
+	default:
+		// not a type the filter was built for - let everything pass
+		return approved_tuple_count;
+	}
+	// the filter only pays off if it removes tuples: stop probing it if it does not
+	state.probed_count += probed_count;
+	state.passed_count += approved_tuple_count;
+	if (state.probed_count >= BLOOM_FILTER_ADAPTIVE_THRESHOLD && state.passed_count * 20 > state.probed_count * 19) {
+		state.disabled = true;
+	}
+	return approved_tuple_count;
+}
+
+bool BloomFilter::Lookup(const Value &value) const {
+	if (!filter) {
+		return true;
+	}
+	if (value.IsNull()) {
+		return false;
+	}
+	if (value.type() == key_type) {
+		return filter->Lookup(value.Hash());
+	}
+	Value key;
+	if (!value.DefaultTryCastAs(key_type, key, nullptr)) {
+		return true;
+	}
+	return filter->Lookup(key.Hash());
+}
+
+template <class T>
+static FilterPropagateResult TemplatedCheckRange(const BlockedBloomFilter &filter, BaseStatistics &stats) {
+	auto min = NumericStats::GetMinUnsafe<T>(stats);
+	auto max = NumericStats::GetMaxUnsafe<T>(stats);
+	if (max < min ||
+	    Hugeint::Convert(max) - Hugeint::Convert(min) >= Hugeint::Convert(BLOOM_FILTER_MAX_PROBED_RANGE)) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	for (T value = min;; value++) {
+		if (filter.Lookup(duckdb::Hash<T>(value))) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		if (value == max) {
+			return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+	}
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) const {
+	// a zonemap over few distinct integers can be skipped if none of them is in the filter
+	if (!filter || stats.GetStatsType() != StatisticsType::NUMERIC_STATS || !NumericStats::HasMinMax(stats) ||
+	    stats.GetType().InternalType() != key_type.InternalType()) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	switch (key_type.InternalType()) {
+	case PhysicalType::UINT8:
+		return TemplatedCheckRange<uint8_t>(*filter, stats);
+	case PhysicalType::UINT16:
+		return TemplatedCheckRange<uint16_t>(*filter, stats);
+	case PhysicalType::UINT32:
+		return TemplatedCheckRange<uint32_t>(*filter, stats);
+	case PhysicalType::UINT64:
+		return TemplatedCheckRange<uint64_t>(*filter, stats);
+	case PhysicalType::INT8:
+		return TemplatedCheckRange<int8_t>(*filter, stats);
+	case PhysicalType::INT16:
+		return TemplatedCheckRange<int16_t>(*filter, stats);
+	case PhysicalType::INT32:
+		return TemplatedCheckRange<int32_t>(*filter, stats);
+	case PhysicalType::INT64:
+		return TemplatedCheckRange<int64_t>(*filter, stats);
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+string BloomFilter::ToString(const string &column_name) const {
+	return "Bloom Filter (" + column_name + ")";
+}
+
+unique_ptr<Expression> BloomFilter::ToExpression(const Expression &column) const {
+	// the filter only removes tuples without a join partner, which the join removes anyway
+	return make_uniq<BoundConstantExpression>(Value(true));
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.filter.get() == filter.get();
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return make_uniq<BloomFilter>(filter, key_type);
+}
+
+} // namespace duckdb
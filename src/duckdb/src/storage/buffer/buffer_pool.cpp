@@ -91,6 +91,10 @@ public:
 	inline void DecrementDeadNodes() {
 		total_dead_nodes--;
 	}
+	//! Total number of insertions into the eviction queue so far
+	inline idx_t GetInsertions() const {
+		return evict_queue_insertions;
+	}
 
 private:
 	//! Bulk purge dead nodes from the eviction queue. Then, enqueue those that are still alive.
@@ -234,8 +238,8 @@ BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps,
     : eviction_queue_sizes({BLOCK_AND_EXTERNAL_FILE_QUEUE_SIZE, MANAGED_BUFFER_QUEUE_SIZE, TINY_BUFFER_QUEUE_SIZE}),
       maximum_memory(maximum_memory),
       allocator_bulk_deallocation_flush_threshold(allocator_bulk_deallocation_flush_threshold),
-      track_eviction_timestamps(track_eviction_timestamps),
-      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
+      track_eviction_timestamps(track_eviction_timestamps), eviction_policy(BufferEvictionPolicy::LRU), pin_hits(0),
+      pin_misses(0), evictions(0), temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
 	for (idx_t queue_type_idx = 0; queue_type_idx < EVICTION_QUEUE_TYPES; queue_type_idx++) {
 		const auto types = EvictionQueueTypeIdxToFileBufferTypes(queue_type_idx);
 		const auto &type_queue_size = eviction_queue_sizes[queue_type_idx];
@@ -248,8 +252,6 @@ BufferPool::~BufferPool() {
 }
 
 bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
-	auto &queue = GetEvictionQueueForBlockHandle(*handle);
-
 	// The block handle is locked during this operation (Unpin),
 	// or the block handle is still a local variable (ConvertToPersistent)
 	D_ASSERT(handle->Readers() == 0);
@@ -262,14 +264,66 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 	}
 
 	if (ts != 1) {
-		// we add a newer version, i.e., we kill exactly one previous version
-		queue.IncrementDeadNodes();
+		// we add a newer version, i.e., we kill exactly one previous version (in the queue it was added to)
+		GetEvictionQueueForBlockHandle(*handle).IncrementDeadNodes();
+	}
+	if (handle->GetBufferType() == FileBufferType::BLOCK || handle->GetBufferType() == FileBufferType::EXTERNAL_FILE) {
+		UpdatePersistentEvictionQueue(*handle, ts);
 	}
 
 	// Get the eviction queue for the block and add it
+	auto &queue = GetEvictionQueueForBlockHandle(*handle);
 	return queue.AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ts));
 }
 
+void BufferPool::UpdatePersistentEvictionQueue(BlockHandle &handle, idx_t eviction_seq_num) {
+	// the probation queue is the first queue, it is evicted before the protected queue
+	auto &probation_queue = *queues[0];
+	const auto insertions = probation_queue.GetInsertions();
+	const bool is_protected = handle.GetEvictionQueueIndex() == 0;
+	if (eviction_policy != BufferEvictionPolicy::TWO_QUEUE) {
+		// LRU: all persistent blocks share the probation queue
+		if (is_protected) {
+			handle.SetPersistentEvictionQueueIndex(DConstants::INVALID_INDEX);
+		}
+		return;
+	}
+	if (is_protected) {
+		return;
+	}
+	if (eviction_seq_num == 1) {
+		// first use
+		handle.SetProbationInsertion(insertions);
+		return;
+	}
+	// we remember blocks for as many insertions as there are blocks that fit in memory
+	const auto history = maximum_memory / DEFAULT_BLOCK_ALLOC_SIZE;
+	const auto distance = insertions - handle.GetProbationInsertion();
+	if (distance < MinValue<idx_t>(CORRELATED_REFERENCE_PERIOD, history / 4)) {
+		// a use that is correlated with the previous one, e.g., by the same scan: keep the block on probation
+		return;
+	}
+	if (distance > history) {
+		// a use so long after the previous one that a sequential scan over more data than fits in memory could
+		// have caused it: start over as if this was the first use
+		handle.SetProbationInsertion(insertions);
+		return;
+	}
+	// the block was used again while a scan would still have kept it: promote it, so that it is only evicted once
+	// the probation queue is empty
+	handle.SetPersistentEvictionQueueIndex(0);
+}
+
+void BufferPool::RecordEviction(BlockHandle &handle) {
+	evictions.fetch_add(1, std::memory_order_relaxed);
+	const auto type = handle.GetBufferType();
+	if ((type == FileBufferType::BLOCK || type == FileBufferType::EXTERNAL_FILE) && handle.GetEvictionQueueIndex() == 0) {
+		// the block has to prove itself on probation again once it is loaded again
+		handle.SetPersistentEvictionQueueIndex(DConstants::INVALID_INDEX);
+		handle.SetProbationInsertion(queues[0]->GetInsertions());
+	}
+}
+
 EvictionQueue &BufferPool::GetEvictionQueueForBlockHandle(const BlockHandle &handle) {
 	const auto &handle_buffer_type = handle.GetBufferType();
 
@@ -341,6 +395,7 @@ BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue,
 
 	queue.IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle, BlockLock &lock) {
 		// hooray, we can unload the block
+		RecordEviction(*handle);
 		if (buffer && handle->GetBuffer(lock)->AllocSize() == extra_memory) {
 			// we can re-use the memory directly
 			*buffer = handle->UnloadAndTakeBlock(lock);
@@ -390,6 +445,7 @@ idx_t BufferPool::PurgeAgedBlocksInternal(EvictionQueue &queue, uint32_t max_age
 		    auto lru_timestamp_msec = handle->GetLRUTimestamp();
 		    bool is_fresh = lru_timestamp_msec >= limit && lru_timestamp_msec <= now;
 		    purged_bytes += handle->GetMemoryUsage();
+		    RecordEviction(*handle);
 		    handle->Unload(lock);
 		    // Return false to stop iterating if the current block is_fresh
 		    return !is_fresh;
@@ -459,6 +515,30 @@ void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
 	}
 }
 
+void BufferPool::SetEvictionPolicy(BufferEvictionPolicy policy) {
+	eviction_policy = policy;
+}
+
+BufferEvictionPolicy BufferPool::GetEvictionPolicy() const {
+	return eviction_policy;
+}
+
+void BufferPool::RecordPin(bool hit) {
+	if (hit) {
+		pin_hits.fetch_add(1, std::memory_order_relaxed);
+	} else {
+		pin_misses.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+BufferPoolStatistics BufferPool::GetStatistics() const {
+	BufferPoolStatistics result;
+	result.hits = pin_hits.load(std::memory_order_relaxed);
+	result.misses = pin_misses.load(std::memory_order_relaxed);
+	result.evictions = evictions.load(std::memory_order_relaxed);
+	return result;
+}
+
 void BufferPool::SetAllocatorBulkDeallocationFlushThreshold(idx_t threshold) {
 	allocator_bulk_deallocation_flush_threshold = threshold;
 }
@@ -5,6 +5,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/random_engine.hpp"
 #include "duckdb/common/types/conflict_manager.hpp"
 #include "duckdb/common/types/constraint_conflict_info.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -35,7 +36,8 @@ namespace duckdb {
 
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
-    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)) {
+    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)),
+      incarnation(RandomEngine().NextRandomInteger64()), last_delete_or_update_commit_id(0) {
 }
 
 void DataTableInfo::BindIndexes(ClientContext &context, const char *index_type) {
@@ -50,7 +52,7 @@ DataTable::DataTable(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_m
                      const string &table, vector<ColumnDefinition> column_definitions_p,
                      unique_ptr<PersistentTableData> data)
     : db(db), info(make_shared_ptr<DataTableInfo>(db, std::move(table_io_manager_p), schema, table)),
-      column_definitions(std::move(column_definitions_p)), version(DataTableVersion::MAIN_TABLE) {
+      column_definitions(std::move(column_definitions_p)), version(DataTableVersion::MAIN_TABLE), last_commit_id(0) {
 	// initialize the table with the existing data from disk, if any
 	auto types = GetTypes();
 	auto &io_manager = TableIOManager::Get(*this);
@@ -71,7 +73,7 @@ DataTable::DataTable(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_m
 }
 
 DataTable::DataTable(ClientContext &context, DataTable &parent, ColumnDefinition &new_column, Expression &default_value)
-    : db(parent.db), info(parent.info), version(DataTableVersion::MAIN_TABLE) {
+    : db(parent.db), info(parent.info), version(DataTableVersion::MAIN_TABLE), last_commit_id(0) {
 	// add the column definitions from this DataTable
 	for (auto &column_def : parent.column_definitions) {
 		column_definitions.emplace_back(column_def.Copy());
@@ -96,7 +98,7 @@ DataTable::DataTable(ClientContext &context, DataTable &parent, ColumnDefinition
 }
 
 DataTable::DataTable(ClientContext &context, DataTable &parent, idx_t removed_column)
-    : db(parent.db), info(parent.info), version(DataTableVersion::MAIN_TABLE) {
+    : db(parent.db), info(parent.info), version(DataTableVersion::MAIN_TABLE), last_commit_id(0) {
 	// prevent any new tuples from being added to the parent
 	auto &local_storage = LocalStorage::Get(context, db);
 	lock_guard<mutex> parent_lock(parent.append_lock);
@@ -145,7 +147,8 @@ DataTable::DataTable(ClientContext &context, DataTable &parent, idx_t removed_co
 }
 
 DataTable::DataTable(ClientContext &context, DataTable &parent, BoundConstraint &constraint)
-    : db(parent.db), info(parent.info), row_groups(parent.row_groups), version(DataTableVersion::MAIN_TABLE) {
+    : db(parent.db), info(parent.info), row_groups(parent.row_groups), version(DataTableVersion::MAIN_TABLE),
+      last_commit_id(0) {
 
 	// ALTER COLUMN to add a new constraint.
 
@@ -172,7 +175,7 @@ DataTable::DataTable(ClientContext &context, DataTable &parent, BoundConstraint
 
 DataTable::DataTable(ClientContext &context, DataTable &parent, idx_t changed_idx, const LogicalType &target_type,
                      const vector<StorageIndex> &bound_columns, Expression &cast_expr)
-    : db(parent.db), info(parent.info), version(DataTableVersion::MAIN_TABLE) {
+    : db(parent.db), info(parent.info), version(DataTableVersion::MAIN_TABLE), last_commit_id(0) {
 
 	auto &local_storage = LocalStorage::Get(context, db);
 	// prevent any tuples from being added to the parent
@@ -287,6 +290,10 @@ void DataTable::InitializeParallelScan(ClientContext &context, ParallelTableScan
 	local_storage.InitializeParallelScan(*this, state.local_state);
 }
 
+void DataTable::SetParallelScanOrder(ParallelTableScanState &state, PhysicalIndex column, OrderType order_type) {
+	row_groups->SetParallelScanOrder(state.scan_state, column, order_type);
+}
+
 bool DataTable::NextParallelScan(ClientContext &context, ParallelTableScanState &state, TableScanState &scan_state) {
 	if (row_groups->NextParallelScan(context, state.scan_state, scan_state.table_state)) {
 		return true;
@@ -1536,7 +1543,7 @@ void DataTable::Update(TableUpdateState &state, ClientContext &context, Vector &
 	// otherwise global storage
 	if (n_global_update > 0) {
 		auto &transaction = DuckTransaction::Get(context, db);
-		transaction.ModifyTable(*this);
+		transaction.ModifyTable(*this, true);
 		updates_slice.Slice(updates, sel_global_update, n_global_update);
 		updates_slice.Flatten();
 		row_ids_slice.Slice(row_ids, sel_global_update, n_global_update);
@@ -1563,6 +1570,7 @@ void DataTable::UpdateColumn(TableCatalogEntry &table, ClientContext &context, V
 
 	// now perform the actual update
 	auto &transaction = DuckTransaction::Get(context, db);
+	transaction.ModifyTable(*this, true);
 
 	updates.Flatten();
 	row_ids.Flatten(updates.size());
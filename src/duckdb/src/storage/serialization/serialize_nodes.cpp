@@ -308,6 +308,8 @@ void ExtraOperatorInfo::Serialize(Serializer &serializer) const {
 	serializer.WriteProperty<optional_idx>(101, "total_files", total_files);
 	serializer.WriteProperty<optional_idx>(102, "filtered_files", filtered_files);
 	serializer.WritePropertyWithDefault<unique_ptr<SampleOptions>>(103, "sample_options", sample_options);
+	serializer.WritePropertyWithDefault<optional_idx>(104, "scan_order_column", scan_order_column, optional_idx());
+	serializer.WritePropertyWithDefault<OrderType>(105, "scan_order_type", scan_order_type, OrderType::INVALID);
 }
 
 ExtraOperatorInfo ExtraOperatorInfo::Deserialize(Deserializer &deserializer) {
@@ -316,6 +318,10 @@ ExtraOperatorInfo ExtraOperatorInfo::Deserialize(Deserializer &deserializer) {
 	deserializer.ReadProperty<optional_idx>(101, "total_files", result.total_files);
 	deserializer.ReadProperty<optional_idx>(102, "filtered_files", result.filtered_files);
 	deserializer.ReadPropertyWithDefault<unique_ptr<SampleOptions>>(103, "sample_options", result.sample_options);
+	deserializer.ReadPropertyWithExplicitDefault<optional_idx>(104, "scan_order_column", result.scan_order_column,
+	                                                           optional_idx());
+	deserializer.ReadPropertyWithExplicitDefault<OrderType>(105, "scan_order_type", result.scan_order_type,
+	                                                        OrderType::INVALID);
 	return result;
 }
 
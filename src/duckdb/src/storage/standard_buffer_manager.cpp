@@ -356,6 +356,7 @@ BufferHandle StandardBufferManager::Pin(QueryContext context, shared_ptr<BlockHa
 	}
 
 	if (buf.IsValid()) {
+		buffer_pool.RecordPin(true);
 		return buf; // the block was already loaded, return it without holding the BlockHandle's lock
 	} else {
 		// evict blocks until we have space for the current block
@@ -371,9 +372,11 @@ BufferHandle StandardBufferManager::Pin(QueryContext context, shared_ptr<BlockHa
 			// the block is loaded, increment the reader count and return a pointer to the handle
 			reservation.Resize(0);
 			buf = handle->Load(context);
+			buffer_pool.RecordPin(true);
 		} else {
 			// now we can actually load the current block
 			D_ASSERT(handle->Readers() == 0);
+			buffer_pool.RecordPin(false);
 			buf = handle->Load(context, std::move(reusable_buffer));
 			if (!buf.IsValid()) {
 				reservation.Resize(0);
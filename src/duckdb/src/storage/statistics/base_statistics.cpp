@@ -375,6 +375,34 @@ BaseStatistics BaseStatistics::Deserialize(Deserializer &deserializer) {
 	return stats;
 }
 
+Value BaseStatistics::GetOrderBoundary(OrderType order_type) const {
+	bool descending = order_type == OrderType::DESCENDING;
+	switch (GetStatsType()) {
+	case StatisticsType::NUMERIC_STATS:
+		if (descending && NumericStats::HasMax(*this)) {
+			return NumericStats::Max(*this);
+		}
+		if (!descending && NumericStats::HasMin(*this)) {
+			return NumericStats::Min(*this);
+		}
+		return Value();
+	case StatisticsType::STRING_STATS: {
+		// the statistics only keep a prefix of the strings, which is compared as bytes
+		auto boundary = descending ? StringStats::Max(*this) : StringStats::Min(*this);
+		return Value::BLOB(const_data_ptr_cast(boundary.c_str()), boundary.size());
+	}
+	default:
+		return Value();
+	}
+}
+
+bool BaseStatistics::OrderBoundaryPrecedes(const Value &left, const Value &right, OrderType order_type) {
+	if (left.IsNull() || right.IsNull()) {
+		return !left.IsNull() && right.IsNull();
+	}
+	return order_type == OrderType::DESCENDING ? right < left : left < right;
+}
+
 string BaseStatistics::ToString() const {
 	auto has_n = has_null ? "true" : "false";
 	auto has_n_n = has_no_null ? "true" : "false";
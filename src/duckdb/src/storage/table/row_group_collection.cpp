@@ -200,6 +200,44 @@ void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &sta
 	state.max_row = row_start + total_rows;
 	state.batch_index = 0;
 	state.processed_rows = 0;
+	state.row_group_order.clear();
+	state.row_group_order_index = 0;
+}
+
+void RowGroupCollection::SetParallelScanOrder(ParallelCollectionScanState &state, PhysicalIndex column,
+                                              OrderType order_type) {
+	vector<pair<Value, RowGroup *>> row_group_boundaries;
+	for (auto row_group = state.current_row_group; row_group; row_group = row_groups->GetNextSegment(row_group)) {
+		if (row_group->count == 0 || row_group->start >= state.max_row) {
+			break;
+		}
+		auto stats = row_group->GetStatistics(column.index);
+		row_group_boundaries.emplace_back(stats->GetOrderBoundary(order_type), row_group);
+	}
+	if (row_group_boundaries.size() <= 1) {
+		return;
+	}
+	std::stable_sort(row_group_boundaries.begin(), row_group_boundaries.end(),
+	                 [&](const pair<Value, RowGroup *> &a, const pair<Value, RowGroup *> &b) {
+		                 return BaseStatistics::OrderBoundaryPrecedes(a.first, b.first, order_type);
+	                 });
+	state.row_group_order.clear();
+	for (auto &entry : row_group_boundaries) {
+		state.row_group_order.push_back(entry.second);
+	}
+	state.row_group_order_index = 0;
+	state.current_row_group = state.row_group_order[0];
+}
+
+static RowGroup *GetNextParallelScanRowGroup(RowGroupSegmentTree &row_groups, ParallelCollectionScanState &state) {
+	if (state.row_group_order.empty()) {
+		return row_groups.GetNextSegment(state.current_row_group);
+	}
+	state.row_group_order_index++;
+	if (state.row_group_order_index >= state.row_group_order.size()) {
+		return nullptr;
+	}
+	return state.row_group_order[state.row_group_order_index];
 }
 
 bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollectionScanState &state,
@@ -226,14 +264,14 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 				D_ASSERT(vector_index * STANDARD_VECTOR_SIZE < state.current_row_group->count);
 				state.vector_index++;
 				if (state.vector_index * STANDARD_VECTOR_SIZE >= state.current_row_group->count) {
-					state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+					state.current_row_group = GetNextParallelScanRowGroup(*row_groups, state);
 					state.vector_index = 0;
 				}
 			} else {
 				state.processed_rows += state.current_row_group->count;
 				vector_index = 0;
 				max_row = state.current_row_group->start + state.current_row_group->count;
-				state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+				state.current_row_group = GetNextParallelScanRowGroup(*row_groups, state);
 			}
 			max_row = MinValue<idx_t>(max_row, state.max_row);
 			scan_state.batch_index = ++state.batch_index;
@@ -171,7 +171,7 @@ TableScanOptions &CollectionScanState::GetOptions() {
 }
 
 ParallelCollectionScanState::ParallelCollectionScanState()
-    : collection(nullptr), current_row_group(nullptr), processed_rows(0) {
+    : collection(nullptr), current_row_group(nullptr), row_group_order_index(0), processed_rows(0) {
 }
 
 CollectionScanState::CollectionScanState(TableScanState &parent_p)
@@ -85,7 +85,7 @@ void DuckTransaction::PushAttach(AttachedDatabase &db) {
 
 void DuckTransaction::PushDelete(DataTable &table, RowVersionManager &info, idx_t vector_idx, row_t rows[], idx_t count,
                                  idx_t base_row) {
-	ModifyTable(table);
+	ModifyTable(table, true);
 	bool is_consecutive = true;
 	// check if the rows are consecutive
 	for (idx_t i = 0; i < count; i++) {
@@ -152,9 +152,12 @@ void DuckTransaction::PushSequenceUsage(SequenceCatalogEntry &sequence, const Se
 	}
 }
 
-void DuckTransaction::ModifyTable(DataTable &tbl) {
+void DuckTransaction::ModifyTable(DataTable &tbl, bool deletes_or_updates_rows) {
 	lock_guard<mutex> guard(modified_tables_lock);
 	auto table_ref = reference<DataTable>(tbl);
+	if (deletes_or_updates_rows) {
+		delete_or_update_tables.insert(table_ref);
+	}
 	auto entry = modified_tables.find(table_ref);
 	if (entry != modified_tables.end()) {
 		// already exists
@@ -256,6 +259,14 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 			// if we have written to the WAL - flush after the commit has been successful
 			commit_state->FlushCommit();
 		}
+		// query results computed over the previous version of these tables can no longer be reused
+		for (auto &entry : modified_tables) {
+			entry.second->SetLastCommitId(commit_id);
+		}
+		// rows that were deleted or updated can no longer be maintained incrementally
+		for (auto &table : delete_or_update_tables) {
+			table.get().GetDataTableInfo()->SetLastDeleteOrUpdateCommitId(commit_id);
+		}
 		return ErrorData();
 	} catch (std::exception &ex) {
 		undo_buffer.RevertCommit(iterator_state, this->transaction_id);
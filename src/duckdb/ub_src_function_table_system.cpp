@@ -2,6 +2,8 @@
 
 #include "src/function/table/system/duckdb_approx_database_count.cpp"
 
+#include "src/function/table/system/duckdb_buffer_pool.cpp"
+
 #include "src/function/table/system/duckdb_columns.cpp"
 
 #include "src/function/table/system/duckdb_constraints.cpp"
@@ -34,6 +36,10 @@
 
 #include "src/function/table/system/duckdb_prepared_statements.cpp"
 
+#include "src/function/table/system/duckdb_plan_cache.cpp"
+
+#include "src/function/table/system/duckdb_query_result_cache.cpp"
+
 #include "src/function/table/system/duckdb_which_secret.cpp"
 
 #include "src/function/table/system/duckdb_secret_types.cpp"
@@ -54,6 +60,8 @@
 
 #include "src/function/table/system/logging_utils.cpp"
 
+#include "src/function/table/system/materialized_views.cpp"
+
 #include "src/function/table/system/pragma_collations.cpp"
 
 #include "src/function/table/system/pragma_database_size.cpp"
@@ -44,6 +44,8 @@
 
 #include "src/main/pending_query_result.cpp"
 
+#include "src/main/plan_cache.cpp"
+
 #include "src/main/prepared_statement.cpp"
 
 #include "src/main/prepared_statement_data.cpp"
@@ -56,6 +58,8 @@
 
 #include "src/main/query_result.cpp"
 
+#include "src/main/query_result_cache.cpp"
+
 #include "src/main/stream_query_result.cpp"
 
 #include "src/main/valid_checker.cpp"
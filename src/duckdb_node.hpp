@@ -3,11 +3,15 @@
 #include "duckdb.hpp"
 
 #include <napi.h>
+#include <map>
+#include <condition_variable>
+#include <deque>
 #include <queue>
 #include <unordered_map>
 
 #include "duckdb/common/vector.hpp"
 #include "duckdb/common/arrow/arrow.hpp"
+#include "duckdb/common/file_system.hpp"
 
 using duckdb::vector;
 
@@ -28,6 +32,8 @@ public:
 
 namespace node_duckdb {
 
+class Connection;
+
 struct Task {
 	Task(Napi::Reference<Napi::Object> &object, Napi::Function cb) : object(object) {
 		if (!cb.IsUndefined() && cb.IsFunction()) {
@@ -39,9 +45,19 @@ struct Task {
 		object.Ref();
 	}
 
+	// Called on the event loop thread right before the task is handed to a worker
+	virtual void BeforeWork() {
+	}
+
 	// Called on a worker thread (i.e., not the main event loop thread)
 	virtual void DoWork() = 0;
 
+	// Called on the event loop thread after the work has been completed, before any other task is started. The
+	// returned task (if any) is executed next, ahead of all other queued tasks
+	virtual duckdb::unique_ptr<Task> Continuation() {
+		return nullptr;
+	}
+
 	// Called on the event loop thread after the work has been completed. By
 	// default, call the associated callback, if defined. If you're writing
 	// a Task that uses promises, override this method instead of Callback.
@@ -72,15 +88,43 @@ struct Task {
 
 	Napi::FunctionReference callback;
 	Napi::Reference<Napi::Object> &object;
+	// Connection the task was scheduled on while pipelining was enabled for it, if any. Consecutive queued tasks
+	// of the same pipelining connection are executed in one worker hop, see Database::Process
+	Connection *pipeline = nullptr;
 };
 
-class Connection;
+class NodeMemoryFileSystem;
+class NodePipeFileSystem;
 
 struct JSRSArgs;
+struct ReplacementScanCache;
 void DuckDBNodeRSLauncher(Napi::Env env, Napi::Function jsrs, std::nullptr_t *, JSRSArgs *data);
 
 typedef Napi::TypedThreadSafeFunction<std::nullptr_t, JSRSArgs, DuckDBNodeRSLauncher> duckdb_node_rs_function_t;
 
+struct JSFSRequest;
+void DuckDBNodeFSLauncher(Napi::Env env, Napi::Function jsfs, std::nullptr_t *, JSFSRequest *request);
+
+typedef Napi::TypedThreadSafeFunction<std::nullptr_t, JSFSRequest, DuckDBNodeFSLauncher> duckdb_node_fs_function_t;
+
+class ExportPipe;
+void DuckDBNodeExportLauncher(Napi::Env env, Napi::Function deliver, std::nullptr_t *,
+                              duckdb::shared_ptr<ExportPipe> *pipe);
+
+typedef Napi::TypedThreadSafeFunction<std::nullptr_t, duckdb::shared_ptr<ExportPipe>, DuckDBNodeExportLauncher>
+    duckdb_node_export_function_t;
+
+class IngestPipe;
+void DuckDBNodeIngestLauncher(Napi::Env env, Napi::Function drain, std::nullptr_t *,
+                              duckdb::shared_ptr<IngestPipe> *pipe);
+
+typedef Napi::TypedThreadSafeFunction<std::nullptr_t, duckdb::shared_ptr<IngestPipe>, DuckDBNodeIngestLauncher>
+    duckdb_node_ingest_function_t;
+
+void DuckDBNodeTaskLauncher(Napi::Env env, Napi::Function, std::nullptr_t *, Task *task);
+
+typedef Napi::TypedThreadSafeFunction<std::nullptr_t, Task, DuckDBNodeTaskLauncher> duckdb_node_task_function_t;
+
 class Database : public Napi::ObjectWrap<Database> {
 public:
 	explicit Database(const Napi::CallbackInfo &info);
@@ -90,6 +134,11 @@ public:
 	void TaskComplete(Napi::Env env);
 
 	void Schedule(Napi::Env env, duckdb::unique_ptr<Task> task);
+	// Only call from TaskCompleteCallback, queues the task ahead of all others
+	void ScheduleFirst(duckdb::unique_ptr<Task> task);
+	// Executes the task on a thread of its own instead of the task queue, for work that progresses at the pace of JS
+	// (e.g. a stream) and would otherwise hold up the tasks of all connections
+	void ScheduleDetached(Napi::Env env, duckdb::unique_ptr<Task> task);
 
 	static bool HasInstance(Napi::Value val) {
 		Napi::Env env = val.Env();
@@ -110,21 +159,39 @@ public:
 	Napi::Value Interrupt(const Napi::CallbackInfo &info);
 	Napi::Value Close(const Napi::CallbackInfo &info);
 	Napi::Value RegisterReplacementScan(const Napi::CallbackInfo &info);
+	Napi::Value InvalidateReplacementScans(const Napi::CallbackInfo &info);
 	Napi::Value Tokenize(const Napi::CallbackInfo &info);
+	Napi::Value RegisterFileBuffer(const Napi::CallbackInfo &info);
+	Napi::Value UnregisterFileBuffer(const Napi::CallbackInfo &info);
+	Napi::Value GetFileBuffer(const Napi::CallbackInfo &info);
+	Napi::Value RegisterFileSystem(const Napi::CallbackInfo &info);
+
+	// Only call from DoWork of a task, registers the mem:// file system on first use
+	NodeMemoryFileSystem &GetMemoryFileSystem();
+	// Only call from DoWork of a task, registers the pipe:// file system on first use
+	NodePipeFileSystem &GetPipeFileSystem();
 
 public:
 	constexpr static int DUCKDB_NODEJS_ERROR = -1;
 	constexpr static int DUCKDB_NODEJS_READONLY = 1;
 	duckdb::unique_ptr<duckdb::DuckDB> database;
+	// owned by the virtual file system of the database
+	NodeMemoryFileSystem *memory_fs = nullptr;
+	NodePipeFileSystem *pipe_fs = nullptr;
+	// keeps the JS buffers that mem:// files point into alive
+	std::unordered_map<std::string, Napi::Reference<Napi::Buffer<char>>> file_buffers;
+	// result caches of the registered replacement scans, shared with the scans themselves
+	vector<duckdb::shared_ptr<ReplacementScanCache>> replacement_scan_caches;
 
 private:
 	// TODO this task queue can also live in the connection?
-	std::queue<duckdb::unique_ptr<Task>> task_queue;
+	std::deque<duckdb::unique_ptr<Task>> task_queue;
 	std::mutex task_mutex;
 	bool task_inflight;
 	Napi::Env env;
 	int64_t bytes_allocated = 0;
 	int replacement_scan_count = 0;
+	int file_system_count = 0;
 };
 
 struct JSArgs;
@@ -147,6 +214,9 @@ public:
 	Napi::Value UnregisterUdf(const Napi::CallbackInfo &info);
 	Napi::Value RegisterBuffer(const Napi::CallbackInfo &info);
 	Napi::Value UnRegisterBuffer(const Napi::CallbackInfo &info);
+	Napi::Value ExportStream(const Napi::CallbackInfo &info);
+	Napi::Value InsertStream(const Napi::CallbackInfo &info);
+	Napi::Value SetPipelining(const Napi::CallbackInfo &info);
 
 	static bool HasInstance(Napi::Value val) {
 		Napi::Env env = val.Env();
@@ -164,6 +234,13 @@ public:
 	Database *database_ref;
 	std::unordered_map<std::string, duckdb_node_udf_function_t> udfs;
 	std::unordered_map<std::string, Napi::Reference<Napi::Array>> array_references;
+	// statements and exec calls scheduled while set share worker hops with their queued neighbours
+	bool pipelining = false;
+
+	// Only call on the main thread while scheduling a task
+	Connection *PipelineOrNull() {
+		return pipelining ? this : nullptr;
+	}
 };
 
 struct StatementParam;
@@ -181,7 +258,10 @@ public:
 	static Napi::Object NewInstance(Napi::Env env, const vector<napi_value> &args);
 	Napi::Value All(const Napi::CallbackInfo &info);
 	Napi::Value ArrowIPCAll(const Napi::CallbackInfo &info);
+	Napi::Value AllColumnar(const Napi::CallbackInfo &info);
+	Napi::Value AllJSON(const Napi::CallbackInfo &info);
 	Napi::Value Each(const Napi::CallbackInfo &info);
+	Napi::Value EachChunk(const Napi::CallbackInfo &info);
 	Napi::Value Run(const Napi::CallbackInfo &info);
 	Napi::Value Finish(const Napi::CallbackInfo &info);
 	Napi::Value Stream(const Napi::CallbackInfo &info);
@@ -192,9 +272,12 @@ public:
 	Connection *connection_ref;
 	bool ignore_first_param = true;
 	std::string sql;
+	// expected parameter types, only set (on the main thread) once preparing has completed
+	duckdb::unique_ptr<duckdb::case_insensitive_map_t<duckdb::LogicalType>> parameter_types;
+	bool named_parameters = false;
 
 private:
-	duckdb::unique_ptr<StatementParam> HandleArgs(const Napi::CallbackInfo &info);
+	duckdb::unique_ptr<StatementParam> HandleArgs(const Napi::CallbackInfo &info, size_t first_arg = 0);
 };
 
 class QueryResult : public Napi::ObjectWrap<QueryResult> {
@@ -208,14 +291,240 @@ public:
 public:
 	Napi::Value NextChunk(const Napi::CallbackInfo &info);
 	Napi::Value NextIpcBuffer(const Napi::CallbackInfo &info);
+	Napi::Value NextJSON(const Napi::CallbackInfo &info);
 	duckdb::shared_ptr<ArrowSchema> cschema;
 
 private:
 	Database *database_ref;
 };
 
+struct MemoryFile;
+
+//! File system serving mem:// paths from memory: registered files point into JS-owned buffers without copying,
+//! files written by DuckDB (e.g. COPY ... TO 'mem://out.parquet') are kept in owned storage
+class NodeMemoryFileSystem : public duckdb::FileSystem {
+public:
+	static constexpr const char *PREFIX = "mem://";
+	static std::string NormalizePath(const std::string &name);
+
+	void RegisterFile(const std::string &name, const char *data, duckdb::idx_t size);
+	bool UnregisterFile(const std::string &name);
+	//! Returns an immutable snapshot of the file contents, or nullptr if the file does not exist
+	duckdb::shared_ptr<std::string> GetFileContents(const std::string &name);
+
+public:
+	duckdb::unique_ptr<duckdb::FileHandle> OpenFile(const std::string &path, duckdb::FileOpenFlags flags,
+	                                                duckdb::optional_ptr<duckdb::FileOpener> opener) override;
+	void Read(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes, duckdb::idx_t location) override;
+	void Write(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes, duckdb::idx_t location) override;
+	int64_t Read(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+	int64_t Write(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+	int64_t GetFileSize(duckdb::FileHandle &handle) override;
+	duckdb::timestamp_t GetLastModifiedTime(duckdb::FileHandle &handle) override;
+	duckdb::FileType GetFileType(duckdb::FileHandle &handle) override;
+	void Truncate(duckdb::FileHandle &handle, int64_t new_size) override;
+	void FileSync(duckdb::FileHandle &handle) override;
+	bool DirectoryExists(const std::string &directory, duckdb::optional_ptr<duckdb::FileOpener> opener) override;
+	void CreateDirectory(const std::string &directory, duckdb::optional_ptr<duckdb::FileOpener> opener) override;
+	bool ListFiles(const std::string &directory, const std::function<void(const std::string &, bool)> &callback,
+	               duckdb::FileOpener *opener) override;
+	void MoveFile(const std::string &source, const std::string &target,
+	              duckdb::optional_ptr<duckdb::FileOpener> opener) override;
+	bool FileExists(const std::string &filename, duckdb::optional_ptr<duckdb::FileOpener> opener) override;
+	void RemoveFile(const std::string &filename, duckdb::optional_ptr<duckdb::FileOpener> opener) override;
+	bool TryRemoveFile(const std::string &filename, duckdb::optional_ptr<duckdb::FileOpener> opener) override;
+	duckdb::vector<duckdb::OpenFileInfo> Glob(const std::string &path, duckdb::FileOpener *opener) override;
+	void Seek(duckdb::FileHandle &handle, duckdb::idx_t location) override;
+	duckdb::idx_t SeekPosition(duckdb::FileHandle &handle) override;
+	bool CanHandleFile(const std::string &fpath) override;
+	bool CanSeek() override {
+		return true;
+	}
+	bool OnDiskFile(duckdb::FileHandle &handle) override {
+		return false;
+	}
+	std::string PathSeparator(const std::string &path) override {
+		return "/";
+	}
+	std::string GetName() const override {
+		return "NodeMemoryFileSystem";
+	}
+
+private:
+	duckdb::shared_ptr<MemoryFile> FindFile(const std::string &path);
+
+	std::mutex files_lock;
+	std::map<std::string, duckdb::shared_ptr<MemoryFile>> files;
+};
+
+//! Bounded byte queue between a DuckDB writer and a Node Readable. Writers block while `capacity` bytes are
+//! waiting, chunks are handed to JS only while the Readable wants more.
+class ExportPipe : public duckdb::enable_shared_from_this<ExportPipe> {
+public:
+	ExportPipe(duckdb::idx_t capacity, duckdb_node_export_function_t deliver);
+
+	//! Called by DuckDB threads, throws once the Readable has been destroyed
+	void Write(const char *data, duckdb::idx_t size);
+	//! Called from the main thread when the Readable asks for more data
+	void Resume();
+	//! Called from the main thread when the Readable is destroyed, unblocks and fails pending writes
+	void Cancel();
+	//! Called from the main thread once the export query has completed
+	void Finish(duckdb::ErrorData error);
+	//! Called from the launcher on the main thread, pushes queued chunks until the Readable is full
+	void Deliver(Napi::Env env, Napi::Function deliver_fn);
+
+private:
+	void ScheduleDelivery();
+	void Release();
+
+	duckdb::idx_t capacity;
+	duckdb_node_export_function_t deliver;
+	std::mutex lock;
+	std::condition_variable cv;
+	std::deque<std::string> chunks;
+	duckdb::idx_t buffered = 0;
+	bool flowing = false;
+	bool delivery_scheduled = false;
+	bool finished = false;
+	bool cancelled = false;
+	bool released = false;
+	duckdb::ErrorData error;
+};
+
+//! Bounded byte queue between a Node Writable and a DuckDB reader. Readers block until data arrives or the
+//! Writable has ended, the Writable is asked to wait while `capacity` bytes have not been read yet.
+class IngestPipe : public duckdb::enable_shared_from_this<IngestPipe> {
+public:
+	IngestPipe(duckdb::idx_t capacity, duckdb_node_ingest_function_t drain);
+
+	//! Called from the main thread, queues a copy of the data. Returns false if the writer should wait for drain.
+	bool Push(const char *data, duckdb::idx_t size);
+	//! Called from the main thread once the Writable has ended
+	void End();
+	//! Called from the main thread when the Writable is destroyed, fails pending and future reads
+	void Cancel();
+	//! Called from the main thread once the insert has completed
+	void Finish();
+	//! Called by DuckDB threads, blocks until data is available and returns 0 at the end of the stream
+	duckdb::idx_t Read(char *buffer, duckdb::idx_t size);
+	//! Called from the launcher on the main thread once there is room for more data
+	void Drain(Napi::Env env, Napi::Function drain_fn);
+
+private:
+	duckdb::idx_t capacity;
+	duckdb_node_ingest_function_t drain;
+	std::mutex lock;
+	std::condition_variable cv;
+	std::deque<std::string> chunks;
+	//! bytes of the first chunk that have already been read
+	duckdb::idx_t offset = 0;
+	duckdb::idx_t buffered = 0;
+	bool ended = false;
+	bool cancelled = false;
+	bool drain_pending = false;
+	bool released = false;
+};
+
+//! File system for pipe:// paths. Everything DuckDB writes (e.g. COPY ... TO 'pipe://1') goes to the registered
+//! ExportPipe, reads (e.g. read_csv('pipe://2')) are served from the registered IngestPipe. Pipes are sequential.
+class NodePipeFileSystem : public duckdb::FileSystem {
+public:
+	static constexpr const char *PREFIX = "pipe://";
+
+	//! Returns the path under which DuckDB can write into the pipe
+	std::string Register(duckdb::shared_ptr<ExportPipe> pipe);
+	//! Returns the path under which DuckDB can read from the pipe
+	std::string Register(duckdb::shared_ptr<IngestPipe> pipe);
+	void Unregister(const std::string &path);
+
+public:
+	duckdb::unique_ptr<duckdb::FileHandle> OpenFile(const std::string &path, duckdb::FileOpenFlags flags,
+	                                                duckdb::optional_ptr<duckdb::FileOpener> opener) override;
+	void Read(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes, duckdb::idx_t location) override;
+	int64_t Read(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+	void Write(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes, duckdb::idx_t location) override;
+	int64_t Write(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+	int64_t GetFileSize(duckdb::FileHandle &handle) override;
+	duckdb::FileType GetFileType(duckdb::FileHandle &handle) override;
+	void FileSync(duckdb::FileHandle &handle) override;
+	bool FileExists(const std::string &filename, duckdb::optional_ptr<duckdb::FileOpener> opener) override;
+	bool IsPipe(const std::string &filename, duckdb::optional_ptr<duckdb::FileOpener> opener) override;
+	duckdb::vector<duckdb::OpenFileInfo> Glob(const std::string &path, duckdb::FileOpener *opener) override;
+	duckdb::idx_t SeekPosition(duckdb::FileHandle &handle) override;
+	bool CanHandleFile(const std::string &fpath) override;
+	bool CanSeek() override {
+		return false;
+	}
+	bool OnDiskFile(duckdb::FileHandle &handle) override {
+		return false;
+	}
+	std::string GetName() const override {
+		return "NodePipeFileSystem";
+	}
+
+private:
+	std::mutex pipes_lock;
+	std::map<std::string, duckdb::shared_ptr<ExportPipe>> export_pipes;
+	std::map<std::string, duckdb::shared_ptr<IngestPipe>> ingest_pipes;
+	duckdb::idx_t next_pipe_id = 0;
+};
+
+struct JSBlockCache;
+
+struct JSFileSystemOptions {
+	//! Granularity of reads issued to JS and of the block cache
+	duckdb::idx_t block_size = 1 << 20;
+	//! Maximum amount of bytes kept in the block cache
+	duckdb::idx_t cache_size = 64 << 20;
+	//! Number of blocks fetched beyond the end of a read that misses the cache
+	duckdb::idx_t read_ahead = 1;
+};
+
+//! Read-only file system for paths starting with a prefix, served by asynchronous JS callbacks. Reads are aligned
+//! to blocks, coalesced into a single JS fetch and kept in an LRU cache.
+class JSFileSystem : public duckdb::FileSystem {
+public:
+	JSFileSystem(std::string prefix, duckdb_node_fs_function_t jsfs, JSFileSystemOptions options);
+	~JSFileSystem() override;
+
+public:
+	duckdb::unique_ptr<duckdb::FileHandle> OpenFile(const std::string &path, duckdb::FileOpenFlags flags,
+	                                                duckdb::optional_ptr<duckdb::FileOpener> opener) override;
+	void Read(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes, duckdb::idx_t location) override;
+	int64_t Read(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+	int64_t GetFileSize(duckdb::FileHandle &handle) override;
+	duckdb::timestamp_t GetLastModifiedTime(duckdb::FileHandle &handle) override;
+	duckdb::FileType GetFileType(duckdb::FileHandle &handle) override;
+	bool FileExists(const std::string &filename, duckdb::optional_ptr<duckdb::FileOpener> opener) override;
+	duckdb::vector<duckdb::OpenFileInfo> Glob(const std::string &path, duckdb::FileOpener *opener) override;
+	void Seek(duckdb::FileHandle &handle, duckdb::idx_t location) override;
+	duckdb::idx_t SeekPosition(duckdb::FileHandle &handle) override;
+	bool CanHandleFile(const std::string &fpath) override;
+	bool CanSeek() override {
+		return true;
+	}
+	bool OnDiskFile(duckdb::FileHandle &handle) override {
+		return false;
+	}
+	std::string GetName() const override {
+		return "JSFileSystem - " + prefix;
+	}
+
+private:
+	//! Issues a request to JS and blocks until it has been answered
+	void Call(JSFSRequest &request);
+	int64_t FetchSize(const std::string &path);
+
+	std::string prefix;
+	duckdb_node_fs_function_t jsfs;
+	JSFileSystemOptions options;
+	duckdb::unique_ptr<JSBlockCache> cache;
+};
+
 struct TaskHolder {
-	duckdb::unique_ptr<Task> task;
+	// executed in order within one worker hop, more than one only for pipelined tasks
+	duckdb::vector<duckdb::unique_ptr<Task>> tasks;
 	napi_async_work request;
 	Database *db;
 };
@@ -226,9 +535,29 @@ public:
 	static Napi::Object CreateError(Napi::Env env, std::string msg);
 	static bool OtherIsInt(Napi::Number source);
 
+	static bool IsPlainObject(const Napi::Value &source);
+
 	static duckdb::Value BindParameter(const Napi::Value source);
+	static duckdb::Value BindParameter(const Napi::Value source, const duckdb::LogicalType &type);
+	static duckdb::ErrorData ExecuteDiscardingResult(duckdb::Connection &connection,
+	                                                 duckdb::unique_ptr<duckdb::SQLStatement> statement);
 };
 
 Napi::Array EncodeDataChunk(Napi::Env env, duckdb::DataChunk &chunk, bool with_types, bool with_data);
+// Encodes a chunk owned by the result arrays: fixed-width data and BLOB values are views over the chunk memory,
+// which is released once JS drops the last of them
+Napi::Array EncodeDataChunk(Napi::Env env, std::shared_ptr<duckdb::DataChunk> chunk, bool with_types);
+struct JSONWriteOptions {
+	// BIGINT, HUGEINT and their unsigned variants as strings instead of numbers
+	bool bigint_as_string = false;
+	// one object per line instead of a JSON array
+	bool ndjson = false;
+};
+// Appends the rows of a chunk as JSON objects, mapping types like rows converted to JS values and then stringified
+void WriteJSONRows(std::string &out, duckdb::DataChunk &chunk, const vector<std::string> &names,
+                   const JSONWriteOptions &options, duckdb::idx_t rows_before);
+// A Buffer over memory kept alive by `owner`, copied if there is no owner or external buffers are not allowed
+Napi::Buffer<char> CreateExternalBuffer(Napi::Env env, const char *data, size_t size,
+                                        const std::shared_ptr<void> &owner);
 
 } // namespace node_duckdb
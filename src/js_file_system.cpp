@@ -0,0 +1,320 @@
+#include "duckdb/common/string_util.hpp"
+#include "duckdb_node.hpp"
+
+#include <condition_variable>
+#include <cstring>
+#include <list>
+
+namespace node_duckdb {
+
+// a single call into JS, answered asynchronously through the `done` callback passed along with it
+struct JSFSRequest {
+	JSFSRequest(std::string op, std::string path) : op(std::move(op)), path(std::move(path)) {
+	}
+
+	std::string op;
+	std::string path;
+	duckdb::idx_t offset = 0;
+	duckdb::idx_t length = 0;
+
+	std::string data;
+	int64_t size = -1;
+	vector<std::string> files;
+	duckdb::ErrorData error;
+
+	std::mutex lock;
+	std::condition_variable cv;
+	bool done = false;
+
+	// Called on the event loop thread, the request may be gone as soon as this returns
+	void Finish(duckdb::ErrorData result_error = duckdb::ErrorData()) {
+		std::lock_guard<std::mutex> guard(lock);
+		error = std::move(result_error);
+		done = true;
+		cv.notify_one();
+	}
+
+	void Wait() {
+		std::unique_lock<std::mutex> guard(lock);
+		cv.wait(guard, [&] { return done; });
+	}
+
+	void Complete(const Napi::CallbackInfo &info) {
+		try {
+			auto env = info.Env();
+			if (info.Length() > 0 && !info[0].IsNull() && !info[0].IsUndefined()) {
+				auto err = info[0];
+				std::string message =
+				    err.IsObject() ? err.As<Napi::Object>().Get("message").ToString() : err.ToString();
+				Finish(duckdb::ErrorData(duckdb::ExceptionType::IO, "Error in file system callback " + op + "(\"" +
+				                                                         path + "\"): " + message));
+				return;
+			}
+			auto result = info.Length() > 1 ? info[1] : env.Undefined();
+			if (op == "read") {
+				if (result.IsTypedArray()) {
+					auto array = result.As<Napi::TypedArray>();
+					data.assign((const char *)array.ArrayBuffer().Data() + array.ByteOffset(), array.ByteLength());
+				} else if (result.IsArrayBuffer()) {
+					auto array_buffer = result.As<Napi::ArrayBuffer>();
+					data.assign((const char *)array_buffer.Data(), array_buffer.ByteLength());
+				} else {
+					throw duckdb::InvalidInputException("Expected a Buffer from file system read()");
+				}
+			} else if (op == "size") {
+				if (result.IsNumber()) {
+					size = result.As<Napi::Number>().Int64Value();
+				} else if (!result.IsNull() && !result.IsUndefined()) {
+					throw duckdb::InvalidInputException("Expected a number or null from file system size()");
+				}
+			} else if (op == "glob") {
+				if (!result.IsArray()) {
+					throw duckdb::InvalidInputException("Expected an array of paths from file system glob()");
+				}
+				auto paths = result.As<Napi::Array>();
+				for (uint32_t i = 0; i < paths.Length(); i++) {
+					files.push_back(paths.Get(i).ToString());
+				}
+			}
+		} catch (const duckdb::Exception &e) {
+			Finish(duckdb::ErrorData(e));
+			return;
+		} catch (const std::exception &e) {
+			Finish(duckdb::ErrorData(e));
+			return;
+		}
+		Finish();
+	}
+};
+
+void DuckDBNodeFSLauncher(Napi::Env env, Napi::Function jsfs, std::nullptr_t *, JSFSRequest *request) {
+	if (env == nullptr) {
+		// the environment is shutting down, never leave a DuckDB thread waiting
+		request->Finish(duckdb::ErrorData(duckdb::ExceptionType::IO, "JS file system is no longer available"));
+		return;
+	}
+	try {
+		Napi::HandleScope scope(env);
+		auto done = Napi::Function::New(env, [request](const Napi::CallbackInfo &info) { request->Complete(info); });
+		jsfs({Napi::String::New(env, request->op), Napi::String::New(env, request->path),
+		      Napi::Number::New(env, (double)request->offset), Napi::Number::New(env, (double)request->length), done});
+	} catch (const std::exception &e) {
+		request->Finish(duckdb::ErrorData(e));
+	}
+}
+
+struct JSBlockCache {
+	explicit JSBlockCache(duckdb::idx_t capacity) : capacity(capacity) {
+	}
+
+	duckdb::shared_ptr<std::string> Get(const std::string &key) {
+		std::lock_guard<std::mutex> guard(lock);
+		auto entry = index.find(key);
+		if (entry == index.end()) {
+			return nullptr;
+		}
+		entries.splice(entries.begin(), entries, entry->second);
+		return entry->second->second;
+	}
+
+	void Put(const std::string &key, duckdb::shared_ptr<std::string> block) {
+		std::lock_guard<std::mutex> guard(lock);
+		if (block->size() > capacity || index.find(key) != index.end()) {
+			return;
+		}
+		size += block->size();
+		entries.emplace_front(key, std::move(block));
+		index[key] = entries.begin();
+		while (size > capacity) {
+			auto &last = entries.back();
+			size -= last.second->size();
+			index.erase(last.first);
+			entries.pop_back();
+		}
+	}
+
+	std::mutex lock;
+	duckdb::idx_t capacity;
+	duckdb::idx_t size = 0;
+	// most recently used first
+	std::list<std::pair<std::string, duckdb::shared_ptr<std::string>>> entries;
+	std::unordered_map<std::string, decltype(entries)::iterator> index;
+};
+
+struct JSFileHandle : public duckdb::FileHandle {
+	JSFileHandle(duckdb::FileSystem &file_system, std::string path, duckdb::FileOpenFlags flags, duckdb::idx_t size)
+	    : FileHandle(file_system, std::move(path), flags), size(size) {
+	}
+
+	void Close() override {
+	}
+
+	duckdb::idx_t size;
+	duckdb::idx_t position = 0;
+};
+
+static JSFileHandle &GetHandle(duckdb::FileHandle &handle) {
+	return handle.Cast<JSFileHandle>();
+}
+
+JSFileSystem::JSFileSystem(std::string prefix_p, duckdb_node_fs_function_t jsfs_p, JSFileSystemOptions options_p)
+    : prefix(std::move(prefix_p)), jsfs(std::move(jsfs_p)), options(options_p),
+      cache(duckdb::make_uniq<JSBlockCache>(options.cache_size)) {
+}
+
+JSFileSystem::~JSFileSystem() {
+	// lets the JS callback be garbage collected once the database is gone
+	jsfs.Release();
+}
+
+void JSFileSystem::Call(JSFSRequest &request) {
+	if (jsfs.BlockingCall(&request) != napi_ok) {
+		throw duckdb::IOException("JS file system %s is no longer available", prefix);
+	}
+	request.Wait();
+	if (request.error.HasError()) {
+		request.error.Throw();
+	}
+}
+
+int64_t JSFileSystem::FetchSize(const std::string &path) {
+	JSFSRequest request("size", path);
+	Call(request);
+	return request.size;
+}
+
+duckdb::unique_ptr<duckdb::FileHandle> JSFileSystem::OpenFile(const std::string &path, duckdb::FileOpenFlags flags,
+                                                              duckdb::optional_ptr<duckdb::FileOpener> opener) {
+	if (flags.OpenForWriting()) {
+		throw duckdb::NotImplementedException("Cannot open \"%s\" for writing: %s is read-only", path, GetName());
+	}
+	auto size = FetchSize(path);
+	if (size < 0) {
+		if (flags.ReturnNullIfNotExists()) {
+			return nullptr;
+		}
+		throw duckdb::IOException("Cannot open file \"%s\": No such file", path);
+	}
+	return duckdb::make_uniq<JSFileHandle>(*this, path, flags, size);
+}
+
+void JSFileSystem::Read(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes, duckdb::idx_t location) {
+	auto &js_handle = GetHandle(handle);
+	if (nr_bytes <= 0) {
+		return;
+	}
+	if (location + nr_bytes > js_handle.size) {
+		throw duckdb::IOException("Could not read all bytes from file \"%s\": wanted=%lld read=%lld", handle.path,
+		                          nr_bytes, location < js_handle.size ? int64_t(js_handle.size - location) : 0);
+	}
+	auto block_size = options.block_size;
+	auto first_block = location / block_size;
+	auto last_block = (location + nr_bytes - 1) / block_size;
+	auto key_prefix = handle.path + ":" + std::to_string(js_handle.size) + ":";
+
+	// look up the blocks covering the read, remembering the range of blocks that are missing
+	vector<duckdb::shared_ptr<std::string>> blocks(last_block - first_block + 1);
+	auto fetch_first = duckdb::DConstants::INVALID_INDEX;
+	auto fetch_last = duckdb::DConstants::INVALID_INDEX;
+	for (auto block_idx = first_block; block_idx <= last_block; block_idx++) {
+		auto &block = blocks[block_idx - first_block];
+		block = cache->Get(key_prefix + std::to_string(block_idx));
+		if (!block) {
+			if (fetch_first == duckdb::DConstants::INVALID_INDEX) {
+				fetch_first = block_idx;
+			}
+			fetch_last = block_idx;
+		}
+	}
+
+	if (fetch_first != duckdb::DConstants::INVALID_INDEX) {
+		// fetch all missing blocks plus the read-ahead with a single call
+		fetch_last =
+		    duckdb::MinValue<duckdb::idx_t>(fetch_last + options.read_ahead, (js_handle.size - 1) / block_size);
+		JSFSRequest request("read", handle.path);
+		request.offset = fetch_first * block_size;
+		request.length =
+		    duckdb::MinValue<duckdb::idx_t>((fetch_last + 1) * block_size, js_handle.size) - request.offset;
+		Call(request);
+		if (request.data.size() != request.length) {
+			throw duckdb::IOException("Could not read all bytes from file \"%s\": wanted=%llu read=%llu", handle.path,
+			                          request.length, request.data.size());
+		}
+		for (auto block_idx = fetch_first; block_idx <= fetch_last; block_idx++) {
+			auto block_offset = (block_idx - fetch_first) * block_size;
+			auto block = duckdb::make_shared_ptr<std::string>(request.data, block_offset, block_size);
+			if (block_idx <= last_block) {
+				blocks[block_idx - first_block] = block;
+			}
+			cache->Put(key_prefix + std::to_string(block_idx), std::move(block));
+		}
+	}
+
+	auto out = (char *)buffer;
+	auto end = location + nr_bytes;
+	for (auto block_idx = first_block; block_idx <= last_block; block_idx++) {
+		auto &block = *blocks[block_idx - first_block];
+		auto block_start = block_idx * block_size;
+		auto copy_start = duckdb::MaxValue<duckdb::idx_t>(location, block_start);
+		auto copy_end = duckdb::MinValue<duckdb::idx_t>(end, block_start + block.size());
+		memcpy(out + (copy_start - location), block.data() + (copy_start - block_start), copy_end - copy_start);
+	}
+}
+
+int64_t JSFileSystem::Read(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes) {
+	auto &js_handle = GetHandle(handle);
+	if (js_handle.position >= js_handle.size) {
+		return 0;
+	}
+	auto read = duckdb::MinValue<duckdb::idx_t>(nr_bytes, js_handle.size - js_handle.position);
+	Read(handle, buffer, read, js_handle.position);
+	js_handle.position += read;
+	return read;
+}
+
+int64_t JSFileSystem::GetFileSize(duckdb::FileHandle &handle) {
+	return GetHandle(handle).size;
+}
+
+duckdb::timestamp_t JSFileSystem::GetLastModifiedTime(duckdb::FileHandle &handle) {
+	// files served from JS are treated as immutable
+	return duckdb::timestamp_t(0);
+}
+
+duckdb::FileType JSFileSystem::GetFileType(duckdb::FileHandle &handle) {
+	return duckdb::FileType::FILE_TYPE_REGULAR;
+}
+
+bool JSFileSystem::FileExists(const std::string &filename, duckdb::optional_ptr<duckdb::FileOpener> opener) {
+	return FetchSize(filename) >= 0;
+}
+
+duckdb::vector<duckdb::OpenFileInfo> JSFileSystem::Glob(const std::string &path, duckdb::FileOpener *opener) {
+	duckdb::vector<duckdb::OpenFileInfo> result;
+	if (!HasGlob(path)) {
+		if (FileExists(path, nullptr)) {
+			result.emplace_back(path);
+		}
+		return result;
+	}
+	JSFSRequest request("glob", path);
+	Call(request);
+	for (auto &file : request.files) {
+		result.emplace_back(file);
+	}
+	return result;
+}
+
+void JSFileSystem::Seek(duckdb::FileHandle &handle, duckdb::idx_t location) {
+	GetHandle(handle).position = location;
+}
+
+duckdb::idx_t JSFileSystem::SeekPosition(duckdb::FileHandle &handle) {
+	return GetHandle(handle).position;
+}
+
+bool JSFileSystem::CanHandleFile(const std::string &fpath) {
+	return duckdb::StringUtil::StartsWith(fpath, prefix);
+}
+
+} // namespace node_duckdb
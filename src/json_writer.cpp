@@ -0,0 +1,272 @@
+#include "duckdb.hpp"
+#include "duckdb/common/types/date.hpp"
+#include "duckdb_node.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace node_duckdb {
+
+// Escapes like JSON.stringify: quotes, backslashes and control characters, UTF-8 is passed through
+static void WriteJSONString(std::string &out, const char *data, duckdb::idx_t size) {
+	out += '"';
+	for (duckdb::idx_t i = 0; i < size; i++) {
+		auto c = (unsigned char)data[i];
+		switch (c) {
+		case '"':
+			out += "\\\"";
+			break;
+		case '\\':
+			out += "\\\\";
+			break;
+		case '\b':
+			out += "\\b";
+			break;
+		case '\f':
+			out += "\\f";
+			break;
+		case '\n':
+			out += "\\n";
+			break;
+		case '\r':
+			out += "\\r";
+			break;
+		case '\t':
+			out += "\\t";
+			break;
+		default:
+			if (c < 0x20) {
+				char escaped[8];
+				snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+				out += escaped;
+			} else {
+				out += (char)c;
+			}
+		}
+	}
+	out += '"';
+}
+
+static void WriteJSONString(std::string &out, const std::string &str) {
+	WriteJSONString(out, str.c_str(), str.size());
+}
+
+// Numbers print like JS: integral values without a fraction, non-finite values as null
+static void WriteJSONNumber(std::string &out, double value) {
+	if (!std::isfinite(value)) {
+		out += "null";
+		return;
+	}
+	if (value == std::floor(value) && std::fabs(value) < 9007199254740992.0) {
+		out += std::to_string((int64_t)value);
+		return;
+	}
+	// use the shortest representation that round trips, as JS does
+	char buffer[32];
+	for (int precision = 1; precision <= 17; precision++) {
+		snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+		if (strtod(buffer, nullptr) == value) {
+			break;
+		}
+	}
+	out += buffer;
+}
+
+// Large integers become BigInts in rows, which JSON has no notation for: written as numbers or as strings
+static void WriteJSONBigInt(std::string &out, const std::string &digits, const JSONWriteOptions &options) {
+	if (options.bigint_as_string) {
+		WriteJSONString(out, digits);
+	} else {
+		out += digits;
+	}
+}
+
+// Dates and timestamps become JS Dates in rows, which JSON.stringify writes as ISO strings in UTC
+static void WriteJSONDate(std::string &out, int64_t epoch_ms) {
+	// beyond the range of JS dates, toJSON() returns null
+	if (epoch_ms > 8640000000000000LL || epoch_ms < -8640000000000000LL) {
+		out += "null";
+		return;
+	}
+	const int64_t ms_per_day = duckdb::Interval::SECS_PER_DAY * duckdb::Interval::MSECS_PER_SEC;
+	auto days = epoch_ms / ms_per_day;
+	auto ms_of_day = epoch_ms % ms_per_day;
+	if (ms_of_day < 0) {
+		days--;
+		ms_of_day += ms_per_day;
+	}
+	int32_t year, month, day;
+	duckdb::Date::Convert(duckdb::date_t((int32_t)days), year, month, day);
+	char buffer[48];
+	if (year >= 0 && year <= 9999) {
+		snprintf(buffer, sizeof(buffer), "%04d", year);
+	} else {
+		snprintf(buffer, sizeof(buffer), "%c%06d", year < 0 ? '-' : '+', std::abs(year));
+	}
+	out += '"';
+	out += buffer;
+	snprintf(buffer, sizeof(buffer), "-%02d-%02dT%02d:%02d:%02d.%03dZ", month, day, int(ms_of_day / 3600000),
+	         int(ms_of_day / 60000 % 60), int(ms_of_day / 1000 % 60), int(ms_of_day % 1000));
+	out += buffer;
+	out += '"';
+}
+
+static void WriteJSONValue(std::string &out, const duckdb::Value &value, const JSONWriteOptions &options) {
+	if (value.IsNull()) {
+		out += "null";
+		return;
+	}
+	switch (value.type().id()) {
+	case duckdb::LogicalTypeId::BOOLEAN:
+		out += duckdb::BooleanValue::Get(value) ? "true" : "false";
+		break;
+	case duckdb::LogicalTypeId::TINYINT:
+	case duckdb::LogicalTypeId::SMALLINT:
+	case duckdb::LogicalTypeId::INTEGER:
+	case duckdb::LogicalTypeId::UTINYINT:
+	case duckdb::LogicalTypeId::USMALLINT:
+	case duckdb::LogicalTypeId::UINTEGER:
+		out += value.ToString();
+		break;
+	case duckdb::LogicalTypeId::BIGINT:
+	case duckdb::LogicalTypeId::UBIGINT:
+	case duckdb::LogicalTypeId::HUGEINT:
+	case duckdb::LogicalTypeId::UHUGEINT:
+		WriteJSONBigInt(out, value.ToString(), options);
+		break;
+	case duckdb::LogicalTypeId::FLOAT:
+		WriteJSONNumber(out, duckdb::FloatValue::Get(value));
+		break;
+	case duckdb::LogicalTypeId::DOUBLE:
+	case duckdb::LogicalTypeId::DECIMAL:
+		WriteJSONNumber(out, value.GetValue<double>());
+		break;
+	case duckdb::LogicalTypeId::INTERVAL: {
+		auto interval = duckdb::IntervalValue::Get(value);
+		out += "{\"months\":" + std::to_string(interval.months) + ",\"days\":" + std::to_string(interval.days) +
+		       ",\"micros\":" + std::to_string(interval.micros) + "}";
+	} break;
+	case duckdb::LogicalTypeId::DATE:
+		WriteJSONDate(out, int64_t(value.GetValue<int32_t>()) * duckdb::Interval::SECS_PER_DAY *
+		                       duckdb::Interval::MSECS_PER_SEC);
+		break;
+	case duckdb::LogicalTypeId::TIMESTAMP_NS:
+		WriteJSONDate(out, value.GetValue<int64_t>() / (duckdb::Interval::MICROS_PER_MSEC * 1000));
+		break;
+	case duckdb::LogicalTypeId::TIMESTAMP_MS:
+		WriteJSONDate(out, value.GetValue<int64_t>());
+		break;
+	case duckdb::LogicalTypeId::TIMESTAMP_SEC:
+		WriteJSONDate(out, value.GetValue<int64_t>() * duckdb::Interval::MSECS_PER_SEC);
+		break;
+	case duckdb::LogicalTypeId::TIMESTAMP:
+	case duckdb::LogicalTypeId::TIMESTAMP_TZ:
+		WriteJSONDate(out, value.GetValue<int64_t>() / duckdb::Interval::MICROS_PER_MSEC);
+		break;
+	case duckdb::LogicalTypeId::VARCHAR:
+		WriteJSONString(out, duckdb::StringValue::Get(value));
+		break;
+	case duckdb::LogicalTypeId::BLOB: {
+		// what JSON.stringify makes of a Buffer
+		auto &blob = duckdb::StringValue::Get(value);
+		out += "{\"type\":\"Buffer\",\"data\":[";
+		for (duckdb::idx_t i = 0; i < blob.size(); i++) {
+			if (i > 0) {
+				out += ',';
+			}
+			out += std::to_string((unsigned char)blob[i]);
+		}
+		out += "]}";
+	} break;
+	case duckdb::LogicalTypeId::SQLNULL:
+		out += "null";
+		break;
+	case duckdb::LogicalTypeId::LIST: {
+		auto &children = duckdb::ListValue::GetChildren(value);
+		out += '[';
+		for (duckdb::idx_t i = 0; i < children.size(); i++) {
+			if (i > 0) {
+				out += ',';
+			}
+			WriteJSONValue(out, children[i], options);
+		}
+		out += ']';
+	} break;
+	case duckdb::LogicalTypeId::STRUCT: {
+		auto &child_types = duckdb::StructType::GetChildTypes(value.type());
+		auto &children = duckdb::StructValue::GetChildren(value);
+		out += '{';
+		for (duckdb::idx_t i = 0; i < children.size(); i++) {
+			if (i > 0) {
+				out += ',';
+			}
+			WriteJSONString(out, child_types[i].first);
+			out += ':';
+			WriteJSONValue(out, children[i], options);
+		}
+		out += '}';
+	} break;
+	default:
+		WriteJSONString(out, value.ToString());
+	}
+}
+
+// Flat vectors of the most common types are written without materializing a duckdb::Value per cell
+static void WriteJSONCell(std::string &out, duckdb::Vector &vec, duckdb::idx_t row_idx,
+                          const JSONWriteOptions &options) {
+	if (!duckdb::FlatVector::Validity(vec).RowIsValid(row_idx)) {
+		out += "null";
+		return;
+	}
+	switch (vec.GetType().id()) {
+	case duckdb::LogicalTypeId::BOOLEAN:
+		out += duckdb::FlatVector::GetData<bool>(vec)[row_idx] ? "true" : "false";
+		break;
+	case duckdb::LogicalTypeId::INTEGER:
+		out += std::to_string(duckdb::FlatVector::GetData<int32_t>(vec)[row_idx]);
+		break;
+	case duckdb::LogicalTypeId::BIGINT:
+		WriteJSONBigInt(out, std::to_string(duckdb::FlatVector::GetData<int64_t>(vec)[row_idx]), options);
+		break;
+	case duckdb::LogicalTypeId::DOUBLE:
+		WriteJSONNumber(out, duckdb::FlatVector::GetData<double>(vec)[row_idx]);
+		break;
+	case duckdb::LogicalTypeId::VARCHAR: {
+		auto &str = duckdb::FlatVector::GetData<duckdb::string_t>(vec)[row_idx];
+		WriteJSONString(out, str.GetData(), str.GetSize());
+	} break;
+	default:
+		WriteJSONValue(out, vec.GetValue(row_idx), options);
+	}
+}
+
+void WriteJSONRows(std::string &out, duckdb::DataChunk &chunk, const vector<std::string> &names,
+                   const JSONWriteOptions &options, duckdb::idx_t rows_before) {
+	vector<std::string> keys;
+	for (auto &name : names) {
+		keys.emplace_back();
+		WriteJSONString(keys.back(), name);
+		keys.back() += ':';
+	}
+	chunk.Flatten();
+	for (duckdb::idx_t row_idx = 0; row_idx < chunk.size(); row_idx++) {
+		if (!options.ndjson && rows_before + row_idx > 0) {
+			out += ',';
+		}
+		out += '{';
+		for (duckdb::idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+			if (col_idx > 0) {
+				out += ',';
+			}
+			out += keys[col_idx];
+			WriteJSONCell(out, chunk.data[col_idx], row_idx, options);
+		}
+		out += '}';
+		if (options.ndjson) {
+			out += '\n';
+		}
+	}
+}
+
+} // namespace node_duckdb
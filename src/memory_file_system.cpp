@@ -0,0 +1,342 @@
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/function/scalar/string_common.hpp"
+#include "duckdb_node.hpp"
+
+#include <cstring>
+
+namespace node_duckdb {
+
+struct MemoryFile {
+	std::mutex lock;
+	// bytes of a registered JS buffer, read without copying (null once the file has owned contents)
+	const char *borrowed_data = nullptr;
+	duckdb::idx_t borrowed_size = 0;
+	// owned contents, shared copy-on-write with the snapshots handed out by GetFileContents
+	duckdb::shared_ptr<std::string> contents = duckdb::make_shared_ptr<std::string>();
+	duckdb::timestamp_t last_modified = duckdb::Timestamp::GetCurrentTimestamp();
+
+	const char *Data() const {
+		return borrowed_data ? borrowed_data : contents->data();
+	}
+
+	duckdb::idx_t Size() const {
+		return borrowed_data ? borrowed_size : contents->size();
+	}
+
+	// copy borrowed bytes into owned storage, so the JS buffer can be released
+	void Detach() {
+		if (borrowed_data) {
+			contents = duckdb::make_shared_ptr<std::string>(borrowed_data, borrowed_size);
+			borrowed_data = nullptr;
+			borrowed_size = 0;
+		}
+	}
+
+	std::string &Writable() {
+		Detach();
+		if (contents.use_count() > 1) {
+			contents = duckdb::make_shared_ptr<std::string>(*contents);
+		}
+		last_modified = duckdb::Timestamp::GetCurrentTimestamp();
+		return *contents;
+	}
+};
+
+struct MemoryFileHandle : public duckdb::FileHandle {
+	MemoryFileHandle(duckdb::FileSystem &file_system, std::string path, duckdb::FileOpenFlags flags,
+	                 duckdb::shared_ptr<MemoryFile> file_p)
+	    : FileHandle(file_system, std::move(path), flags), file(std::move(file_p)) {
+	}
+
+	void Close() override {
+	}
+
+	duckdb::shared_ptr<MemoryFile> file;
+	duckdb::idx_t position = 0;
+};
+
+static MemoryFileHandle &GetHandle(duckdb::FileHandle &handle) {
+	return handle.Cast<MemoryFileHandle>();
+}
+
+// a file that leaves the file system may still be read through open handles, make sure these do not point into a
+// JS buffer that is about to be released
+static void ReleaseFile(duckdb::shared_ptr<MemoryFile> file) {
+	if (file.use_count() > 1) {
+		std::lock_guard<std::mutex> guard(file->lock);
+		file->Detach();
+	}
+}
+
+std::string NodeMemoryFileSystem::NormalizePath(const std::string &name) {
+	// paths derived by DuckDB (e.g. the temporary file of COPY ... TO) can come back as "mem:/name"
+	if (duckdb::StringUtil::StartsWith(name, "mem:")) {
+		auto start = name.find_first_not_of("/\\", 4);
+		return PREFIX + (start == std::string::npos ? std::string() : name.substr(start));
+	}
+	return PREFIX + name;
+}
+
+void NodeMemoryFileSystem::RegisterFile(const std::string &name, const char *data, duckdb::idx_t size) {
+	auto file = duckdb::make_shared_ptr<MemoryFile>();
+	file->borrowed_data = data;
+	file->borrowed_size = size;
+
+	duckdb::shared_ptr<MemoryFile> previous;
+	{
+		std::lock_guard<std::mutex> guard(files_lock);
+		auto &entry = files[NormalizePath(name)];
+		previous = std::move(entry);
+		entry = std::move(file);
+	}
+	if (previous) {
+		ReleaseFile(std::move(previous));
+	}
+}
+
+bool NodeMemoryFileSystem::UnregisterFile(const std::string &name) {
+	duckdb::shared_ptr<MemoryFile> file;
+	{
+		std::lock_guard<std::mutex> guard(files_lock);
+		auto entry = files.find(NormalizePath(name));
+		if (entry == files.end()) {
+			return false;
+		}
+		file = std::move(entry->second);
+		files.erase(entry);
+	}
+	ReleaseFile(std::move(file));
+	return true;
+}
+
+duckdb::shared_ptr<std::string> NodeMemoryFileSystem::GetFileContents(const std::string &name) {
+	auto file = FindFile(name);
+	if (!file) {
+		return nullptr;
+	}
+	std::lock_guard<std::mutex> guard(file->lock);
+	if (file->borrowed_data) {
+		return duckdb::make_shared_ptr<std::string>(file->borrowed_data, file->borrowed_size);
+	}
+	return file->contents;
+}
+
+duckdb::shared_ptr<MemoryFile> NodeMemoryFileSystem::FindFile(const std::string &path) {
+	std::lock_guard<std::mutex> guard(files_lock);
+	auto entry = files.find(NormalizePath(path));
+	if (entry == files.end()) {
+		return nullptr;
+	}
+	return entry->second;
+}
+
+duckdb::unique_ptr<duckdb::FileHandle> NodeMemoryFileSystem::OpenFile(const std::string &path,
+                                                                      duckdb::FileOpenFlags flags,
+                                                                      duckdb::optional_ptr<duckdb::FileOpener> opener) {
+	auto normalized = NormalizePath(path);
+	duckdb::shared_ptr<MemoryFile> file;
+	{
+		std::lock_guard<std::mutex> guard(files_lock);
+		auto entry = files.find(normalized);
+		if (entry != files.end()) {
+			file = entry->second;
+		} else if (flags.OpenForWriting() && (flags.CreateFileIfNotExists() || flags.OverwriteExistingFile())) {
+			file = duckdb::make_shared_ptr<MemoryFile>();
+			files[normalized] = file;
+		}
+	}
+	if (!file) {
+		if (flags.ReturnNullIfNotExists()) {
+			return nullptr;
+		}
+		throw duckdb::IOException("Cannot open file \"%s\": No such file in the memory file system", path);
+	}
+
+	auto handle = duckdb::make_uniq<MemoryFileHandle>(*this, normalized, flags, file);
+	if (flags.OpenForWriting()) {
+		std::lock_guard<std::mutex> guard(file->lock);
+		if (flags.OverwriteExistingFile()) {
+			file->Writable().clear();
+		} else if (flags.OpenForAppending()) {
+			handle->position = file->Size();
+		}
+	}
+	return std::move(handle);
+}
+
+void NodeMemoryFileSystem::Read(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes, duckdb::idx_t location) {
+	auto &file = *GetHandle(handle).file;
+	std::lock_guard<std::mutex> guard(file.lock);
+	if (location + nr_bytes > file.Size()) {
+		throw duckdb::IOException("Could not read all bytes from file \"%s\": wanted=%lld read=%lld", handle.path,
+		                          nr_bytes, location < file.Size() ? int64_t(file.Size() - location) : 0);
+	}
+	memcpy(buffer, file.Data() + location, nr_bytes);
+}
+
+int64_t NodeMemoryFileSystem::Read(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes) {
+	auto &memory_handle = GetHandle(handle);
+	auto &file = *memory_handle.file;
+	std::lock_guard<std::mutex> guard(file.lock);
+	auto size = file.Size();
+	if (memory_handle.position >= size) {
+		return 0;
+	}
+	auto read = duckdb::MinValue<duckdb::idx_t>(nr_bytes, size - memory_handle.position);
+	memcpy(buffer, file.Data() + memory_handle.position, read);
+	memory_handle.position += read;
+	return read;
+}
+
+void NodeMemoryFileSystem::Write(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes, duckdb::idx_t location) {
+	auto &file = *GetHandle(handle).file;
+	std::lock_guard<std::mutex> guard(file.lock);
+	auto &contents = file.Writable();
+	if (location + nr_bytes > contents.size()) {
+		contents.resize(location + nr_bytes);
+	}
+	memcpy(&contents[location], buffer, nr_bytes);
+}
+
+int64_t NodeMemoryFileSystem::Write(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes) {
+	auto &memory_handle = GetHandle(handle);
+	Write(handle, buffer, nr_bytes, memory_handle.position);
+	memory_handle.position += nr_bytes;
+	return nr_bytes;
+}
+
+int64_t NodeMemoryFileSystem::GetFileSize(duckdb::FileHandle &handle) {
+	auto &file = *GetHandle(handle).file;
+	std::lock_guard<std::mutex> guard(file.lock);
+	return file.Size();
+}
+
+duckdb::timestamp_t NodeMemoryFileSystem::GetLastModifiedTime(duckdb::FileHandle &handle) {
+	auto &file = *GetHandle(handle).file;
+	std::lock_guard<std::mutex> guard(file.lock);
+	return file.last_modified;
+}
+
+duckdb::FileType NodeMemoryFileSystem::GetFileType(duckdb::FileHandle &handle) {
+	return duckdb::FileType::FILE_TYPE_REGULAR;
+}
+
+void NodeMemoryFileSystem::Truncate(duckdb::FileHandle &handle, int64_t new_size) {
+	auto &file = *GetHandle(handle).file;
+	std::lock_guard<std::mutex> guard(file.lock);
+	file.Writable().resize(new_size);
+}
+
+void NodeMemoryFileSystem::FileSync(duckdb::FileHandle &handle) {
+	// nothing to flush
+}
+
+// directories only exist implicitly, as the common prefix of the files within them
+bool NodeMemoryFileSystem::DirectoryExists(const std::string &directory,
+                                           duckdb::optional_ptr<duckdb::FileOpener> opener) {
+	auto prefix = NormalizePath(directory) + "/";
+	std::lock_guard<std::mutex> guard(files_lock);
+	auto entry = files.lower_bound(prefix);
+	return entry != files.end() && duckdb::StringUtil::StartsWith(entry->first, prefix);
+}
+
+void NodeMemoryFileSystem::CreateDirectory(const std::string &directory,
+                                           duckdb::optional_ptr<duckdb::FileOpener> opener) {
+}
+
+bool NodeMemoryFileSystem::ListFiles(const std::string &directory,
+                                     const std::function<void(const std::string &, bool)> &callback,
+                                     duckdb::FileOpener *opener) {
+	auto prefix = NormalizePath(directory) + "/";
+	vector<std::pair<std::string, bool>> entries;
+	{
+		std::lock_guard<std::mutex> guard(files_lock);
+		for (auto entry = files.lower_bound(prefix);
+		     entry != files.end() && duckdb::StringUtil::StartsWith(entry->first, prefix); entry++) {
+			auto name = entry->first.substr(prefix.size());
+			auto slash = name.find('/');
+			if (slash == std::string::npos) {
+				entries.emplace_back(name, false);
+			} else if (entries.empty() || entries.back().first != name.substr(0, slash)) {
+				entries.emplace_back(name.substr(0, slash), true);
+			}
+		}
+	}
+	for (auto &entry : entries) {
+		callback(entry.first, entry.second);
+	}
+	return true;
+}
+
+void NodeMemoryFileSystem::MoveFile(const std::string &source, const std::string &target,
+                                    duckdb::optional_ptr<duckdb::FileOpener> opener) {
+	duckdb::shared_ptr<MemoryFile> previous;
+	{
+		std::lock_guard<std::mutex> guard(files_lock);
+		auto entry = files.find(NormalizePath(source));
+		if (entry == files.end()) {
+			throw duckdb::IOException("Could not rename file \"%s\": No such file in the memory file system", source);
+		}
+		auto file = std::move(entry->second);
+		files.erase(entry);
+		{
+			// registered JS buffers are tracked by name, so only the registered name may point into them
+			std::lock_guard<std::mutex> file_guard(file->lock);
+			file->Detach();
+		}
+		auto &target_entry = files[NormalizePath(target)];
+		previous = std::move(target_entry);
+		target_entry = std::move(file);
+	}
+	if (previous) {
+		ReleaseFile(std::move(previous));
+	}
+}
+
+bool NodeMemoryFileSystem::FileExists(const std::string &filename, duckdb::optional_ptr<duckdb::FileOpener> opener) {
+	return FindFile(filename) != nullptr;
+}
+
+void NodeMemoryFileSystem::RemoveFile(const std::string &filename, duckdb::optional_ptr<duckdb::FileOpener> opener) {
+	if (!UnregisterFile(filename)) {
+		throw duckdb::IOException("Could not remove file \"%s\": No such file in the memory file system", filename);
+	}
+}
+
+bool NodeMemoryFileSystem::TryRemoveFile(const std::string &filename,
+                                         duckdb::optional_ptr<duckdb::FileOpener> opener) {
+	return UnregisterFile(filename);
+}
+
+duckdb::vector<duckdb::OpenFileInfo> NodeMemoryFileSystem::Glob(const std::string &path, duckdb::FileOpener *opener) {
+	auto pattern = NormalizePath(path);
+	duckdb::vector<duckdb::OpenFileInfo> result;
+	std::lock_guard<std::mutex> guard(files_lock);
+	if (!HasGlob(pattern)) {
+		if (files.find(pattern) != files.end()) {
+			result.emplace_back(pattern);
+		}
+		return result;
+	}
+	for (auto &entry : files) {
+		if (duckdb::Glob(entry.first.c_str(), entry.first.size(), pattern.c_str(), pattern.size())) {
+			result.emplace_back(entry.first);
+		}
+	}
+	return result;
+}
+
+void NodeMemoryFileSystem::Seek(duckdb::FileHandle &handle, duckdb::idx_t location) {
+	GetHandle(handle).position = location;
+}
+
+duckdb::idx_t NodeMemoryFileSystem::SeekPosition(duckdb::FileHandle &handle) {
+	return GetHandle(handle).position;
+}
+
+bool NodeMemoryFileSystem::CanHandleFile(const std::string &fpath) {
+	return duckdb::StringUtil::StartsWith(fpath, "mem:");
+}
+
+} // namespace node_duckdb
@@ -0,0 +1,383 @@
+#include "duckdb/common/string_util.hpp"
+#include "duckdb_node.hpp"
+
+namespace node_duckdb {
+
+// writes smaller than this are appended to the previous chunk instead of becoming a Buffer of their own
+static constexpr duckdb::idx_t MIN_CHUNK_SIZE = 64 * 1024;
+
+ExportPipe::ExportPipe(duckdb::idx_t capacity, duckdb_node_export_function_t deliver)
+    : capacity(capacity), deliver(std::move(deliver)) {
+}
+
+void ExportPipe::Write(const char *data, duckdb::idx_t size) {
+	std::unique_lock<std::mutex> guard(lock);
+	cv.wait(guard, [&] { return cancelled || buffered < capacity; });
+	if (cancelled) {
+		throw duckdb::IOException("Export stream was closed before the export finished");
+	}
+	if (!chunks.empty() && chunks.back().size() < MIN_CHUNK_SIZE) {
+		chunks.back().append(data, size);
+	} else {
+		chunks.emplace_back(data, size);
+	}
+	buffered += size;
+	ScheduleDelivery();
+}
+
+void ExportPipe::Resume() {
+	std::lock_guard<std::mutex> guard(lock);
+	flowing = true;
+	ScheduleDelivery();
+}
+
+void ExportPipe::Cancel() {
+	std::lock_guard<std::mutex> guard(lock);
+	cancelled = true;
+	chunks.clear();
+	buffered = 0;
+	cv.notify_all();
+	if (finished) {
+		Release();
+	}
+}
+
+void ExportPipe::Finish(duckdb::ErrorData result_error) {
+	std::lock_guard<std::mutex> guard(lock);
+	finished = true;
+	error = std::move(result_error);
+	if (cancelled) {
+		Release();
+		return;
+	}
+	ScheduleDelivery();
+}
+
+void ExportPipe::ScheduleDelivery() {
+	if (released || delivery_scheduled || !flowing || (chunks.empty() && !finished)) {
+		return;
+	}
+	delivery_scheduled = true;
+	auto self = new duckdb::shared_ptr<ExportPipe>(shared_from_this());
+	if (deliver.NonBlockingCall(self) != napi_ok) {
+		delete self;
+		delivery_scheduled = false;
+	}
+}
+
+void ExportPipe::Release() {
+	if (!released) {
+		released = true;
+		deliver.Release();
+	}
+}
+
+void ExportPipe::Deliver(Napi::Env env, Napi::Function deliver_fn) {
+	Napi::HandleScope scope(env);
+	while (true) {
+		duckdb::shared_ptr<std::string> chunk;
+		bool end = false;
+		duckdb::ErrorData end_error;
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			delivery_scheduled = false;
+			if (cancelled || released || !flowing) {
+				return;
+			}
+			if (!chunks.empty()) {
+				chunk = duckdb::make_shared_ptr<std::string>(std::move(chunks.front()));
+				chunks.pop_front();
+				buffered -= chunk->size();
+				cv.notify_all();
+			} else if (finished) {
+				end = true;
+				end_error = error;
+				Release();
+			} else {
+				return;
+			}
+		}
+		if (end) {
+			auto err = end_error.HasError() ? Napi::Value(Utils::CreateError(env, end_error)) : env.Null();
+			deliver_fn.Call({err, env.Null()});
+			return;
+		}
+		// the Buffer keeps the chunk alive instead of copying it
+		std::shared_ptr<void> owner(chunk.get(), [chunk](void *) {});
+		auto more = deliver_fn.Call({env.Null(), CreateExternalBuffer(env, chunk->data(), chunk->size(), owner)});
+		if (!more.ToBoolean()) {
+			std::lock_guard<std::mutex> guard(lock);
+			flowing = false;
+		}
+	}
+}
+
+void DuckDBNodeExportLauncher(Napi::Env env, Napi::Function deliver, std::nullptr_t *,
+                              duckdb::shared_ptr<ExportPipe> *pipe) {
+	if (env == nullptr) {
+		// the environment is shutting down, never leave a DuckDB thread blocked on a full pipe
+		(*pipe)->Cancel();
+	} else {
+		try {
+			(*pipe)->Deliver(env, deliver);
+		} catch (const std::exception &e) {
+			(*pipe)->Cancel();
+		}
+	}
+	delete pipe;
+}
+
+IngestPipe::IngestPipe(duckdb::idx_t capacity, duckdb_node_ingest_function_t drain)
+    : capacity(capacity), drain(std::move(drain)) {
+}
+
+bool IngestPipe::Push(const char *data, duckdb::idx_t size) {
+	std::lock_guard<std::mutex> guard(lock);
+	if (ended || cancelled || released) {
+		return true;
+	}
+	if (size > 0) {
+		if (!chunks.empty() && chunks.back().size() < MIN_CHUNK_SIZE) {
+			chunks.back().append(data, size);
+		} else {
+			chunks.emplace_back(data, size);
+		}
+		buffered += size;
+		cv.notify_all();
+	}
+	if (buffered < capacity) {
+		return true;
+	}
+	drain_pending = true;
+	return false;
+}
+
+void IngestPipe::End() {
+	std::lock_guard<std::mutex> guard(lock);
+	ended = true;
+	cv.notify_all();
+}
+
+void IngestPipe::Cancel() {
+	std::lock_guard<std::mutex> guard(lock);
+	cancelled = true;
+	chunks.clear();
+	offset = 0;
+	buffered = 0;
+	cv.notify_all();
+}
+
+void IngestPipe::Finish() {
+	std::lock_guard<std::mutex> guard(lock);
+	if (!released) {
+		released = true;
+		drain.Release();
+	}
+}
+
+duckdb::idx_t IngestPipe::Read(char *buffer, duckdb::idx_t size) {
+	std::unique_lock<std::mutex> guard(lock);
+	cv.wait(guard, [&] { return cancelled || ended || !chunks.empty(); });
+	if (cancelled) {
+		throw duckdb::IOException("Insert stream was destroyed before it ended");
+	}
+	duckdb::idx_t read = 0;
+	while (read < size && !chunks.empty()) {
+		auto &chunk = chunks.front();
+		auto count = duckdb::MinValue<duckdb::idx_t>(size - read, chunk.size() - offset);
+		memcpy(buffer + read, chunk.data() + offset, count);
+		read += count;
+		offset += count;
+		if (offset == chunk.size()) {
+			chunks.pop_front();
+			offset = 0;
+		}
+	}
+	buffered -= read;
+	if (drain_pending && buffered < capacity && !released) {
+		drain_pending = false;
+		auto self = new duckdb::shared_ptr<IngestPipe>(shared_from_this());
+		if (drain.NonBlockingCall(self) != napi_ok) {
+			delete self;
+		}
+	}
+	return read;
+}
+
+void IngestPipe::Drain(Napi::Env env, Napi::Function drain_fn) {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		if (released) {
+			return;
+		}
+	}
+	Napi::HandleScope scope(env);
+	drain_fn.Call({});
+}
+
+void DuckDBNodeIngestLauncher(Napi::Env env, Napi::Function drain, std::nullptr_t *,
+                              duckdb::shared_ptr<IngestPipe> *pipe) {
+	if (env == nullptr) {
+		// the environment is shutting down, never leave a DuckDB thread waiting for data
+		(*pipe)->Cancel();
+	} else {
+		try {
+			(*pipe)->Drain(env, drain);
+		} catch (const std::exception &e) {
+			(*pipe)->Cancel();
+		}
+	}
+	delete pipe;
+}
+
+struct PipeFileHandle : public duckdb::FileHandle {
+	PipeFileHandle(duckdb::FileSystem &file_system, std::string path, duckdb::FileOpenFlags flags,
+	               duckdb::shared_ptr<ExportPipe> export_pipe, duckdb::shared_ptr<IngestPipe> ingest_pipe)
+	    : FileHandle(file_system, std::move(path), flags), export_pipe(std::move(export_pipe)),
+	      ingest_pipe(std::move(ingest_pipe)) {
+	}
+
+	void Close() override {
+	}
+
+	//! set for handles opened for writing
+	duckdb::shared_ptr<ExportPipe> export_pipe;
+	//! set for handles opened for reading
+	duckdb::shared_ptr<IngestPipe> ingest_pipe;
+	//! bytes written or read so far
+	duckdb::idx_t position = 0;
+};
+
+static PipeFileHandle &GetHandle(duckdb::FileHandle &handle) {
+	return handle.Cast<PipeFileHandle>();
+}
+
+std::string NodePipeFileSystem::Register(duckdb::shared_ptr<ExportPipe> pipe) {
+	std::lock_guard<std::mutex> guard(pipes_lock);
+	auto path = std::string(PREFIX) + std::to_string(next_pipe_id++);
+	export_pipes[path] = std::move(pipe);
+	return path;
+}
+
+std::string NodePipeFileSystem::Register(duckdb::shared_ptr<IngestPipe> pipe) {
+	std::lock_guard<std::mutex> guard(pipes_lock);
+	auto path = std::string(PREFIX) + std::to_string(next_pipe_id++);
+	ingest_pipes[path] = std::move(pipe);
+	return path;
+}
+
+void NodePipeFileSystem::Unregister(const std::string &path) {
+	std::lock_guard<std::mutex> guard(pipes_lock);
+	export_pipes.erase(path);
+	ingest_pipes.erase(path);
+}
+
+duckdb::unique_ptr<duckdb::FileHandle> NodePipeFileSystem::OpenFile(const std::string &path,
+                                                                    duckdb::FileOpenFlags flags,
+                                                                    duckdb::optional_ptr<duckdb::FileOpener> opener) {
+	if (flags.OpenForReading() && flags.OpenForWriting()) {
+		throw duckdb::NotImplementedException("Cannot open \"%s\" for reading and writing: pipes go one way", path);
+	}
+	std::lock_guard<std::mutex> guard(pipes_lock);
+	if (flags.OpenForWriting()) {
+		auto entry = export_pipes.find(path);
+		if (entry != export_pipes.end()) {
+			return duckdb::make_uniq<PipeFileHandle>(*this, path, flags, entry->second, nullptr);
+		}
+	} else {
+		auto entry = ingest_pipes.find(path);
+		if (entry != ingest_pipes.end()) {
+			return duckdb::make_uniq<PipeFileHandle>(*this, path, flags, nullptr, entry->second);
+		}
+	}
+	throw duckdb::IOException("Cannot open file \"%s\": No such pipe", path);
+}
+
+void NodePipeFileSystem::Read(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes, duckdb::idx_t location) {
+	if (location != GetHandle(handle).position) {
+		throw duckdb::NotImplementedException("Cannot seek in \"%s\": pipes are read sequentially", handle.path);
+	}
+	// unlike the cursor variant, a positional read has to fill the whole buffer
+	auto data = (char *)buffer;
+	while (nr_bytes > 0) {
+		auto read = Read(handle, data, nr_bytes);
+		if (read == 0) {
+			throw duckdb::IOException("Could not read %lld bytes from \"%s\": end of stream", nr_bytes, handle.path);
+		}
+		data += read;
+		nr_bytes -= read;
+	}
+}
+
+int64_t NodePipeFileSystem::Read(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes) {
+	auto &pipe_handle = GetHandle(handle);
+	if (!pipe_handle.ingest_pipe) {
+		throw duckdb::NotImplementedException("Cannot read from \"%s\": pipe is write-only", handle.path);
+	}
+	if (nr_bytes <= 0) {
+		return 0;
+	}
+	auto read = pipe_handle.ingest_pipe->Read((char *)buffer, nr_bytes);
+	pipe_handle.position += read;
+	return read;
+}
+
+void NodePipeFileSystem::Write(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes, duckdb::idx_t location) {
+	if (location != GetHandle(handle).position) {
+		throw duckdb::NotImplementedException("Cannot seek in \"%s\": pipes are written sequentially", handle.path);
+	}
+	Write(handle, buffer, nr_bytes);
+}
+
+int64_t NodePipeFileSystem::Write(duckdb::FileHandle &handle, void *buffer, int64_t nr_bytes) {
+	auto &pipe_handle = GetHandle(handle);
+	if (!pipe_handle.export_pipe) {
+		throw duckdb::NotImplementedException("Cannot write to \"%s\": pipe is read-only", handle.path);
+	}
+	if (nr_bytes > 0) {
+		pipe_handle.export_pipe->Write((const char *)buffer, nr_bytes);
+		pipe_handle.position += nr_bytes;
+	}
+	return nr_bytes;
+}
+
+int64_t NodePipeFileSystem::GetFileSize(duckdb::FileHandle &handle) {
+	auto &pipe_handle = GetHandle(handle);
+	// the size of a stream that is being read is not known up front
+	return pipe_handle.export_pipe ? pipe_handle.position : 0;
+}
+
+duckdb::FileType NodePipeFileSystem::GetFileType(duckdb::FileHandle &handle) {
+	return duckdb::FileType::FILE_TYPE_FIFO;
+}
+
+void NodePipeFileSystem::FileSync(duckdb::FileHandle &handle) {
+}
+
+bool NodePipeFileSystem::FileExists(const std::string &filename, duckdb::optional_ptr<duckdb::FileOpener> opener) {
+	// pipes written to only ever receive fresh output, nothing needs to be overwritten
+	std::lock_guard<std::mutex> guard(pipes_lock);
+	return ingest_pipes.find(filename) != ingest_pipes.end();
+}
+
+bool NodePipeFileSystem::IsPipe(const std::string &filename, duckdb::optional_ptr<duckdb::FileOpener> opener) {
+	return true;
+}
+
+duckdb::vector<duckdb::OpenFileInfo> NodePipeFileSystem::Glob(const std::string &path, duckdb::FileOpener *opener) {
+	duckdb::vector<duckdb::OpenFileInfo> result;
+	if (FileExists(path, nullptr)) {
+		result.emplace_back(path);
+	}
+	return result;
+}
+
+duckdb::idx_t NodePipeFileSystem::SeekPosition(duckdb::FileHandle &handle) {
+	return GetHandle(handle).position;
+}
+
+bool NodePipeFileSystem::CanHandleFile(const std::string &fpath) {
+	return duckdb::StringUtil::StartsWith(fpath, PREFIX);
+}
+
+} // namespace node_duckdb
@@ -24,6 +24,9 @@ Napi::FunctionReference Statement::Init(Napi::Env env, Napi::Object exports) {
 	    DefineClass(env, "Statement",
 	                {InstanceMethod("run", &Statement::Run), InstanceMethod("all", &Statement::All),
 	                 InstanceMethod("arrowIPCAll", &Statement::ArrowIPCAll), InstanceMethod("each", &Statement::Each),
+	                 InstanceMethod("eachChunk", &Statement::EachChunk),
+	                 InstanceMethod("allColumnar", &Statement::AllColumnar),
+	                 InstanceMethod("all_json_internal", &Statement::AllJSON),
 	                 InstanceMethod("finalize", &Statement::Finish), InstanceMethod("stream", &Statement::Stream),
 	                 InstanceMethod("columns", &Statement::Columns)});
 
@@ -48,11 +51,11 @@ static unique_ptr<duckdb::PreparedStatement> PrepareManyInternal(Statement &stat
 
 		// if there are multiple statements, we directly execute the statements besides the last one
 		// we only return the result of the last statement to the user, unless one of the previous statements fails
+		// their results are discarded while streaming instead of being materialized first
 		for (idx_t i = 0; i + 1 < statements.size(); i++) {
-			auto pending_query = connection->PendingQuery(std::move(statements[i]));
-			auto res = pending_query->Execute();
-			if (res->HasError()) {
-				return duckdb::make_uniq<duckdb::PreparedStatement>(res->GetErrorObject());
+			auto error = Utils::ExecuteDiscardingResult(*connection, std::move(statements[i]));
+			if (error.HasError()) {
+				return duckdb::make_uniq<duckdb::PreparedStatement>(std::move(error));
 			}
 		}
 
@@ -64,13 +67,38 @@ static unique_ptr<duckdb::PreparedStatement> PrepareManyInternal(Statement &stat
 	}
 }
 
+// Positional parameters are identified by their number, anything else is a named ($name) parameter
+static bool HasNamedParameters(const duckdb::case_insensitive_map_t<idx_t> &named_param_map) {
+	for (auto &entry : named_param_map) {
+		auto &identifier = entry.first;
+		if (!std::all_of(identifier.begin(), identifier.end(), duckdb::StringUtil::CharacterIsDigit)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 struct PrepareTask : public Task {
 	PrepareTask(Statement &statement, Napi::Function callback) : Task(statement, callback) {
+		pipeline = statement.connection_ref->PipelineOrNull();
 	}
 
 	void DoWork() override {
 		auto &statement = Get<Statement>();
 		statement.statement = PrepareManyInternal(statement);
+		if (!statement.statement->HasError()) {
+			parameter_types = duckdb::make_uniq<duckdb::case_insensitive_map_t<duckdb::LogicalType>>(
+			    statement.statement->GetExpectedParameterTypes());
+			named_parameters = HasNamedParameters(statement.statement->named_param_map);
+		}
+	}
+
+	void DoCallback() override {
+		// parameters bound from now on are converted to the expected types directly
+		auto &statement = Get<Statement>();
+		statement.parameter_types = std::move(parameter_types);
+		statement.named_parameters = named_parameters;
+		Task::DoCallback();
 	}
 
 	void Callback() override {
@@ -85,6 +113,9 @@ struct PrepareTask : public Task {
 		}
 		cb.MakeCallback(statement.Value(), {env.Null(), statement.Value()});
 	}
+
+	duckdb::unique_ptr<duckdb::case_insensitive_map_t<duckdb::LogicalType>> parameter_types;
+	bool named_parameters = false;
 };
 
 Statement::Statement(const Napi::CallbackInfo &info) : Napi::ObjectWrap<Statement>(info) {
@@ -249,20 +280,134 @@ static Napi::Value convert_col_val(Napi::Env &env, duckdb::Value dval, duckdb::L
 	return value;
 }
 
-static Napi::Value convert_chunk(Napi::Env &env, vector<std::string> names, duckdb::DataChunk &chunk) {
+// Converts all rows of a nested vector at once, reading the children straight from the child vectors instead of
+// materializing (and copying) a duckdb::Value per row. BLOB values are views over the vector memory kept alive by
+// `owner`.
+static Napi::Array convert_vector(Napi::Env &env, duckdb::Vector &vec, duckdb::idx_t count,
+                                  const std::shared_ptr<void> &owner) {
+	vec.Flatten(count);
+	auto &validity = duckdb::FlatVector::Validity(vec);
+	auto &type = vec.GetType();
+	Napi::Array result(Napi::Array::New(env, count));
+
+	switch (type.id()) {
+	case duckdb::LogicalTypeId::LIST: {
+		auto entries = duckdb::FlatVector::GetData<duckdb::list_entry_t>(vec);
+		auto child_values =
+		    convert_vector(env, duckdb::ListVector::GetEntry(vec), duckdb::ListVector::GetListSize(vec), owner);
+		for (duckdb::idx_t row_idx = 0; row_idx < count; row_idx++) {
+			if (!validity.RowIsValid(row_idx)) {
+				result.Set(row_idx, env.Null());
+				continue;
+			}
+			auto &entry = entries[row_idx];
+			auto list = Napi::Array::New(env, entry.length);
+			for (duckdb::idx_t child_idx = 0; child_idx < entry.length; child_idx++) {
+				list.Set(child_idx, child_values.Get(entry.offset + child_idx));
+			}
+			result.Set(row_idx, list);
+		}
+	} break;
+	case duckdb::LogicalTypeId::STRUCT: {
+		auto &child_types = duckdb::StructType::GetChildTypes(type);
+		auto &entries = duckdb::StructVector::GetEntries(vec);
+		vector<Napi::String> child_names;
+		vector<Napi::Array> child_values;
+		for (duckdb::idx_t child_idx = 0; child_idx < entries.size(); child_idx++) {
+			child_names.push_back(Napi::String::New(env, child_types[child_idx].first));
+			child_values.push_back(convert_vector(env, *entries[child_idx], count, owner));
+		}
+		for (duckdb::idx_t row_idx = 0; row_idx < count; row_idx++) {
+			if (!validity.RowIsValid(row_idx)) {
+				result.Set(row_idx, env.Null());
+				continue;
+			}
+			auto object_value = Napi::Object::New(env);
+			for (duckdb::idx_t child_idx = 0; child_idx < entries.size(); child_idx++) {
+				object_value.Set(child_names[child_idx], child_values[child_idx].Get(row_idx));
+			}
+			result.Set(row_idx, object_value);
+		}
+	} break;
+	case duckdb::LogicalTypeId::INTEGER: {
+		auto data = duckdb::FlatVector::GetData<int32_t>(vec);
+		for (duckdb::idx_t row_idx = 0; row_idx < count; row_idx++) {
+			result.Set(row_idx, validity.RowIsValid(row_idx) ? Napi::Number::New(env, data[row_idx]) : env.Null());
+		}
+	} break;
+	case duckdb::LogicalTypeId::FLOAT: {
+		auto data = duckdb::FlatVector::GetData<float>(vec);
+		for (duckdb::idx_t row_idx = 0; row_idx < count; row_idx++) {
+			result.Set(row_idx, validity.RowIsValid(row_idx) ? Napi::Number::New(env, data[row_idx]) : env.Null());
+		}
+	} break;
+	case duckdb::LogicalTypeId::DOUBLE: {
+		auto data = duckdb::FlatVector::GetData<double>(vec);
+		for (duckdb::idx_t row_idx = 0; row_idx < count; row_idx++) {
+			result.Set(row_idx, validity.RowIsValid(row_idx) ? Napi::Number::New(env, data[row_idx]) : env.Null());
+		}
+	} break;
+	case duckdb::LogicalTypeId::VARCHAR: {
+		auto data = duckdb::FlatVector::GetData<duckdb::string_t>(vec);
+		for (duckdb::idx_t row_idx = 0; row_idx < count; row_idx++) {
+			if (!validity.RowIsValid(row_idx)) {
+				result.Set(row_idx, env.Null());
+				continue;
+			}
+			result.Set(row_idx, Napi::String::New(env, data[row_idx].GetData(), data[row_idx].GetSize()));
+		}
+	} break;
+	case duckdb::LogicalTypeId::BLOB: {
+		auto data = duckdb::FlatVector::GetData<duckdb::string_t>(vec);
+		for (duckdb::idx_t row_idx = 0; row_idx < count; row_idx++) {
+			if (!validity.RowIsValid(row_idx)) {
+				result.Set(row_idx, env.Null());
+				continue;
+			}
+			// inlined values are cheaper to copy than to keep the whole chunk alive for
+			auto size = data[row_idx].GetSize();
+			result.Set(row_idx, CreateExternalBuffer(env, data[row_idx].GetData(), size,
+			                                         size > duckdb::string_t::INLINE_LENGTH ? owner : nullptr));
+		}
+	} break;
+	default:
+		for (duckdb::idx_t row_idx = 0; row_idx < count; row_idx++) {
+			result.Set(row_idx, convert_col_val(env, vec.GetValue(row_idx), type.id()));
+		}
+	}
+	return result;
+}
+
+static Napi::Value convert_chunk(Napi::Env &env, vector<std::string> names,
+                                 const std::shared_ptr<duckdb::DataChunk> &chunk_ptr) {
 	Napi::EscapableHandleScope scope(env);
+	auto &chunk = *chunk_ptr;
 	vector<Napi::String> node_names;
 	assert(names.size() == chunk.ColumnCount());
 	node_names.reserve(names.size());
 	for (auto &name : names) {
 		node_names.push_back(Napi::String::New(env, name));
 	}
+	// nested and BLOB columns are converted column-wise up front, BLOBs share the chunk memory
+	vector<Napi::Array> column_values(chunk.ColumnCount());
+	for (duckdb::idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+		auto id = chunk.data[col_idx].GetType().id();
+		if (id == duckdb::LogicalTypeId::LIST || id == duckdb::LogicalTypeId::STRUCT ||
+		    id == duckdb::LogicalTypeId::BLOB) {
+			column_values[col_idx] = convert_vector(env, chunk.data[col_idx], chunk.size(), chunk_ptr);
+		}
+	}
+
 	Napi::Array result(Napi::Array::New(env, chunk.size()));
 
 	for (duckdb::idx_t row_idx = 0; row_idx < chunk.size(); row_idx++) {
 		Napi::Object row_result = Napi::Object::New(env);
 
 		for (duckdb::idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+			if (!column_values[col_idx].IsEmpty()) {
+				row_result.Set(node_names[col_idx], column_values[col_idx].Get(row_idx));
+				continue;
+			}
 			duckdb::Value dval = chunk.GetValue(col_idx, row_idx);
 			row_result.Set(node_names[col_idx], convert_col_val(env, dval, chunk.data[col_idx].GetType().id()));
 		}
@@ -272,17 +417,132 @@ static Napi::Value convert_chunk(Napi::Env &env, vector<std::string> names, duck
 	return scope.Escape(result);
 }
 
-enum RunType { RUN, EACH, ALL, ARROW_ALL };
+enum RunType { RUN, EACH, ALL, ARROW_ALL, ALL_COLUMNAR };
 
 struct StatementParam {
 	vector<duckdb::Value> params;
+	// filled when the only parameter is a plain object, used if the statement has named parameters
+	duckdb::case_insensitive_map_t<duckdb::BoundParameterData> named_params;
+	// the JS values passed before the statement was prepared (e.g. by db.all(sql, ...params)), these are bound in
+	// BeforeWork of the task executing the statement, see BindUnboundValues
+	Napi::Reference<Napi::Array> unbound_values;
+	// set if the values were bound by inference before the statement was prepared, they are cast to the expected
+	// types on the worker thread
+	bool cast_to_expected_types = false;
+	// set if binding the unbound values failed
+	std::string bind_error;
 	Napi::Function callback;
 	Napi::Function complete;
 };
 
+// Converts the JS values into the parameters of the statement, straight into the expected types if they are known
+static void BindValues(StatementParam &params, const vector<Napi::Value> &values,
+                       const duckdb::case_insensitive_map_t<duckdb::LogicalType> *parameter_types,
+                       bool named_parameters) {
+	auto type_of = [&](const std::string &identifier) {
+		if (parameter_types) {
+			auto entry = parameter_types->find(identifier);
+			if (entry != parameter_types->end()) {
+				return entry->second;
+			}
+		}
+		return duckdb::LogicalType(duckdb::LogicalTypeId::UNKNOWN);
+	};
+
+	// a single object binds named parameters ($name), unless we already know the statement has none
+	if (values.size() == 1 && Utils::IsPlainObject(values[0]) && (!parameter_types || named_parameters)) {
+		auto object = values[0].As<Napi::Object>();
+		auto keys = object.GetPropertyNames();
+		for (uint32_t i = 0; i < keys.Length(); i++) {
+			std::string key = keys.Get(i).ToString();
+			params.named_params[key] = duckdb::BoundParameterData(Utils::BindParameter(object.Get(key), type_of(key)));
+		}
+		if (named_parameters) {
+			return;
+		}
+	}
+	for (idx_t i = 0; i < values.size(); i++) {
+		params.params.push_back(Utils::BindParameter(values[i], type_of(std::to_string(i + 1))));
+	}
+}
+
+// Binds the values passed before the statement was prepared. Only call from BeforeWork: if the prepare task has
+// completed, the values are bound straight into the expected types. Otherwise it runs in the same worker hop (see
+// Database::Process), so the values are bound by inference and cast by CastToExpectedTypes once it has run
+static void BindUnboundValues(Statement &statement, StatementParam &params) {
+	if (params.unbound_values.IsEmpty()) {
+		return;
+	}
+	Napi::HandleScope scope(statement.Env());
+	auto unbound_values = params.unbound_values.Value();
+	vector<Napi::Value> values;
+	for (uint32_t i = 0; i < unbound_values.Length(); i++) {
+		values.push_back(unbound_values.Get(i));
+	}
+	params.unbound_values.Reset();
+
+	unique_ptr<duckdb::case_insensitive_map_t<duckdb::LogicalType>> parameter_types;
+	bool named_parameters = false;
+	if (statement.statement && !statement.statement->HasError()) {
+		parameter_types = duckdb::make_uniq<duckdb::case_insensitive_map_t<duckdb::LogicalType>>(
+		    statement.statement->GetExpectedParameterTypes());
+		named_parameters = HasNamedParameters(statement.statement->named_param_map);
+	}
+	params.cast_to_expected_types = !statement.statement;
+	try {
+		BindValues(params, values, parameter_types.get(), named_parameters);
+	} catch (const Napi::Error &e) {
+		// e.g. a getter of a parameter object threw, reported as the error of the statement
+		params.bind_error = e.Message();
+	}
+}
+
+// Casts the values bound by inference to the types the statement expects, so it does not have to be rebound. Values
+// that cannot be cast are left to fail when the statement is executed
+static void CastToExpectedTypes(duckdb::PreparedStatement &statement, StatementParam &params) {
+	auto parameter_types = statement.GetExpectedParameterTypes();
+	auto cast = [&](const std::string &identifier, duckdb::Value &value) {
+		auto entry = parameter_types.find(identifier);
+		if (entry == parameter_types.end() || entry->second.id() == duckdb::LogicalTypeId::UNKNOWN ||
+		    value.type() == entry->second || value.IsNull()) {
+			return;
+		}
+		value.DefaultTryCastAs(entry->second);
+	};
+	for (idx_t i = 0; i < params.params.size(); i++) {
+		cast(std::to_string(i + 1), params.params[i]);
+	}
+	for (auto &entry : params.named_params) {
+		auto value = entry.second.GetValue();
+		cast(entry.first, value);
+		entry.second = duckdb::BoundParameterData(std::move(value));
+	}
+}
+
+static unique_ptr<duckdb::QueryResult> ExecuteStatement(duckdb::PreparedStatement &statement, StatementParam &params,
+                                                        bool allow_stream_result) {
+	if (!params.bind_error.empty()) {
+		return duckdb::make_uniq<duckdb::MaterializedQueryResult>(
+		    duckdb::ErrorData(duckdb::ExceptionType::INVALID_INPUT, params.bind_error));
+	}
+	if (params.cast_to_expected_types) {
+		CastToExpectedTypes(statement, params);
+		params.cast_to_expected_types = false;
+	}
+	if (!params.named_params.empty() && HasNamedParameters(statement.named_param_map)) {
+		return statement.Execute(params.named_params, allow_stream_result);
+	}
+	return statement.Execute(params.params, allow_stream_result);
+}
+
 struct RunPreparedTask : public Task {
 	RunPreparedTask(Statement &statement, unique_ptr<StatementParam> params, RunType run_type)
 	    : Task(statement, params->callback), params(std::move(params)), run_type(run_type) {
+		pipeline = statement.connection_ref->PipelineOrNull();
+	}
+
+	void BeforeWork() override {
+		BindUnboundValues(Get<Statement>(), *params);
 	}
 
 	void DoWork() override {
@@ -292,8 +552,9 @@ struct RunPreparedTask : public Task {
 			return;
 		}
 
-		result =
-		    statement.statement->Execute(params->params, run_type != RunType::ALL && run_type != RunType::ARROW_ALL);
+		result = ExecuteStatement(*statement.statement, *params,
+		                          run_type != RunType::ALL && run_type != RunType::ARROW_ALL &&
+		                              run_type != RunType::ALL_COLUMNAR);
 	}
 
 	void Callback() override {
@@ -325,12 +586,12 @@ struct RunPreparedTask : public Task {
 			while (true) {
 				Napi::HandleScope scope(env);
 
-				auto chunk = result->Fetch();
+				std::shared_ptr<duckdb::DataChunk> chunk = result->Fetch();
 				if (!chunk || chunk->size() == 0) {
 					break;
 				}
 
-				auto chunk_converted = convert_chunk(env, result->names, *chunk).ToObject();
+				auto chunk_converted = convert_chunk(env, result->names, chunk).ToObject();
 				if (!chunk_converted.IsArray()) {
 					// error was set before
 					return;
@@ -351,12 +612,12 @@ struct RunPreparedTask : public Task {
 
 			duckdb::idx_t out_idx = 0;
 			while (true) {
-				auto chunk = result->Fetch();
+				std::shared_ptr<duckdb::DataChunk> chunk = result->Fetch();
 				if (!chunk || chunk->size() == 0) {
 					break;
 				}
 				// ToObject has to happen here otherwise the converted chunk gets garbage collected for some reason
-				auto chunk_converted = convert_chunk(env, result->names, *chunk).ToObject();
+				auto chunk_converted = convert_chunk(env, result->names, chunk).ToObject();
 				if (!chunk_converted.IsArray()) {
 					// error was set before
 					return;
@@ -426,6 +687,30 @@ struct RunPreparedTask : public Task {
 
 			cb.MakeCallback(statement.Value(), {env.Null(), result_arr});
 		} break;
+		case RunType::ALL_COLUMNAR: {
+			// one batch of columns per chunk, so list offsets and child columns can be taken as-is from each chunk
+			Napi::Array batches(Napi::Array::New(env));
+			try {
+				while (true) {
+					std::shared_ptr<duckdb::DataChunk> chunk = result->Fetch();
+					if (!chunk || chunk->size() == 0) {
+						break;
+					}
+					auto columns = EncodeDataChunk(env, chunk, true);
+					for (duckdb::idx_t col_idx = 0; col_idx < chunk->ColumnCount(); col_idx++) {
+						columns.Get(col_idx).As<Napi::Object>().Set("name", result->names[col_idx]);
+					}
+					auto batch = Napi::Object::New(env);
+					batch.Set("rows", chunk->size());
+					batch.Set("columns", columns);
+					batches.Set(batches.Length(), batch);
+				}
+			} catch (const Napi::Error &e) {
+				cb.MakeCallback(statement.Value(), {e.Value()});
+				return;
+			}
+			cb.MakeCallback(statement.Value(), {env.Null(), batches});
+		} break;
 		}
 	}
 	unique_ptr<duckdb::QueryResult> result;
@@ -433,18 +718,113 @@ struct RunPreparedTask : public Task {
 	RunType run_type;
 };
 
+// State carried from one EachChunkTask to the next
+struct EachChunkState {
+	unique_ptr<StatementParam> params;
+	unique_ptr<duckdb::QueryResult> result;
+	duckdb::idx_t count = 0;
+};
+
+// Executes the statement (first time only) and fetches a single chunk on the worker thread. The task continues with
+// the next chunk until the result is exhausted, so the event loop is released between chunks. A continuation runs
+// ahead of all other queued tasks: no other task can use the connection while its streaming result is open
+struct EachChunkTask : public Task {
+	EachChunkTask(Statement &statement, unique_ptr<EachChunkState> state)
+	    : Task(statement, state->params->callback), state(std::move(state)) {
+	}
+
+	void BeforeWork() override {
+		BindUnboundValues(Get<Statement>(), *state->params);
+	}
+
+	void DoWork() override {
+		auto &statement = Get<Statement>();
+		if (!statement.statement || statement.statement->HasError()) {
+			return;
+		}
+		try {
+			if (!state->result) {
+				state->result = ExecuteStatement(*statement.statement, *state->params, true);
+			}
+			if (!state->result->HasError()) {
+				chunk = state->result->Fetch();
+			}
+		} catch (std::exception &ex) {
+			error = duckdb::ErrorData(ex);
+		}
+	}
+
+	unique_ptr<Task> Continuation() override {
+		if (error.HasError() || !chunk || chunk->size() == 0) {
+			return nullptr;
+		}
+		// fetch the next chunk before handing out this one, so the worker can fetch while JS is busy
+		names = state->result->names;
+		state->count += chunk->size();
+		return duckdb::make_uniq<EachChunkTask>(Get<Statement>(), std::move(state));
+	}
+
+	void Callback() override {
+		auto &statement = Get<Statement>();
+		Napi::Env env = statement.Env();
+		Napi::HandleScope scope(env);
+
+		auto cb = callback.Value();
+		if (!state) {
+			// continued with the next chunk
+			auto chunk_converted = convert_chunk(env, names, chunk).ToObject();
+			if (!chunk_converted.IsArray()) {
+				// error was set before
+				return;
+			}
+			cb.MakeCallback(statement.Value(), {env.Null(), chunk_converted});
+			return;
+		}
+		if (!statement.statement) {
+			cb.MakeCallback(statement.Value(), {Utils::CreateError(env, "statement was finalized")});
+			return;
+		}
+		if (statement.statement->HasError()) {
+			cb.MakeCallback(statement.Value(), {Utils::CreateError(env, statement.statement->GetErrorObject())});
+			return;
+		}
+		if (error.HasError()) {
+			cb.MakeCallback(statement.Value(), {Utils::CreateError(env, error)});
+			return;
+		}
+		if (state->result->HasError()) {
+			cb.MakeCallback(statement.Value(), {Utils::CreateError(env, state->result->GetErrorObject())});
+			return;
+		}
+
+		auto &complete = state->params->complete;
+		if (!complete.IsUndefined() && complete.IsFunction()) {
+			complete.MakeCallback(statement.Value(), {env.Null(), Napi::Number::New(env, state->count)});
+		}
+	}
+
+	unique_ptr<EachChunkState> state;
+	std::shared_ptr<duckdb::DataChunk> chunk;
+	vector<std::string> names;
+	duckdb::ErrorData error;
+};
+
 struct RunQueryTask : public Task {
 	RunQueryTask(Statement &statement, unique_ptr<StatementParam> params, Napi::Promise::Deferred deferred)
 	    : Task(statement), deferred(deferred), params(std::move(params)) {
 	}
 
+	void BeforeWork() override {
+		BindUnboundValues(Get<Statement>(), *params);
+	}
+
 	void DoWork() override {
 		auto &statement = Get<Statement>();
 		if (!statement.statement || statement.statement->HasError()) {
 			return;
 		}
 
-		result = statement.statement->Execute(params->params, true);
+		result = ExecuteStatement(*statement.statement, *params, true);
 	}
 
 	void DoCallback() override {
@@ -472,10 +852,119 @@ struct RunQueryTask : public Task {
 	unique_ptr<StatementParam> params;
 };
 
-unique_ptr<StatementParam> Statement::HandleArgs(const Napi::CallbackInfo &info) {
-	size_t start_idx = ignore_first_param ? 1 : 0;
+static JSONWriteOptions GetJSONWriteOptions(const Napi::Value &value) {
+	JSONWriteOptions options;
+	if (value.IsObject()) {
+		auto object = value.As<Napi::Object>();
+		auto bigint = object.Get("bigint");
+		if (!bigint.IsUndefined()) {
+			auto mode = bigint.ToString().Utf8Value();
+			if (mode != "string" && mode != "number") {
+				throw Napi::TypeError::New(value.Env(), "JSON option bigint must be 'string' or 'number'");
+			}
+			options.bigint_as_string = mode == "string";
+		}
+		auto format = object.Get("format");
+		if (!format.IsUndefined()) {
+			auto name = format.ToString().Utf8Value();
+			if (name != "json" && name != "ndjson") {
+				throw Napi::TypeError::New(value.Env(), "JSON option format must be 'json' or 'ndjson'");
+			}
+			options.ndjson = name == "ndjson";
+		}
+	}
+	return options;
+}
+
+// Executes the statement and writes the whole result as JSON text on the worker thread, the main thread only
+// receives the finished Buffer
+struct AllJSONTask : public Task {
+	AllJSONTask(Statement &statement, unique_ptr<StatementParam> params, JSONWriteOptions options)
+	    : Task(statement, params->callback), params(std::move(params)), options(options) {
+	}
+
+	void BeforeWork() override {
+		BindUnboundValues(Get<Statement>(), *params);
+	}
+
+	void DoWork() override {
+		auto &statement = Get<Statement>();
+		if (!statement.statement || statement.statement->HasError()) {
+			return;
+		}
+		try {
+			auto result = ExecuteStatement(*statement.statement, *params, true);
+			if (result->HasError()) {
+				error = result->GetErrorObject();
+				return;
+			}
+			if (!options.ndjson) {
+				*json += '[';
+			}
+			duckdb::idx_t count = 0;
+			while (true) {
+				auto chunk = result->Fetch();
+				if (!chunk || chunk->size() == 0) {
+					break;
+				}
+				WriteJSONRows(*json, *chunk, result->names, options, count);
+				count += chunk->size();
+			}
+			if (result->HasError()) {
+				error = result->GetErrorObject();
+				return;
+			}
+			if (!options.ndjson) {
+				*json += ']';
+			}
+		} catch (std::exception &ex) {
+			error = duckdb::ErrorData(ex);
+		}
+	}
+
+	void Callback() override {
+		auto &statement = Get<Statement>();
+		Napi::Env env = statement.Env();
+		Napi::HandleScope scope(env);
+
+		auto cb = callback.Value();
+		if (!statement.statement) {
+			cb.MakeCallback(statement.Value(), {Utils::CreateError(env, "statement was finalized")});
+			return;
+		}
+		if (statement.statement->HasError()) {
+			cb.MakeCallback(statement.Value(), {Utils::CreateError(env, statement.statement->GetErrorObject())});
+			return;
+		}
+		if (error.HasError()) {
+			cb.MakeCallback(statement.Value(), {Utils::CreateError(env, error)});
+			return;
+		}
+		cb.MakeCallback(statement.Value(), {env.Null(), CreateExternalBuffer(env, json->data(), json->size(), json)});
+	}
+
+	unique_ptr<StatementParam> params;
+	JSONWriteOptions options;
+	std::shared_ptr<std::string> json = std::make_shared<std::string>();
+	duckdb::ErrorData error;
+};
+
+Napi::Value Statement::AllJSON(const Napi::CallbackInfo &info) {
+	auto options = GetJSONWriteOptions(info.Length() > 0 ? info[0] : info.Env().Undefined());
+	auto params = HandleArgs(info, 1);
+	if (params->callback.IsUndefined()) {
+		throw Napi::TypeError::New(info.Env(), "Callback expected");
+	}
+	connection_ref->database_ref->Schedule(info.Env(),
+	                                       duckdb::make_uniq<AllJSONTask>(*this, std::move(params), options));
+	return info.This();
+}
+
+unique_ptr<StatementParam> Statement::HandleArgs(const Napi::CallbackInfo &info, size_t first_arg) {
+	size_t start_idx = (ignore_first_param ? 1 : 0) + first_arg;
 	auto params = duckdb::make_uniq<StatementParam>();
 
+	vector<Napi::Value> values;
 	for (auto i = start_idx; i < info.Length(); i++) {
 		auto &p = info[i];
 		if (p.IsFunction()) {
@@ -489,8 +978,19 @@ unique_ptr<StatementParam> Statement::HandleArgs(const Napi::CallbackInfo &info)
 		if (p.IsUndefined()) {
 			continue;
 		}
-		params->params.push_back(Utils::BindParameter(p));
+		values.push_back(p);
+	}
+
+	if (parameter_types || values.empty()) {
+		BindValues(*params, values, parameter_types.get(), named_parameters);
+		return params;
+	}
+	// not prepared yet: keep the values until the expected types are known, see BindUnboundValues
+	auto unbound_values = Napi::Array::New(info.Env(), values.size());
+	for (uint32_t i = 0; i < values.size(); i++) {
+		unbound_values.Set(i, values[i]);
 	}
+	params->unbound_values = Napi::Persistent(unbound_values);
 	return params;
 }
 
@@ -506,6 +1006,12 @@ Napi::Value Statement::ArrowIPCAll(const Napi::CallbackInfo &info) {
 	return info.This();
 }
 
+Napi::Value Statement::AllColumnar(const Napi::CallbackInfo &info) {
+	connection_ref->database_ref->Schedule(
+	    info.Env(), duckdb::make_uniq<RunPreparedTask>(*this, HandleArgs(info), RunType::ALL_COLUMNAR));
+	return info.This();
+}
+
 Napi::Value Statement::Run(const Napi::CallbackInfo &info) {
 	connection_ref->database_ref->Schedule(info.Env(),
 	                                       duckdb::make_uniq<RunPreparedTask>(*this, HandleArgs(info), RunType::RUN));
@@ -518,6 +1024,16 @@ Napi::Value Statement::Each(const Napi::CallbackInfo &info) {
 	return info.This();
 }
 
+Napi::Value Statement::EachChunk(const Napi::CallbackInfo &info) {
+	auto state = duckdb::make_uniq<EachChunkState>();
+	state->params = HandleArgs(info);
+	if (state->params->callback.IsUndefined()) {
+		throw Napi::TypeError::New(info.Env(), "Callback expected");
+	}
+	connection_ref->database_ref->Schedule(info.Env(), duckdb::make_uniq<EachChunkTask>(*this, std::move(state)));
+	return info.This();
+}
+
 Napi::Value Statement::Stream(const Napi::CallbackInfo &info) {
 	auto deferred = Napi::Promise::Deferred::New(info.Env());
 	connection_ref->database_ref->Schedule(info.Env(),
@@ -616,6 +1132,7 @@ Napi::Value Statement::Columns(const Napi::CallbackInfo &info) {
 
 struct FinishTask : public Task {
 	FinishTask(Statement &statement, Napi::Function callback) : Task(statement, callback) {
+		pipeline = statement.connection_ref->PipelineOrNull();
 	}
 
 	void DoWork() override {
@@ -646,7 +1163,8 @@ Napi::FunctionReference QueryResult::Init(Napi::Env env, Napi::Object exports) {
 
 	Napi::Function t = DefineClass(env, "QueryResult",
 	                               {InstanceMethod("nextChunk", &QueryResult::NextChunk),
-	                                InstanceMethod("nextIpcBuffer", &QueryResult::NextIpcBuffer)});
+	                                InstanceMethod("nextIpcBuffer", &QueryResult::NextIpcBuffer),
+	                                InstanceMethod("nextJSON", &QueryResult::NextJSON)});
 
 	exports.Set("QueryResult", t);
 
@@ -682,7 +1200,7 @@ struct GetChunkTask : public Task {
 			return;
 		}
 
-		auto chunk_converted = convert_chunk(env, query_result.result->names, *chunk).ToObject();
+		auto chunk_converted = convert_chunk(env, query_result.result->names, chunk).ToObject();
 		if (!chunk_converted.IsArray()) {
 			deferred.Reject(Utils::CreateError(env, "internal error: chunk is not array"));
 		} else {
@@ -691,7 +1209,7 @@ struct GetChunkTask : public Task {
 	}
 
 	Napi::Promise::Deferred deferred;
-	unique_ptr<duckdb::DataChunk> chunk;
+	std::shared_ptr<duckdb::DataChunk> chunk;
 };
 
 struct GetNextArrowIpcTask : public Task {
@@ -752,6 +1270,54 @@ Napi::Value QueryResult::NextIpcBuffer(const Napi::CallbackInfo &info) {
 	return deferred.Promise();
 }
 
+// Writes the next chunk as NDJSON on the worker thread
+struct GetJSONTask : public Task {
+	GetJSONTask(QueryResult &query_result, JSONWriteOptions options, Napi::Promise::Deferred deferred)
+	    : Task(query_result), options(options), deferred(deferred) {
+		this->options.ndjson = true;
+	}
+
+	void DoWork() override {
+		auto &query_result = Get<QueryResult>();
+		try {
+			auto chunk = query_result.result->Fetch();
+			if (chunk && chunk->size() > 0) {
+				json = std::make_shared<std::string>();
+				WriteJSONRows(*json, *chunk, query_result.result->names, options, 0);
+			}
+		} catch (std::exception &ex) {
+			error = duckdb::ErrorData(ex);
+		}
+	}
+
+	void DoCallback() override {
+		auto &query_result = Get<QueryResult>();
+		Napi::Env env = query_result.Env();
+		Napi::HandleScope scope(env);
+
+		if (error.HasError()) {
+			deferred.Reject(Utils::CreateError(env, error));
+		} else if (!json) {
+			deferred.Resolve(env.Null());
+		} else {
+			deferred.Resolve(CreateExternalBuffer(env, json->data(), json->size(), json));
+		}
+	}
+
+	JSONWriteOptions options;
+	Napi::Promise::Deferred deferred;
+	std::shared_ptr<std::string> json;
+	duckdb::ErrorData error;
+};
+
+Napi::Value QueryResult::NextJSON(const Napi::CallbackInfo &info) {
+	auto env = info.Env();
+	auto options = GetJSONWriteOptions(info.Length() > 0 ? info[0] : env.Undefined());
+	auto deferred = Napi::Promise::Deferred::New(env);
+	database_ref->Schedule(env, duckdb::make_uniq<GetJSONTask>(*this, options, deferred));
+	return deferred.Promise();
+}
+
 Napi::Object QueryResult::NewInstance(const Napi::Object &db) {
 	return NodeDuckDB::GetData(db.Env())->query_result_constructor.New({db});
 }
@@ -1,4 +1,7 @@
 #include "duckdb_node.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+#include <cmath>
 
 namespace node_duckdb {
 
@@ -41,6 +44,191 @@ static bool OtherInstanceOf(Napi::Object source, const char *object_type) {
 
 	return false;
 }
+// Plain JS objects ({a: 1}) as opposed to arrays, buffers, typed arrays, dates and regexps
+bool Utils::IsPlainObject(const Napi::Value &source) {
+	if (!source.IsObject() || source.IsArray() || source.IsTypedArray() || source.IsArrayBuffer() ||
+	    source.IsFunction()) {
+		return false;
+	}
+#if (NAPI_VERSION > 4)
+	if (source.IsDate()) {
+		return false;
+	}
+#endif
+	return !OtherInstanceOf(source.As<Napi::Object>(), "RegExp");
+}
+
+#if (NAPI_VERSION > 5)
+static duckdb::Value BigIntToValue(Napi::BigInt source) {
+	bool lossless;
+	auto int_val = source.Int64Value(&lossless);
+	if (lossless) {
+		return duckdb::Value::BIGINT(int_val);
+	}
+	auto uint_val = source.Uint64Value(&lossless);
+	if (lossless) {
+		return duckdb::Value::UBIGINT(uint_val);
+	}
+	if (source.WordCount() <= 2) {
+		int sign_bit;
+		size_t word_count = 2;
+		uint64_t words[2] = {0, 0};
+		source.ToWords(&sign_bit, &word_count, words);
+		const uint64_t top_bit = 1ull << 63;
+		if (!sign_bit) {
+			if (words[1] & top_bit) {
+				return duckdb::Value::UHUGEINT(duckdb::uhugeint_t(words[1], words[0]));
+			}
+			return duckdb::Value::HUGEINT(duckdb::hugeint_t(int64_t(words[1]), words[0]));
+		}
+		if (words[1] == top_bit && words[0] == 0) {
+			return duckdb::Value::HUGEINT(duckdb::NumericLimits<duckdb::hugeint_t>::Minimum());
+		}
+		if (!(words[1] & top_bit)) {
+			duckdb::hugeint_t val(int64_t(words[1]), words[0]);
+			duckdb::Hugeint::NegateInPlace(val);
+			return duckdb::Value::HUGEINT(val);
+		}
+	}
+	// out of range for any integer type, let the engine complain about the cast
+	return duckdb::Value(source.ToString().Utf8Value());
+}
+#endif
+
+template <class T>
+static duckdb::LogicalType TypedArrayValues(const Napi::TypedArray &array, vector<duckdb::Value> &values) {
+	auto base = static_cast<const uint8_t *>(array.ArrayBuffer().Data()) + array.ByteOffset();
+	auto data = reinterpret_cast<const T *>(base);
+	auto count = array.ElementLength();
+	values.reserve(count);
+	for (size_t i = 0; i < count; i++) {
+		values.push_back(duckdb::Value::CreateValue<T>(data[i]));
+	}
+	return duckdb::Value::CreateValue<T>(T(0)).type();
+}
+
+// Reads the elements of a typed array straight from its backing store, no per-element JS access
+static duckdb::LogicalType TypedArrayToValues(const Napi::TypedArray &array, vector<duckdb::Value> &values) {
+	switch (array.TypedArrayType()) {
+	case napi_int8_array:
+		return TypedArrayValues<int8_t>(array, values);
+	case napi_uint8_array:
+	case napi_uint8_clamped_array:
+		return TypedArrayValues<uint8_t>(array, values);
+	case napi_int16_array:
+		return TypedArrayValues<int16_t>(array, values);
+	case napi_uint16_array:
+		return TypedArrayValues<uint16_t>(array, values);
+	case napi_int32_array:
+		return TypedArrayValues<int32_t>(array, values);
+	case napi_uint32_array:
+		return TypedArrayValues<uint32_t>(array, values);
+	case napi_float32_array:
+		return TypedArrayValues<float>(array, values);
+	case napi_float64_array:
+		return TypedArrayValues<double>(array, values);
+#if (NAPI_VERSION > 5)
+	case napi_bigint64_array:
+		return TypedArrayValues<int64_t>(array, values);
+	case napi_biguint64_array:
+		return TypedArrayValues<uint64_t>(array, values);
+#endif
+	default:
+		return duckdb::LogicalType::INVALID;
+	}
+}
+
+static duckdb::LogicalType TypedArrayElementType(const Napi::TypedArray &array) {
+	switch (array.TypedArrayType()) {
+	case napi_int8_array:
+		return duckdb::LogicalType::TINYINT;
+	case napi_uint8_array:
+	case napi_uint8_clamped_array:
+		return duckdb::LogicalType::UTINYINT;
+	case napi_int16_array:
+		return duckdb::LogicalType::SMALLINT;
+	case napi_uint16_array:
+		return duckdb::LogicalType::USMALLINT;
+	case napi_int32_array:
+		return duckdb::LogicalType::INTEGER;
+	case napi_uint32_array:
+		return duckdb::LogicalType::UINTEGER;
+	case napi_float32_array:
+		return duckdb::LogicalType::FLOAT;
+	case napi_float64_array:
+		return duckdb::LogicalType::DOUBLE;
+#if (NAPI_VERSION > 5)
+	case napi_bigint64_array:
+		return duckdb::LogicalType::BIGINT;
+	case napi_biguint64_array:
+		return duckdb::LogicalType::UBIGINT;
+#endif
+	default:
+		return duckdb::LogicalType::INVALID;
+	}
+}
+
+// Converts the elements of a typed array into the child type of a LIST/ARRAY parameter. If the types differ the
+// backing store is cast as a single vector, instead of boxing every element in its own Value and casting that
+static bool TypedArrayChildren(const Napi::TypedArray &array, const duckdb::LogicalType &child_type,
+                               vector<duckdb::Value> &children) {
+	auto element_type = TypedArrayElementType(array);
+	if (element_type.id() == duckdb::LogicalTypeId::INVALID) {
+		return false;
+	}
+	if (element_type == child_type) {
+		TypedArrayToValues(array, children);
+		return true;
+	}
+	auto count = array.ElementLength();
+	if (count == 0) {
+		return true;
+	}
+	auto data = static_cast<uint8_t *>(array.ArrayBuffer().Data()) + array.ByteOffset();
+	duckdb::Vector elements(element_type, duckdb::data_ptr_cast(data));
+	duckdb::Vector cast_elements(child_type, count);
+	std::string error;
+	if (!duckdb::VectorOperations::DefaultTryCast(elements, cast_elements, count, &error)) {
+		return false;
+	}
+	children.reserve(count);
+	for (size_t i = 0; i < count; i++) {
+		children.push_back(cast_elements.GetValue(i));
+	}
+	return true;
+}
+
+// Builds the child values of a LIST/ARRAY parameter, returns false if the source is not list-like
+static bool ListChildren(const Napi::Value &source, const duckdb::LogicalType &child_type,
+                         vector<duckdb::Value> &children) {
+	if (source.IsTypedArray()) {
+		return TypedArrayChildren(source.As<Napi::TypedArray>(), child_type, children);
+	}
+	if (source.IsArray()) {
+		auto array = source.As<Napi::Array>();
+		children.reserve(array.Length());
+		for (uint32_t i = 0; i < array.Length(); i++) {
+			children.push_back(Utils::BindParameter(array.Get(i), child_type));
+			if (!children.back().IsNull() && children.back().type() != child_type) {
+				return false;
+			}
+		}
+		return true;
+	}
+	return false;
+}
+
+template <class T>
+static bool NumberToValue(double number, duckdb::Value &result) {
+	// the upper bound is exclusive because the maximum of 64-bit types rounds up to the next power of two
+	if (!duckdb::Value::IsFinite(number) || number < double(duckdb::NumericLimits<T>::Minimum()) ||
+	    number >= double(duckdb::NumericLimits<T>::Maximum()) + 1.0 || double(T(number)) != number) {
+		return false;
+	}
+	result = duckdb::Value::CreateValue<T>(T(number));
+	return true;
+}
+
 duckdb::Value Utils::BindParameter(const Napi::Value source) {
 	if (source.IsString()) {
 		return duckdb::Value(source.As<Napi::String>().Utf8Value());
@@ -52,13 +240,17 @@ duckdb::Value Utils::BindParameter(const Napi::Value source) {
 		} else {
 			return duckdb::Value::DOUBLE(source.As<Napi::Number>().DoubleValue());
 		}
+#if (NAPI_VERSION > 5)
+	} else if (source.IsBigInt()) {
+		return BigIntToValue(source.As<Napi::BigInt>());
+#endif
 	} else if (source.IsBoolean()) {
 		return duckdb::Value::BOOLEAN(source.As<Napi::Boolean>().Value());
 	} else if (source.IsNull()) {
 		return duckdb::Value();
 	} else if (source.IsBuffer()) {
 		Napi::Buffer<char> buffer = source.As<Napi::Buffer<char>>();
-		return duckdb::Value::BLOB(std::string(buffer.Data(), buffer.Length()));
+		return duckdb::Value::BLOB(duckdb::const_data_ptr_cast(buffer.Data()), buffer.Length());
 #if (NAPI_VERSION > 4)
 	} else if (source.IsDate()) {
 		const auto micros = int64_t(source.As<Napi::Date>().ValueOf()) * duckdb::Interval::MICROS_PER_MSEC;
@@ -69,9 +261,276 @@ duckdb::Value Utils::BindParameter(const Napi::Value source) {
 			return duckdb::Value::DATE(duckdb::date_t(days));
 		}
 #endif
-	} else if (source.IsObject()) {
+	} else if (source.IsTypedArray()) {
+		vector<duckdb::Value> children;
+		auto child_type = TypedArrayToValues(source.As<Napi::TypedArray>(), children);
+		if (child_type.id() != duckdb::LogicalTypeId::INVALID) {
+			return duckdb::Value::LIST(child_type, std::move(children));
+		}
+	} else if (source.IsArray()) {
+		// find a common child type, element values that disagree are cast to it
+		auto array = source.As<Napi::Array>();
+		vector<duckdb::Value> children;
+		auto child_type = duckdb::LogicalType(duckdb::LogicalTypeId::SQLNULL);
+		for (uint32_t i = 0; i < array.Length(); i++) {
+			children.push_back(BindParameter(array.Get(i)));
+			child_type = duckdb::LogicalType::ForceMaxLogicalType(child_type, children.back().type());
+		}
+		bool castable = true;
+		for (auto &child : children) {
+			if (child.type() != child_type && !child.DefaultTryCastAs(child_type)) {
+				castable = false;
+				break;
+			}
+		}
+		if (castable) {
+			return duckdb::Value::LIST(child_type, std::move(children));
+		}
+	} else if (Utils::IsPlainObject(source)) {
+		auto object = source.As<Napi::Object>();
+		auto keys = object.GetPropertyNames();
+		duckdb::child_list_t<duckdb::Value> children;
+		for (uint32_t i = 0; i < keys.Length(); i++) {
+			auto key = keys.Get(i).ToString();
+			children.push_back({key.Utf8Value(), BindParameter(object.Get(key))});
+		}
+		if (!children.empty()) {
+			return duckdb::Value::STRUCT(std::move(children));
+		}
+	}
+	if (source.IsObject()) {
 		return duckdb::Value(source.ToString().Utf8Value());
 	}
 	return duckdb::Value();
 }
+
+// Whether a prepared parameter type is concrete enough to convert JS values into it directly
+static bool IsBindTarget(const duckdb::LogicalType &type) {
+	switch (type.id()) {
+	case duckdb::LogicalTypeId::INVALID:
+	case duckdb::LogicalTypeId::UNKNOWN:
+	case duckdb::LogicalTypeId::ANY:
+	case duckdb::LogicalTypeId::SQLNULL:
+		return false;
+	default:
+		return type.IsComplete();
+	}
+}
+
+// Converts a JS value directly into the type the prepared statement expects for this parameter, so the
+// engine does not have to rebind or cast at execution. Anything we cannot convert directly falls back to
+// guessing the type from the JS value.
+duckdb::Value Utils::BindParameter(const Napi::Value source, const duckdb::LogicalType &type) {
+	if (!IsBindTarget(type)) {
+		return BindParameter(source);
+	}
+	if (source.IsNull() || source.IsUndefined()) {
+		return duckdb::Value(type);
+	}
+
+	duckdb::Value result;
+	switch (type.id()) {
+	case duckdb::LogicalTypeId::BOOLEAN:
+		if (source.IsBoolean()) {
+			return duckdb::Value::BOOLEAN(source.As<Napi::Boolean>().Value());
+		}
+		break;
+	case duckdb::LogicalTypeId::TINYINT:
+		if (source.IsNumber() && NumberToValue<int8_t>(source.As<Napi::Number>().DoubleValue(), result)) {
+			return result;
+		}
+		break;
+	case duckdb::LogicalTypeId::SMALLINT:
+		if (source.IsNumber() && NumberToValue<int16_t>(source.As<Napi::Number>().DoubleValue(), result)) {
+			return result;
+		}
+		break;
+	case duckdb::LogicalTypeId::INTEGER:
+		if (source.IsNumber() && NumberToValue<int32_t>(source.As<Napi::Number>().DoubleValue(), result)) {
+			return result;
+		}
+		break;
+	case duckdb::LogicalTypeId::UTINYINT:
+		if (source.IsNumber() && NumberToValue<uint8_t>(source.As<Napi::Number>().DoubleValue(), result)) {
+			return result;
+		}
+		break;
+	case duckdb::LogicalTypeId::USMALLINT:
+		if (source.IsNumber() && NumberToValue<uint16_t>(source.As<Napi::Number>().DoubleValue(), result)) {
+			return result;
+		}
+		break;
+	case duckdb::LogicalTypeId::UINTEGER:
+		if (source.IsNumber() && NumberToValue<uint32_t>(source.As<Napi::Number>().DoubleValue(), result)) {
+			return result;
+		}
+		break;
+	case duckdb::LogicalTypeId::BIGINT:
+	case duckdb::LogicalTypeId::UBIGINT:
+	case duckdb::LogicalTypeId::HUGEINT:
+	case duckdb::LogicalTypeId::UHUGEINT:
+		if (source.IsNumber()) {
+			if (NumberToValue<int64_t>(source.As<Napi::Number>().DoubleValue(), result) &&
+			    (result.type() == type || result.DefaultTryCastAs(type))) {
+				return result;
+			}
+#if (NAPI_VERSION > 5)
+		} else if (source.IsBigInt()) {
+			result = BigIntToValue(source.As<Napi::BigInt>());
+			if (result.type() == type || result.DefaultTryCastAs(type)) {
+				return result;
+			}
+#endif
+		}
+		break;
+	case duckdb::LogicalTypeId::FLOAT:
+		if (source.IsNumber()) {
+			return duckdb::Value::FLOAT(source.As<Napi::Number>().FloatValue());
+		}
+		break;
+	case duckdb::LogicalTypeId::DOUBLE:
+		if (source.IsNumber()) {
+			return duckdb::Value::DOUBLE(source.As<Napi::Number>().DoubleValue());
+		}
+		break;
+	case duckdb::LogicalTypeId::VARCHAR:
+		if (source.IsString()) {
+			return duckdb::Value(source.As<Napi::String>().Utf8Value());
+		}
+		break;
+	case duckdb::LogicalTypeId::BLOB:
+		if (source.IsBuffer()) {
+			Napi::Buffer<char> buffer = source.As<Napi::Buffer<char>>();
+			return duckdb::Value::BLOB(duckdb::const_data_ptr_cast(buffer.Data()), buffer.Length());
+		}
+		break;
+#if (NAPI_VERSION > 4)
+	case duckdb::LogicalTypeId::DATE:
+		if (source.IsDate()) {
+			auto millis = source.As<Napi::Date>().ValueOf();
+			auto days = int32_t(std::floor(millis / double(duckdb::Interval::MSECS_PER_SEC * duckdb::Interval::SECS_PER_DAY)));
+			return duckdb::Value::DATE(duckdb::date_t(days));
+		}
+		break;
+	case duckdb::LogicalTypeId::TIMESTAMP:
+		if (source.IsDate()) {
+			auto micros = int64_t(source.As<Napi::Date>().ValueOf()) * duckdb::Interval::MICROS_PER_MSEC;
+			return duckdb::Value::TIMESTAMP(duckdb::timestamp_t(micros));
+		}
+		break;
+	case duckdb::LogicalTypeId::TIMESTAMP_TZ:
+		if (source.IsDate()) {
+			auto micros = int64_t(source.As<Napi::Date>().ValueOf()) * duckdb::Interval::MICROS_PER_MSEC;
+			return duckdb::Value::TIMESTAMPTZ(duckdb::timestamp_tz_t(micros));
+		}
+		break;
+	case duckdb::LogicalTypeId::TIMESTAMP_MS:
+		if (source.IsDate()) {
+			return duckdb::Value::TIMESTAMPMS(duckdb::timestamp_ms_t(int64_t(source.As<Napi::Date>().ValueOf())));
+		}
+		break;
+	case duckdb::LogicalTypeId::TIMESTAMP_SEC:
+		if (source.IsDate()) {
+			auto seconds = int64_t(source.As<Napi::Date>().ValueOf()) / duckdb::Interval::MSECS_PER_SEC;
+			return duckdb::Value::TIMESTAMPSEC(duckdb::timestamp_sec_t(seconds));
+		}
+		break;
+	case duckdb::LogicalTypeId::TIMESTAMP_NS:
+		if (source.IsDate()) {
+			auto nanos = int64_t(source.As<Napi::Date>().ValueOf()) * duckdb::Interval::MICROS_PER_MSEC * 1000;
+			return duckdb::Value::TIMESTAMPNS(duckdb::timestamp_ns_t(nanos));
+		}
+		break;
+#endif
+	case duckdb::LogicalTypeId::LIST: {
+		if (source.IsBuffer()) {
+			break;
+		}
+		auto &child_type = duckdb::ListType::GetChildType(type);
+		vector<duckdb::Value> children;
+		if (ListChildren(source, child_type, children)) {
+			return duckdb::Value::LIST(child_type, std::move(children));
+		}
+	} break;
+	case duckdb::LogicalTypeId::ARRAY: {
+		if (source.IsBuffer()) {
+			break;
+		}
+		auto &child_type = duckdb::ArrayType::GetChildType(type);
+		vector<duckdb::Value> children;
+		if (ListChildren(source, child_type, children) && children.size() == duckdb::ArrayType::GetSize(type)) {
+			return duckdb::Value::ARRAY(child_type, std::move(children));
+		}
+	} break;
+	case duckdb::LogicalTypeId::STRUCT: {
+		if (!Utils::IsPlainObject(source)) {
+			break;
+		}
+		auto object = source.As<Napi::Object>();
+		auto &child_types = duckdb::StructType::GetChildTypes(type);
+		vector<duckdb::Value> children;
+		children.reserve(child_types.size());
+		bool matches = true;
+		for (auto &child : child_types) {
+			children.push_back(object.Has(child.first) ? BindParameter(object.Get(child.first), child.second)
+			                                           : duckdb::Value(child.second));
+			if (!children.back().IsNull() && children.back().type() != child.second) {
+				matches = false;
+				break;
+			}
+		}
+		if (matches) {
+			return duckdb::Value::STRUCT(type, std::move(children));
+		}
+	} break;
+	case duckdb::LogicalTypeId::MAP: {
+		if (!Utils::IsPlainObject(source) || duckdb::MapType::KeyType(type).id() != duckdb::LogicalTypeId::VARCHAR) {
+			break;
+		}
+		auto object = source.As<Napi::Object>();
+		auto &value_type = duckdb::MapType::ValueType(type);
+		auto names = object.GetPropertyNames();
+		vector<duckdb::Value> keys;
+		vector<duckdb::Value> values;
+		bool matches = true;
+		for (uint32_t i = 0; i < names.Length(); i++) {
+			auto key = names.Get(i).ToString();
+			keys.push_back(duckdb::Value(key.Utf8Value()));
+			values.push_back(BindParameter(object.Get(key), value_type));
+			if (!values.back().IsNull() && values.back().type() != value_type) {
+				matches = false;
+				break;
+			}
+		}
+		if (matches) {
+			return duckdb::Value::MAP(duckdb::LogicalType::VARCHAR, value_type, std::move(keys), std::move(values));
+		}
+	} break;
+	default:
+		break;
+	}
+	return BindParameter(source);
+}
+
+// Runs a statement whose result nobody looks at (exec, leading statements of a multi-statement prepare).
+// The result is streamed and every chunk is dropped as soon as it is produced, so even large SELECTs or
+// COPY ... RETURNING only ever hold the operator working set instead of a full MaterializedQueryResult.
+duckdb::ErrorData Utils::ExecuteDiscardingResult(duckdb::Connection &connection,
+                                                 duckdb::unique_ptr<duckdb::SQLStatement> statement) {
+	auto pending_query = connection.PendingQuery(std::move(statement), true);
+	if (pending_query->HasError()) {
+		return pending_query->GetErrorObject();
+	}
+	auto result = pending_query->Execute();
+	while (!result->HasError()) {
+		auto chunk = result->FetchRaw();
+		if (!chunk || chunk->size() == 0) {
+			break;
+		}
+	}
+	if (result->HasError()) {
+		return result->GetErrorObject();
+	}
+	return duckdb::ErrorData();
+}
 } // namespace node_duckdb
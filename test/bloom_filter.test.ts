@@ -0,0 +1,64 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+
+describe('bloom filter join pushdown', function() {
+    let db: duckdb.Database;
+    before(function(done) {
+        db = new duckdb.Database(':memory:', () => {
+            db.exec(`CREATE TABLE probe AS SELECT range::BIGINT AS k, range::VARCHAR AS s FROM range(1000000);
+                     CREATE TABLE build AS SELECT (range * 7)::BIGINT AS k, (range * 7)::VARCHAR AS s FROM range(20000);`, done);
+        });
+    });
+
+    function count(sql: string): Promise<number> {
+        return new Promise((resolve, reject) => {
+            db.all(sql, (err: null | Error, rows: duckdb.TableData) => {
+                if (err) return reject(err);
+                resolve(rows[0].cnt);
+            });
+        });
+    }
+
+    function exec(sql: string): Promise<void> {
+        return new Promise((resolve, reject) => db.exec(sql, (err: null | Error) => err ? reject(err) : resolve()));
+    }
+
+    // the number of rows the scan of the probe table emits
+    async function probeScanRows(sql: string): Promise<number> {
+        const rows = await new Promise<duckdb.TableData>((resolve, reject) => {
+            db.all(`EXPLAIN (ANALYZE, FORMAT json) ${sql}`, (err: null | Error, rows: duckdb.TableData) => err ? reject(err) : resolve(rows));
+        });
+        const scans: number[] = [];
+        const visit = (node: any) => {
+            if (node.extra_info && node.extra_info.Table === 'probe') {
+                scans.push(Number(node.operator_cardinality));
+            }
+            (node.children || []).forEach(visit);
+        };
+        visit(JSON.parse(rows[0].explain_value));
+        assert.equal(scans.length, 1);
+        return scans[0];
+    }
+
+    for (const column of ['k', 's']) {
+        it(`should not change the result of a join on ${column}`, async function() {
+            const sql = `SELECT count(*)::INTEGER AS cnt FROM probe JOIN build USING (${column})`;
+            await exec('SET dynamic_bloom_filter_threshold = 0');
+            const expected = await count(sql);
+            await exec('RESET dynamic_bloom_filter_threshold');
+            assert.equal(await count(sql), expected);
+            assert.equal(expected, 20000);
+        });
+
+        it(`should remove probe rows without a partner in the scan on ${column}`, async function() {
+            const sql = `SELECT count(*) AS cnt FROM probe JOIN build USING (${column})`;
+            await exec('SET dynamic_bloom_filter_threshold = 0');
+            const unfiltered = await probeScanRows(sql);
+            await exec('RESET dynamic_bloom_filter_threshold');
+            const filtered = await probeScanRows(sql);
+            // 20000 rows have a partner, a false positive rate of about 0.5% lets a few more through
+            assert.ok(unfiltered > 100000, `${unfiltered} rows scanned without the filter`);
+            assert.ok(filtered >= 20000 && filtered < 30000, `${filtered} rows scanned with the filter`);
+        });
+    }
+});
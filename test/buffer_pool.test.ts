@@ -0,0 +1,84 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+import * as helper from './support/helper';
+
+describe('buffer pool eviction policy', function() {
+    const filename = 'test/tmp/buffer_pool.db';
+    let db: duckdb.Database;
+    before(function(done) {
+        helper.ensureExists('test/tmp');
+        helper.deleteFile(filename);
+        helper.deleteFile(`${filename}.wal`);
+        db = new duckdb.Database(filename, {buffer_eviction_policy: 'two_queue'}, () => {
+            // the scanned table does not fit in memory, the looked up one does
+            db.exec(`CREATE TABLE big AS SELECT range::BIGINT AS i, hash(range) AS v FROM range(4000000);
+                     CREATE TABLE hot AS SELECT range::INTEGER AS k, range * 2 AS v FROM range(1000);
+                     CHECKPOINT;
+                     SET memory_limit = '16MB';`, done);
+        });
+    });
+
+    after(function(done) {
+        db.close(() => {
+            helper.deleteFile(filename);
+            done();
+        });
+    });
+
+    function all(sql: string): Promise<duckdb.TableData> {
+        return new Promise((resolve, reject) => {
+            db.all(sql, (err: null | Error, rows: duckdb.TableData) => err ? reject(err) : resolve(rows));
+        });
+    }
+
+    it('should apply the policy set when opening the database', async function() {
+        assert.deepEqual(await all("SELECT current_setting('buffer_eviction_policy') AS p"), [{p: 'two_queue'}]);
+        assert.deepEqual(await all('SELECT eviction_policy FROM duckdb_buffer_pool()'), [{eviction_policy: 'two_queue'}]);
+    });
+
+    it('should reject unknown policies', async function() {
+        await assert.rejects(all("SET buffer_eviction_policy = 'mru'"));
+    });
+
+    it('should count hits, misses and evictions of a mixed workload', async function() {
+        for (let round = 0; round < 3; round++) {
+            for (let k = 0; k < 20; k++) {
+                assert.deepEqual(await all(`SELECT v::INTEGER AS v FROM hot WHERE k = ${k * 37}`), [{v: k * 74}]);
+            }
+            assert.deepEqual(await all('SELECT max(i)::INTEGER AS i, max(v) > 0 AS v FROM big'), [{i: 3999999, v: true}]);
+        }
+        const [stats] = await all('SELECT hits::INTEGER AS hits, misses::INTEGER AS misses, evictions::INTEGER AS evictions, hit_ratio FROM duckdb_buffer_pool()');
+        assert.ok(stats.hits > 0);
+        assert.ok(stats.misses > 0);
+        assert.ok(stats.evictions > 0);
+        assert.ok(stats.hit_ratio > 0 && stats.hit_ratio < 1);
+    });
+
+    async function lookups() {
+        for (let k = 0; k < 20; k++) {
+            assert.deepEqual(await all(`SELECT v::INTEGER AS v FROM hot WHERE k = ${k * 37}`), [{v: k * 74}]);
+        }
+    }
+
+    // misses of the lookups that follow a scan of the big table
+    async function missesAfterScan(policy: string): Promise<number> {
+        await all(`SET buffer_eviction_policy = '${policy}'`);
+        // repeated lookups re-reference the blocks of the looked up table
+        await lookups();
+        await lookups();
+        assert.deepEqual(await all('SELECT max(i)::INTEGER AS i FROM big'), [{i: 3999999}]);
+        const [before] = await all('SELECT misses::INTEGER AS misses FROM duckdb_buffer_pool()');
+        await lookups();
+        const [after] = await all('SELECT misses::INTEGER AS misses FROM duckdb_buffer_pool()');
+        return after.misses - before.misses;
+    }
+
+    it('should keep re-referenced blocks in the protected queue during a scan', async function() {
+        // under LRU the scan evicts the blocks of the looked up table
+        const lru = await missesAfterScan('lru');
+        assert.ok(lru > 0);
+        // under 2Q the scanned blocks are evicted from the probation queue instead
+        const two_queue = await missesAfterScan('two_queue');
+        assert.equal(two_queue, 0, `${two_queue} misses with two_queue, ${lru} with lru`);
+    });
+});
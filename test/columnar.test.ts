@@ -0,0 +1,95 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+
+describe('columnar results', function() {
+    var db: duckdb.Database;
+    before(function(done) {
+        db = new duckdb.Database(':memory:', done);
+    });
+
+    it('should return primitive columns as typed arrays', function(done) {
+        db.allColumnar('SELECT range::INTEGER AS i, range / 2 AS d FROM range(3)', function(err: null | Error, batches: duckdb.ColumnarBatch[]) {
+            if (err) throw err;
+            assert.equal(batches.length, 1);
+            assert.equal(batches[0].rows, 3);
+            const [i, d] = batches[0].columns;
+            assert.equal(i.name, 'i');
+            assert.ok(i.data instanceof Int32Array);
+            assert.deepEqual(Array.from(i.data!), [0, 1, 2]);
+            assert.ok(d.data instanceof Float64Array);
+            assert.deepEqual(Array.from(d.data!), [0, 0.5, 1]);
+            done();
+        });
+    });
+
+    it('should encode lists with offsets and a child column', function(done) {
+        db.allColumnar("SELECT * FROM (VALUES ([1.5, 2.5]::FLOAT[]), (NULL), ([]), ([3.5])) t(embedding)", function(err: null | Error, batches: duckdb.ColumnarBatch[]) {
+            if (err) throw err;
+            const embedding = batches[0].columns[0];
+            assert.deepEqual(Array.from(embedding.validity), [1, 0, 1, 1]);
+            assert.deepEqual(Array.from(embedding.offsets!), [0, 2, 2, 2, 3]);
+            const values = embedding.children![0];
+            assert.ok(values.data instanceof Float32Array);
+            assert.deepEqual(Array.from(values.data!), [1.5, 2.5, 3.5]);
+            done();
+        });
+    });
+
+    it('should encode lists that do not start at offset zero', function(done) {
+        db.allColumnar("SELECT list_slice(l, 2, 3) AS l FROM (SELECT [v, v + 1, v + 2] AS l FROM range(3) t(v)) WHERE l[1] > 0", function(err: null | Error, batches: duckdb.ColumnarBatch[]) {
+            if (err) throw err;
+            const l = batches[0].columns[0];
+            assert.deepEqual(Array.from(l.offsets!), [0, 2, 4]);
+            assert.deepEqual(Array.from(l.children![0].data!), [BigInt(2), BigInt(3), BigInt(3), BigInt(4)]);
+            done();
+        });
+    });
+
+    it('should encode struct fields and maps as child columns', function(done) {
+        db.allColumnar("SELECT {'a': 1, 'b': 'x'} AS s, MAP {'k1': 10, 'k2': 20} AS m", function(err: null | Error, batches: duckdb.ColumnarBatch[]) {
+            if (err) throw err;
+            const [s, m] = batches[0].columns;
+            assert.deepEqual(s.children!.map(c => c.name), ['a', 'b']);
+            assert.deepEqual(Array.from(s.children![0].data!), [1]);
+            assert.deepEqual(Array.from(s.children![1].data!), ['x']);
+            assert.deepEqual(Array.from(m.offsets!), [0, 2]);
+            const entries = m.children![0];
+            assert.deepEqual(Array.from(entries.children![0].data!), ['k1', 'k2']);
+            assert.deepEqual(Array.from(entries.children![1].data!), [10, 20]);
+            done();
+        });
+    });
+
+    it('should convert nested rows column-wise', function(done) {
+        db.all("SELECT [{'a': v::INTEGER, 'b': [v::DOUBLE, NULL]}, NULL] AS l FROM range(2) t(v)", function(err: null | Error, rows: duckdb.TableData) {
+            if (err) throw err;
+            assert.deepEqual(rows, [
+                {l: [{a: 0, b: [0, null]}, null]},
+                {l: [{a: 1, b: [1, null]}, null]},
+            ]);
+            done();
+        });
+    });
+
+    it('should expose BLOBs and fixed-width columns without copying', function(done) {
+        db.allColumnar("SELECT v::INTEGER AS i, repeat('ab', v::INTEGER * 10)::BLOB AS b FROM range(1, 4) t(v)", function(err: null | Error, batches: duckdb.ColumnarBatch[]) {
+            if (err) throw err;
+            const [i, b] = batches[0].columns;
+            assert.deepEqual(Array.from(i.data!), [1, 2, 3]);
+            assert.deepEqual((b.data as Buffer[]).map(buf => buf.toString()), ['ab'.repeat(10), 'ab'.repeat(20), 'ab'.repeat(30)]);
+            db.all("SELECT repeat('xy', 50)::BLOB AS b, 'short'::BLOB AS s", function(err: null | Error, rows: duckdb.TableData) {
+                if (err) throw err;
+                assert.equal(rows[0].b.toString(), 'xy'.repeat(50));
+                assert.equal(rows[0].s.toString(), 'short');
+                // the rows of a constant column point at the same string, a write through one view shows in the others
+                db.allColumnar("SELECT v, repeat('ab', 20)::BLOB AS b FROM range(3) t(v)", function(err: null | Error, batches: duckdb.ColumnarBatch[]) {
+                    if (err) throw err;
+                    const views = batches[0].columns[1].data as Buffer[];
+                    views[0][0] = 'z'.charCodeAt(0);
+                    assert.deepEqual(views.map(buf => buf.toString()), ['zb' + 'ab'.repeat(19), 'zb' + 'ab'.repeat(19), 'zb' + 'ab'.repeat(19)]);
+                    done();
+                });
+            });
+        });
+    });
+});
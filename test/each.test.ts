@@ -24,6 +24,58 @@ describe('each', function() {
         });
     });
 
+    it('retrieve 100,000 rows in chunks with Statement#eachChunk', function(done) {
+        var total = 100000;
+        var retrieved = 0;
+        var chunks = 0;
+
+        db.eachChunk('SELECT id, txt FROM foo WHERE ROWID < ?', total, function(err: null | Error, rows: RowData[]) {
+            if (err) done(new Error('Query failed unexpectedly'));
+            assert.ok(rows.length > 0 && rows.length <= 2048);
+            assert.ok('id' in rows[0] && 'txt' in rows[0]);
+            retrieved += rows.length;
+            chunks++;
+        }, function(err: null | Error, num: number) {
+            if (err) done(new Error('Query failed unexpectedly'));
+            assert.equal(num, total);
+            assert.equal(retrieved, total, "Only retrieved " + retrieved + " out of " + total + " rows.");
+            assert.ok(chunks < total / 100);
+            done();
+        });
+    });
+
+    it('Statement#eachChunk keeps other work on the connection waiting until the result is drained', function(done) {
+        var total = 100000;
+        var retrieved = 0;
+        var completed = false;
+
+        db.eachChunk('SELECT id, txt FROM foo WHERE ROWID < ?', total, function(err: null | Error, rows: RowData[]) {
+            if (err) return done(err);
+            if (retrieved == 0) {
+                // runs on the same (default) connection, which would close the streaming result if it ran now
+                db.all('SELECT 42 AS answer', function(err: null | Error, rows: RowData[]) {
+                    if (err) return done(err);
+                    assert.deepEqual(rows, [{answer: 42}]);
+                    assert.ok(completed);
+                    done();
+                });
+            }
+            retrieved += rows.length;
+        }, function(err: null | Error, num: number) {
+            if (err) return done(err);
+            assert.equal(num, total);
+            assert.equal(retrieved, total);
+            completed = true;
+        });
+    });
+
+    it('Statement#eachChunk reports errors', function(done) {
+        db.eachChunk('SELECT * FROM does_not_exist', function(err: null | Error) {
+            assert.ok(err);
+            done();
+        });
+    });
+
     it.skip('Statement#each with complete callback', function(done) {
         var total = 10000;
         var retrieved = 0;
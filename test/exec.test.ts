@@ -17,6 +17,31 @@ describe('exec', function() {
         });
     });
 
+    it('Database#exec discards large intermediate results', function(done) {
+        this.timeout(30000);
+        // about 600 MB once materialized, the streamed chunks are dropped one at a time
+        const peakBefore = process.resourceUsage().maxRSS;
+        const sql = "SELECT repeat('x', 100) || range AS s FROM range(5000000); CREATE TABLE exec_after AS SELECT 42 AS i;";
+        db.exec(sql, function(err: null | Error) {
+            if (err) return done(err);
+            const growth = (process.resourceUsage().maxRSS - peakBefore) * 1024;
+            assert.ok(growth < 256 * 1024 * 1024, `peak resident memory grew by ${growth} bytes`);
+            db.all("SELECT i FROM exec_after", function(err: null | Error, rows: TableData) {
+                if (err) return done(err);
+                assert.deepEqual(rows, [{ i: 42 }]);
+                db.exec("DROP TABLE exec_after", done);
+            });
+        });
+    });
+
+    it('Database#exec reports errors of later statements', function(done) {
+        db.exec("SELECT * FROM range(1000); SELECT * FROM exec_does_not_exist;", function(err: null | Error) {
+            assert.ok(err);
+            assert.ok(err!.message.includes("exec_does_not_exist"));
+            done();
+        });
+    });
+
     it('retrieve database structure', function(done) {
         db.all("SELECT type, name FROM sqlite_master ORDER BY type, name", function(err: null | Error, rows: TableData) {
             if (err) done(new Error('Query failed unexpectedly'));
@@ -0,0 +1,75 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+import { Readable } from 'stream';
+
+async function readAll(readable: Readable): Promise<Buffer> {
+    const buffers: Buffer[] = [];
+    for await (const buffer of readable) {
+        buffers.push(buffer);
+    }
+    return Buffer.concat(buffers);
+}
+
+describe('export streams', function() {
+    let db: duckdb.Database;
+    let conn: duckdb.Connection;
+    before(function(done) {
+        db = new duckdb.Database(':memory:', () => {
+            conn = new duckdb.Connection(db, done);
+        });
+    });
+
+    function all(sql: string): Promise<duckdb.TableData> {
+        return new Promise((resolve, reject) => {
+            conn.all(sql, (err: null | Error, rows: duckdb.TableData) => err ? reject(err) : resolve(rows));
+        });
+    }
+
+    it('should export CSV', async function() {
+        const csv = await readAll(conn.exportStream('SELECT range AS i, range * 2 AS j FROM range(3);'));
+        assert.equal(csv.toString(), 'i,j\n0,0\n1,2\n2,4\n');
+    });
+
+    it('should pass COPY options on', async function() {
+        const csv = await readAll(conn.exportStream('SELECT 1 AS i, 2 AS j', {format: 'csv', header: false, delim: ';'}));
+        assert.equal(csv.toString(), '1;2\n');
+    });
+
+    it('should export NDJSON with bounded buffering', async function() {
+        const ndjson = await readAll(conn.exportStream('SELECT range AS i FROM range(100000)', {format: 'ndjson', highWaterMark: 1024}));
+        const lines = ndjson.toString().split('\n').filter(line => line.length > 0);
+        assert.equal(lines.length, 100000);
+        assert.deepEqual(JSON.parse(lines[99999]), {i: 99999});
+    });
+
+    it('should export Parquet that reads back', async function() {
+        const parquet = await readAll(db.exportStream('SELECT range AS i FROM range(10000)', {format: 'parquet'}));
+        assert.equal(parquet.subarray(0, 4).toString(), 'PAR1');
+        assert.equal(parquet.subarray(parquet.length - 4).toString(), 'PAR1');
+    });
+
+    it('should report query errors', async function() {
+        await assert.rejects(readAll(conn.exportStream('SELECT * FROM missing_table')), /missing_table/);
+    });
+
+    it('should stop the export when the stream is destroyed', async function() {
+        const readable = conn.exportStream('SELECT range AS i FROM range(10000000)', {highWaterMark: 1024});
+        for await (const buffer of readable) {
+            assert.ok(buffer.length > 0);
+            break;
+        }
+        assert.deepEqual(await all('SELECT 42 AS answer'), [{answer: 42}]);
+    });
+
+    it('should not hold up other queries while the stream is not read', async function() {
+        const readable = conn.exportStream('SELECT range AS i FROM range(10000000)', {highWaterMark: 1024});
+        await new Promise(resolve => readable.once('readable', resolve));
+        // the export is paused on a full pipe now
+        assert.deepEqual(await all('SELECT 42 AS answer'), [{answer: 42}]);
+        readable.destroy();
+    });
+
+    it('should name the missing argument', function() {
+        assert.throws(() => (conn as any).export_stream_internal('SELECT 1', {}), /delivery callback/);
+    });
+});
@@ -0,0 +1,90 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+import { Readable, pipeline as pipelineCallback } from 'stream';
+import { promisify } from 'util';
+
+const pipeline = promisify(pipelineCallback);
+
+describe('insert streams', function() {
+    let db: duckdb.Database;
+    let conn: duckdb.Connection;
+    before(function(done) {
+        db = new duckdb.Database(':memory:', () => {
+            conn = new duckdb.Connection(db, () => {
+                conn.exec('CREATE TABLE events (id INTEGER, name VARCHAR)', done);
+            });
+        });
+    });
+
+    beforeEach(function(done) {
+        conn.exec('DELETE FROM events', done);
+    });
+
+    function count(): Promise<number> {
+        return new Promise((resolve, reject) => {
+            conn.all('SELECT count(*)::INTEGER AS cnt FROM events', (err: null | Error, rows: duckdb.TableData) => {
+                if (err) return reject(err);
+                resolve(rows[0].cnt);
+            });
+        });
+    }
+
+    it('should insert CSV written in pieces', async function() {
+        const insert = conn.createInsertStream('events', {format: 'csv', header: true});
+        insert.write('id,na');
+        insert.write('me\n1,a\n2,');
+        insert.end('b\n');
+        await new Promise<void>((resolve, reject) => insert.on('finish', resolve).on('error', reject));
+        assert.equal(insert.rowCount, 2);
+        assert.equal(await count(), 2);
+    });
+
+    it('should insert NDJSON by name with backpressure', async function() {
+        function* lines() {
+            for (let i = 0; i < 100000; i++) {
+                yield JSON.stringify({name: 'n' + i, id: i}) + '\n';
+            }
+        }
+        await pipeline(Readable.from(lines()), db.createInsertStream('events', {format: 'ndjson', highWaterMark: 4096}));
+        assert.equal(await count(), 100000);
+    });
+
+    it('should pass reader options on', async function() {
+        const insert = conn.createInsertStream('events', {header: false, delim: '|', columns: {id: 'INTEGER', name: 'VARCHAR'}});
+        await pipeline(Readable.from(['7|x\n']), insert);
+        assert.equal(await count(), 1);
+    });
+
+    it('should report parse errors and insert nothing', async function() {
+        const insert = conn.createInsertStream('events', {format: 'csv', header: true});
+        await assert.rejects(pipeline(Readable.from(['id,name\n1,a\nnot a number,b\n']), insert));
+        assert.equal(await count(), 0);
+    });
+
+    it('should roll back when destroyed', async function() {
+        // with a high water mark of one byte, a write is acknowledged once the reader has taken all of it
+        const insert = conn.createInsertStream('events', {format: 'csv', header: true, highWaterMark: 1});
+        await new Promise<void>((resolve, reject) => {
+            insert.write('id,name\n1,a\n2,b\n', (err?: null | Error) => err ? reject(err) : resolve());
+        });
+        await new Promise<void>(resolve => insert.on('close', resolve).destroy());
+        assert.equal(await count(), 0);
+        assert.equal(insert.rowCount, undefined);
+    });
+
+    it('should take the rows of an export from the same database', async function() {
+        await pipeline(db.exportStream(`SELECT range::INTEGER AS id, 'n' || range AS name FROM range(100000)`,
+                                       {format: 'csv', header: true}),
+                       db.createInsertStream('events', {format: 'csv', header: true, highWaterMark: 4096}));
+        assert.equal(await count(), 100000);
+    });
+
+    it('should not hold up other queries while the stream is open', async function() {
+        const insert = conn.createInsertStream('events', {format: 'csv', header: true});
+        insert.write('id,name\n1,a\n');
+        assert.equal(await count(), 0);
+        insert.end('2,b\n');
+        await new Promise<void>((resolve, reject) => insert.on('finish', resolve).on('error', reject));
+        assert.equal(await count(), 2);
+    });
+});
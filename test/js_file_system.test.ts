@@ -0,0 +1,108 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+import * as fs from 'fs';
+
+// serves files from test/ asynchronously, as a blob store client would
+function diskFileSystem(calls: string[]): duckdb.JSFileSystem {
+    const local = (path: string) => 'test/' + path.substring('stub://'.length);
+    return {
+        read: async (path, offset, length) => {
+            calls.push(`read ${offset} ${length}`);
+            const buffer = Buffer.alloc(length);
+            const fd = await fs.promises.open(local(path), 'r');
+            try {
+                await fd.read(buffer, 0, length, offset);
+            } finally {
+                await fd.close();
+            }
+            return buffer;
+        },
+        size: async (path) => {
+            calls.push('size');
+            try {
+                return (await fs.promises.stat(local(path))).size;
+            } catch (e) {
+                return null;
+            }
+        },
+        glob: (pattern) => {
+            calls.push('glob');
+            return fs.readdirSync('test')
+                .filter(name => name.endsWith('.parquet'))
+                .map(name => 'stub://' + name);
+        },
+    };
+}
+
+describe('JS file system', function() {
+    var db: duckdb.Database;
+    var calls: string[] = [];
+
+    before(function(done) {
+        db = new duckdb.Database(':memory:', function(err) {
+            if (err) throw err;
+            db.registerFileSystem('stub://', diskFileSystem(calls), {blockSize: 64 * 1024}).then(() => done(), done);
+        });
+    });
+
+    after(function(done) {
+        db.close(done);
+    });
+
+    beforeEach(function() {
+        calls.length = 0;
+    });
+
+    it('should read parquet through JS callbacks', function(done) {
+        db.all("SELECT count(*)::INTEGER AS cnt FROM read_parquet('stub://userdata1.parquet')", function(err, res) {
+            if (err) throw err;
+            assert.equal(res[0].cnt, 1000);
+            const reads = calls.filter(call => call.startsWith('read'));
+            assert.ok(reads.length > 0);
+            // range reads of the parquet reader are widened to whole blocks
+            for (const read of reads) {
+                assert.equal(Number(read.split(' ')[1]) % (64 * 1024), 0);
+            }
+            done();
+        });
+    });
+
+    it('should serve repeated reads from the cache', function(done) {
+        db.all("SELECT count(*)::INTEGER AS cnt FROM read_parquet('stub://userdata1.parquet')", function(err, res) {
+            if (err) throw err;
+            assert.equal(res[0].cnt, 1000);
+            assert.deepEqual(calls.filter(call => call.startsWith('read')), []);
+            done();
+        });
+    });
+
+    it('should glob through JS callbacks', function(done) {
+        db.all("SELECT count(*)::INTEGER AS cnt FROM read_parquet('stub://*.parquet')", function(err, res) {
+            if (err) throw err;
+            assert.equal(res[0].cnt, 1000);
+            assert.ok(calls.includes('glob'));
+            done();
+        });
+    });
+
+    it('should report missing files', function(done) {
+        db.all("SELECT * FROM read_parquet('stub://missing.parquet')", function(err) {
+            assert.ok(err);
+            done();
+        });
+    });
+
+    it('should report errors thrown by callbacks', async function() {
+        await db.registerFileSystem('failing://', {
+            read: () => { throw new Error('blob store unavailable'); },
+            size: () => 100,
+        });
+        await new Promise<void>((resolve) => {
+            db.all("SELECT * FROM read_csv('failing://data.csv')", function(err) {
+                assert.ok(err);
+                assert.ok(err.message.includes('blob store unavailable'));
+                resolve();
+            });
+        });
+    });
+});
@@ -0,0 +1,62 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+
+describe('JSON results', function() {
+    let db: duckdb.Database;
+    let conn: duckdb.Connection;
+    before(function(done) {
+        db = new duckdb.Database(':memory:', () => {
+            conn = new duckdb.Connection(db, done);
+        });
+    });
+
+    it('should match JSON.stringify of the rows', function(done) {
+        const sql = `SELECT i, i / 4 AS d, 'a"b\n' || i AS s, i % 2 = 0 AS b, NULL AS n, DATE '2024-02-29' + i AS dt,
+                            TIMESTAMP '2024-01-01 12:34:56.789' AS ts, [i, i + 1] AS l, {'x': i, 'y': 'z'} AS st
+                     FROM (SELECT range::INTEGER AS i FROM range(3))`;
+        conn.all(sql, (err: null | Error, rows: duckdb.TableData) => {
+            if (err) throw err;
+            conn.allJSON(sql, (err: null | Error, json: Buffer) => {
+                if (err) throw err;
+                assert.equal(json.toString(), JSON.stringify(rows));
+                done();
+            });
+        });
+    });
+
+    it('should write big integers as numbers or strings', function(done) {
+        conn.allJSON('SELECT 9007199254740993::BIGINT AS b', (err: null | Error, json: Buffer) => {
+            if (err) throw err;
+            assert.equal(json.toString(), '[{"b":9007199254740993}]');
+            conn.allJSON({sql: 'SELECT ?::HUGEINT AS h', bigint: 'string'}, '170141183460469231731687303715884105727', (err: null | Error, json: Buffer) => {
+                if (err) throw err;
+                assert.equal(json.toString(), '[{"h":"170141183460469231731687303715884105727"}]');
+                done();
+            });
+        });
+    });
+
+    it('should write an empty result as an empty array', function(done) {
+        db.allJSON('SELECT 1 AS i WHERE false', (err: null | Error, json: Buffer) => {
+            if (err) throw err;
+            assert.equal(json.toString(), '[]');
+            done();
+        });
+    });
+
+    it('should report errors', function(done) {
+        conn.allJSON('SELECT * FROM missing_table', (err: null | Error) => {
+            assert.ok(err);
+            done();
+        });
+    });
+
+    it('should stream NDJSON per chunk', async function() {
+        const lines: string[] = [];
+        for await (const buffer of conn.stream({sql: 'SELECT range AS i FROM range(?)', format: 'ndjson'}, 5000)) {
+            lines.push(...(buffer as unknown as Buffer).toString().split('\n').filter(line => line.length > 0));
+        }
+        assert.equal(lines.length, 5000);
+        assert.deepEqual(JSON.parse(lines[4999]), {i: 4999});
+    });
+});
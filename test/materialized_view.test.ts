@@ -0,0 +1,87 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+
+describe('materialized views', function() {
+    let db: duckdb.Database;
+    let conn: duckdb.Connection;
+    before(function(done) {
+        db = new duckdb.Database(':memory:', () => {
+            conn = new duckdb.Connection(db, () => {
+                conn.exec(`CREATE TABLE events AS SELECT (range % 3)::INTEGER AS k, range::INTEGER AS v FROM range(1000);`, done);
+            });
+        });
+    });
+
+    function all(sql: string, ...params: any[]): Promise<duckdb.TableData> {
+        return new Promise((resolve, reject) => {
+            conn.all(sql, ...params, (err: null | Error, rows: duckdb.TableData) => err ? reject(err) : resolve(rows));
+        });
+    }
+
+    const definition = `SELECT k, count(*) AS cnt, sum(v) AS total, min(v) AS lo, max(v) AS hi, avg(v) AS mean
+                        FROM events WHERE v % 7 <> 0 GROUP BY k`;
+    const expected = `SELECT k, cnt::INTEGER AS cnt, total::INTEGER AS total, lo, hi, round(mean, 6) AS mean FROM (${definition}) ORDER BY k`;
+    const actual = 'SELECT k, cnt::INTEGER AS cnt, total::INTEGER AS total, lo, hi, round(mean, 6) AS mean FROM totals ORDER BY k';
+
+    it('should compute the aggregates of the base table', async function() {
+        const created = await all(`SELECT appended_rows::INTEGER AS n FROM create_materialized_view('totals', '${definition}')`);
+        assert.deepEqual(created, [{n: 1000}]);
+        assert.deepEqual(await all(actual), await all(expected));
+    });
+
+    it('should only aggregate the rows appended since the last refresh', async function() {
+        const before = await all(actual);
+        await all('INSERT INTO events SELECT (range % 5)::INTEGER, range::INTEGER FROM range(2000, 2500)');
+        assert.deepEqual(await all(actual), before);
+
+        const refreshed = await all(`SELECT appended_rows::INTEGER AS n FROM refresh_materialized_view('totals')`);
+        assert.deepEqual(refreshed, [{n: 500}]);
+        assert.deepEqual(await all(actual), await all(expected));
+
+        const unchanged = await all(`SELECT appended_rows::INTEGER AS n FROM refresh_materialized_view('totals')`);
+        assert.deepEqual(unchanged, [{n: 0}]);
+    });
+
+    it('should merge new groups, including NULL, into the states', async function() {
+        await all('INSERT INTO events VALUES (NULL, 3001), (7, 3002)');
+        await all(`CALL refresh_materialized_view('totals')`);
+        assert.deepEqual(await all(actual), await all(expected));
+        await all('INSERT INTO events VALUES (NULL, 3003), (7, 3004), (0, 3005)');
+        await all(`CALL refresh_materialized_view('totals')`);
+        assert.deepEqual(await all(actual), await all(expected));
+    });
+
+    it('should not be maintained in an explicit transaction', async function() {
+        await all('BEGIN TRANSACTION');
+        await assert.rejects(all(`CALL refresh_materialized_view('totals')`), /ROLLBACK would not undo/);
+        await all('ROLLBACK');
+        await all('INSERT INTO events VALUES (1, 3006)');
+        assert.deepEqual(await all(`SELECT appended_rows::INTEGER AS n FROM refresh_materialized_view('totals')`), [{n: 1}]);
+    });
+
+    it('should fail to refresh once aggregated rows have been deleted', async function() {
+        await all('DELETE FROM events WHERE v < 10');
+        await assert.rejects(all(`CALL refresh_materialized_view('totals')`), /append-only/);
+    });
+
+    it('should fail to refresh once rows have been updated', async function() {
+        await all(`CALL create_materialized_view('sums', 'SELECT k, sum(v) AS total FROM events GROUP BY k')`);
+        await all('INSERT INTO events VALUES (1, 3007)');
+        assert.deepEqual(await all(`SELECT appended_rows::INTEGER AS n FROM refresh_materialized_view('sums')`), [{n: 1}]);
+        await all('UPDATE events SET v = v + 1 WHERE v = 20');
+        await assert.rejects(all(`CALL refresh_materialized_view('sums')`), /append-only/);
+        await all(`CALL drop_materialized_view('sums')`);
+    });
+
+    it('should reject queries that cannot be maintained incrementally', async function() {
+        await assert.rejects(all(`CALL create_materialized_view('bad', 'SELECT k, sum(v) FROM events GROUP BY k HAVING sum(v) > 0')`));
+        await assert.rejects(all(`CALL create_materialized_view('bad', 'SELECT k, median(v) FROM events GROUP BY k')`));
+        await assert.rejects(all(`CALL create_materialized_view('bad', 'SELECT e.k, count(*) FROM events e JOIN events f USING (v) GROUP BY e.k')`));
+    });
+
+    it('should drop the view and its state', async function() {
+        await all(`CALL drop_materialized_view('totals')`);
+        await assert.rejects(all('SELECT * FROM totals'));
+        await assert.rejects(all(`CALL refresh_materialized_view('totals')`));
+    });
+});
@@ -0,0 +1,96 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+import * as fs from 'fs';
+
+describe('in-memory file buffers', function() {
+    var db: duckdb.Database;
+
+    before(function(done) {
+        db = new duckdb.Database(':memory:', done);
+    });
+
+    after(function(done) {
+        db.close(done);
+    });
+
+    it('should read a registered parquet buffer', function(done) {
+        db.registerFileBuffer('userdata1.parquet', fs.readFileSync('test/userdata1.parquet'), function(err) {
+            if (err) throw err;
+            db.all("SELECT count(*)::INTEGER AS cnt FROM read_parquet('mem://userdata1.parquet')", function(err, res) {
+                if (err) throw err;
+                assert.equal(res[0].cnt, 1000);
+                done();
+            });
+        });
+    });
+
+    it('should read a registered csv buffer', function(done) {
+        db.registerFileBuffer('data.csv', Buffer.from('a,b\n1,x\n2,y\n'), function(err) {
+            if (err) throw err;
+            db.all("SELECT * FROM read_csv('mem://data.csv') ORDER BY a", function(err, res) {
+                if (err) throw err;
+                assert.deepEqual(res, [{a: 1, b: 'x'}, {a: 2, b: 'y'}]);
+                done();
+            });
+        });
+    });
+
+    it('should collect COPY TO output into a Buffer', function(done) {
+        db.exec("COPY (SELECT range AS i FROM range(100)) TO 'mem://out.parquet' (FORMAT PARQUET)", function(err) {
+            if (err) throw err;
+            db.getFileBuffer('out.parquet', function(err, buffer) {
+                if (err) throw err;
+                assert.equal(buffer.subarray(0, 4).toString(), 'PAR1');
+                db.registerFileBuffer('copy.parquet', buffer, function(err) {
+                    if (err) throw err;
+                    db.all("SELECT sum(i)::INTEGER AS s FROM 'mem://copy.parquet'", function(err, res) {
+                        if (err) throw err;
+                        assert.equal(res[0].s, 4950);
+                        done();
+                    });
+                });
+            });
+        });
+    });
+
+    it('should overwrite a file without changing buffers handed out before', function(done) {
+        db.exec("COPY (SELECT 1 AS i) TO 'mem://overwrite.csv'", function(err) {
+            if (err) throw err;
+            db.getFileBuffer('overwrite.csv', function(err, before) {
+                if (err) throw err;
+                db.exec("COPY (SELECT 2 AS i) TO 'mem://overwrite.csv'", function(err) {
+                    if (err) throw err;
+                    db.getFileBuffer('overwrite.csv', function(err, after) {
+                        if (err) throw err;
+                        assert.equal(before.toString(), 'i\n1\n');
+                        assert.equal(after.toString(), 'i\n2\n');
+                        done();
+                    });
+                });
+            });
+        });
+    });
+
+    it('should glob registered files', function(done) {
+        db.registerFileBuffer('part1.csv', Buffer.from('v\n1\n'));
+        db.registerFileBuffer('part2.csv', Buffer.from('v\n2\n'));
+        db.all("SELECT sum(v)::INTEGER AS s FROM read_csv('mem://part*.csv')", function(err, res) {
+            if (err) throw err;
+            assert.equal(res[0].s, 3);
+            done();
+        });
+    });
+
+    it('should unregister a file', function(done) {
+        db.unregisterFileBuffer('data.csv', function(err) {
+            if (err) throw err;
+            db.all("SELECT * FROM read_csv('mem://data.csv')", function(err) {
+                assert.ok(err);
+                db.unregisterFileBuffer('data.csv', function(err) {
+                    assert.ok(err);
+                    done();
+                });
+            });
+        });
+    });
+});
@@ -0,0 +1,85 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+import * as fs from 'fs';
+import * as helper from './support/helper';
+
+describe('persistent parquet metadata cache', function() {
+    const filename = 'test/tmp/metadata_cache.parquet';
+    const directory = 'test/tmp/parquet_metadata_cache';
+
+    function open(): Promise<duckdb.Database> {
+        return new Promise((resolve, reject) => {
+            const db = new duckdb.Database(':memory:', (err: null | Error) => {
+                if (err) return reject(err);
+                db.exec(`SET parquet_metadata_cache_directory = '${directory}'`, (err: null | Error) => err ? reject(err) : resolve(db));
+            });
+        });
+    }
+
+    function all(db: duckdb.Database, sql: string): Promise<duckdb.TableData> {
+        return new Promise((resolve, reject) => {
+            db.all(sql, (err: null | Error, rows: duckdb.TableData) => err ? reject(err) : resolve(rows));
+        });
+    }
+
+    function close(db: duckdb.Database): Promise<void> {
+        return new Promise((resolve) => db.close(() => resolve()));
+    }
+
+    function entries(): string[] {
+        return fs.readdirSync(directory).filter(name => name.endsWith('.parquet_metadata'));
+    }
+
+    // entries are replaced by moving a new file into place: the inode only stays the same on a cache hit
+    function entry(): number {
+        const names = entries();
+        assert.equal(names.length, 1);
+        return fs.statSync(`${directory}/${names[0]}`).ino;
+    }
+
+    before(function() {
+        helper.ensureExists('test/tmp');
+        helper.deleteFile(filename);
+        fs.rmSync(directory, {recursive: true, force: true});
+    });
+
+    after(function() {
+        helper.deleteFile(filename);
+        fs.rmSync(directory, {recursive: true, force: true});
+    });
+
+    let written: number;
+
+    it('should keep the metadata across restarts', async function() {
+        let db = await open();
+        await all(db, `COPY (SELECT range::INTEGER AS i FROM range(1000)) TO '${filename}' (FORMAT parquet)`);
+        assert.deepEqual(await all(db, `SELECT count(*)::INTEGER AS cnt FROM '${filename}'`), [{cnt: 1000}]);
+        // entries are written in the background, closing the database waits for them
+        await close(db);
+        written = entry();
+
+        db = await open();
+        assert.deepEqual(await all(db, `SELECT sum(i)::INTEGER AS total FROM '${filename}'`), [{total: 499500}]);
+        await close(db);
+        assert.equal(entry(), written);
+    });
+
+    it('should not use the metadata of a file that changed', async function() {
+        const db = await open();
+        await all(db, `COPY (SELECT range::INTEGER AS i FROM range(10)) TO '${filename}' (FORMAT parquet)`);
+        assert.deepEqual(await all(db, `SELECT count(*)::INTEGER AS cnt FROM '${filename}'`), [{cnt: 10}]);
+        await close(db);
+        assert.notEqual(entry(), written);
+    });
+
+    it('should read the file if the entry cannot be read', async function() {
+        // a directory where the entry was expected
+        const name = entries()[0];
+        fs.unlinkSync(`${directory}/${name}`);
+        fs.mkdirSync(`${directory}/${name}`);
+        const db = await open();
+        assert.deepEqual(await all(db, `SELECT count(*)::INTEGER AS cnt FROM '${filename}'`), [{cnt: 10}]);
+        await close(db);
+        assert.ok(fs.statSync(`${directory}/${name}`).isDirectory());
+    });
+});
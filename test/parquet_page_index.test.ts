@@ -0,0 +1,42 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+import * as helper from './support/helper';
+
+describe('parquet page index', function() {
+    const filename = 'test/tmp/page_index.parquet';
+    let db: duckdb.Database;
+    before(function(done) {
+        helper.ensureExists('test/tmp');
+        helper.deleteFile(filename);
+        db = new duckdb.Database(':memory:', () => {
+            // shuffled keys: only clustering gives the pages narrow min/max values
+            db.exec(`COPY (SELECT range::BIGINT AS k, range * 2 AS v FROM range(100000) ORDER BY hash(range))
+                     TO '${filename}' (FORMAT parquet, WRITE_PAGE_INDEX true, CLUSTER_BY (k), ROW_GROUP_SIZE 100000)`, done);
+        });
+    });
+
+    after(function() {
+        helper.deleteFile(filename);
+    });
+
+    function all(sql: string): Promise<duckdb.TableData> {
+        return new Promise((resolve, reject) => {
+            db.all(sql, (err: null | Error, rows: duckdb.TableData) => err ? reject(err) : resolve(rows));
+        });
+    }
+
+    it('should sort the rows within a row group', async function() {
+        const rows = await all(`SELECT k FROM '${filename}' LIMIT 5`);
+        assert.deepEqual(rows.map(row => Number(row.k)), [0, 1, 2, 3, 4]);
+    });
+
+    it('should return the same rows when skipping pages', async function() {
+        const rows = await all(`SELECT count(*)::INTEGER AS cnt, sum(v)::INTEGER AS total FROM '${filename}' WHERE k BETWEEN 50000 AND 50009`);
+        assert.deepEqual(rows, [{cnt: 10, total: 1000090}]);
+    });
+
+    it('should skip the pages ruled out by the page index', async function() {
+        const rows = await all(`EXPLAIN ANALYZE SELECT v FROM '${filename}' WHERE k = 77777`);
+        assert.ok(rows.some(row => String(row.explain_value).includes('Pages Skipped')));
+    });
+});
@@ -0,0 +1,39 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+
+describe('parquet page skipping', function() {
+    // one row group of 4000 rows in four pages of 1000 rows per column, k = 0..3999 and v = 2 * k, with a
+    // ColumnIndex and an OffsetIndex for both columns
+    const filename = 'test/page_index.parquet';
+    let db: duckdb.Database;
+    before(function(done) {
+        db = new duckdb.Database(':memory:', done);
+    });
+
+    function all(sql: string): Promise<duckdb.TableData> {
+        return new Promise((resolve, reject) => {
+            db.all(sql, (err: null | Error, rows: duckdb.TableData) => err ? reject(err) : resolve(rows));
+        });
+    }
+
+    it('should return the rows of the pages that are not skipped', async function() {
+        assert.deepEqual(await all(`SELECT count(*)::INTEGER AS cnt, sum(v)::INTEGER AS total FROM '${filename}' WHERE k = 2500`),
+                         [{cnt: 1, total: 5000}]);
+        assert.deepEqual(await all(`SELECT count(*)::INTEGER AS cnt, sum(v)::INTEGER AS total FROM '${filename}' WHERE k BETWEEN 1990 AND 2010`),
+                         [{cnt: 21, total: 84000}]);
+    });
+
+    it('should report the skipped pages of every column', async function() {
+        const rows = await all(`EXPLAIN (ANALYZE, FORMAT json) SELECT sum(v) FROM '${filename}' WHERE k = 2500`);
+        const skipped: string[] = [];
+        const visit = (node: any) => {
+            if (node.extra_info && node.extra_info['Pages Skipped'] !== undefined) {
+                skipped.push(node.extra_info['Pages Skipped']);
+            }
+            (node.children || []).forEach(visit);
+        };
+        visit(JSON.parse(rows[0].explain_value));
+        // three of the four pages of k and of v
+        assert.deepEqual(skipped, ['6']);
+    });
+});
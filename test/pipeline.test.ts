@@ -0,0 +1,87 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+
+describe('pipelining', function() {
+    let db: duckdb.Database;
+    let conn: duckdb.Connection;
+    before(function(done) {
+        db = new duckdb.Database(':memory:', () => {
+            conn = new duckdb.Connection(db, () => {
+                conn.exec('CREATE TABLE kv AS SELECT range::INTEGER AS k, range * 10 AS v FROM range(1000)', done);
+            });
+        });
+    });
+
+    it('should return the rows of every query in order', async function() {
+        const queries: duckdb.PipelineQuery[] = [];
+        for (let i = 0; i < 1000; i++) {
+            queries.push({sql: 'SELECT v FROM kv WHERE k = ?', params: [i]});
+        }
+        queries.push('SELECT count(*)::INTEGER AS cnt FROM kv');
+        const results = await conn.pipeline(queries);
+        assert.equal(results.length, 1001);
+        for (let i = 0; i < 1000; i++) {
+            assert.deepEqual(results[i], [{v: i * 10}]);
+        }
+        assert.deepEqual(results[1000], [{cnt: 1000}]);
+    });
+
+    it('should run a parameterized pipeline in one worker hop', function(done) {
+        // the callbacks of one worker hop are all called before the event loop moves on to the next ticker
+        let turn = 0;
+        let finished = false;
+        const tick = () => {
+            turn++;
+            if (!finished) {
+                setImmediate(tick);
+            }
+        };
+        setImmediate(tick);
+        const turns: number[] = [];
+        conn.setPipelining(true);
+        for (let i = 0; i < 50; i++) {
+            // a string is cast to the INTEGER the statement expects for it
+            const param = i % 2 === 0 ? i : String(i);
+            conn.all('SELECT v FROM kv WHERE k = ?', param, (err: null | Error, rows: duckdb.TableData) => {
+                if (err) throw err;
+                assert.deepEqual(rows, [{v: i * 10}]);
+                turns.push(turn);
+                if (turns.length === 50) {
+                    finished = true;
+                    conn.setPipelining(false);
+                    assert.deepEqual(turns, new Array(50).fill(turns[0]));
+                    done();
+                }
+            });
+        }
+    });
+
+    it('should run every query and reject with the first error', async function() {
+        const error = await conn.pipeline([
+            'INSERT INTO kv VALUES (1000, 10000)',
+            'SELECT * FROM missing_table',
+            'INSERT INTO kv VALUES (1001, 10010)',
+        ]).then(() => null, (err: any) => err);
+        assert.ok(error);
+        assert.equal(error.index, 1);
+        const [[row]] = await conn.pipeline(['SELECT count(*)::INTEGER AS cnt FROM kv WHERE k >= 1000']);
+        assert.equal(row.cnt, 2);
+    });
+
+    it('should keep callbacks in order with pipelining enabled', function(done) {
+        const order: number[] = [];
+        conn.setPipelining(true);
+        for (let i = 0; i < 10; i++) {
+            conn.all('SELECT ? AS i', i, (err: null | Error, rows: duckdb.TableData) => {
+                if (err) throw err;
+                order.push(rows[0].i);
+            });
+        }
+        conn.exec('SELECT 1', (err: null | Error) => {
+            if (err) throw err;
+            conn.setPipelining(false);
+            assert.deepEqual(order, [0, 1, 2, 3, 4, 5, 6, 7, 8, 9]);
+            done();
+        });
+    });
+});
@@ -0,0 +1,116 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+
+describe('shared plan cache', function() {
+    let db: duckdb.Database;
+    let first: duckdb.Connection;
+    let second: duckdb.Connection;
+    before(function(done) {
+        db = new duckdb.Database(':memory:', () => {
+            first = new duckdb.Connection(db, () => {
+                second = new duckdb.Connection(db, () => {
+                    first.exec(`SET GLOBAL plan_cache_size = 100;
+                                CREATE TABLE t AS SELECT range::INTEGER AS i, (range % 10)::INTEGER AS g FROM range(1000);`, done);
+                });
+            });
+        });
+    });
+
+    function all(conn: duckdb.Connection, sql: string, ...params: any[]): Promise<duckdb.TableData> {
+        return new Promise((resolve, reject) => {
+            conn.all(sql, ...params, (err: null | Error, rows: duckdb.TableData) => err ? reject(err) : resolve(rows));
+        });
+    }
+
+    async function stats(): Promise<{hits: number, misses: number, entries: number}> {
+        // CALL statements are not cached, so reading the counters does not change them
+        const [row] = await all(first, 'CALL duckdb_plan_cache()');
+        return {hits: Number(row.hits), misses: Number(row.misses), entries: Number(row.entries)};
+    }
+
+    const sql = 'SELECT g, count(*)::INTEGER AS cnt FROM t WHERE i >= ? GROUP BY g ORDER BY g';
+
+    it('should share plans between connections', async function() {
+        const before = await stats();
+        const groups = [0, 1, 2, 3, 4, 5, 6, 7, 8, 9];
+        assert.deepEqual(await all(first, sql, 500), groups.map(g => ({g: g, cnt: 50})));
+        assert.deepEqual(await all(second, sql, 500), groups.map(g => ({g: g, cnt: 50})));
+        assert.deepEqual(await all(second, sql, 990), groups.map(g => ({g: g, cnt: 1})));
+        const after = await stats();
+        assert.equal(after.misses - before.misses, 1);
+        assert.equal(after.hits - before.hits, 2);
+    });
+
+    it('should not reuse plans after the catalog changed', async function() {
+        await all(first, 'DROP TABLE t');
+        await all(first, 'CREATE TABLE t AS SELECT (range * 2)::INTEGER AS i, 7 AS g FROM range(10)');
+        const before = await stats();
+        assert.deepEqual(await all(second, sql, 0), [{g: 7, cnt: 10}]);
+        const after = await stats();
+        assert.equal(after.misses - before.misses, 1);
+        assert.equal(after.hits - before.hits, 0);
+    });
+
+    it('should not share plans that read different variables', async function() {
+        await all(first, 'SET VARIABLE threshold = 5');
+        await all(second, 'SET VARIABLE threshold = 8');
+        const variable_sql = "SELECT count(*)::INTEGER AS cnt FROM t WHERE i >= getvariable('threshold')";
+        const before = await stats();
+        assert.deepEqual(await all(first, variable_sql), [{cnt: 7}]);
+        assert.deepEqual(await all(second, variable_sql), [{cnt: 6}]);
+        assert.deepEqual(await all(first, variable_sql), [{cnt: 7}]);
+        const after = await stats();
+        assert.equal(after.misses - before.misses, 2);
+        assert.equal(after.hits - before.hits, 1);
+    });
+
+    it('should share plans with joins', async function() {
+        // the filters the join pushes into the scan of t are set up again for every copy of the plan
+        await all(first, 'CREATE TABLE u AS SELECT range::INTEGER AS i FROM range(5)');
+        const join_sql = 'SELECT count(*)::INTEGER AS cnt FROM t JOIN u USING (i)';
+        const before = await stats();
+        assert.deepEqual(await all(first, join_sql), [{cnt: 3}]);
+        assert.deepEqual(await all(second, join_sql), [{cnt: 3}]);
+        const after = await stats();
+        assert.equal(after.misses - before.misses, 1);
+        assert.equal(after.hits - before.hits, 1);
+    });
+
+    it('should not cache plans with a Top-N', async function() {
+        // the Top-N pushes a filter into the scan that is updated while the query runs
+        const top_n_sql = 'SELECT i FROM t ORDER BY i DESC LIMIT 2';
+        const before = await stats();
+        assert.deepEqual(await all(first, top_n_sql), [{i: 18}, {i: 16}]);
+        assert.deepEqual(await all(second, top_n_sql), [{i: 18}, {i: 16}]);
+        const after = await stats();
+        assert.equal(after.hits - before.hits, 0);
+        assert.equal(after.entries, before.entries);
+    });
+
+    it('should keep the plans of other connections when a connection changes its settings', async function() {
+        assert.deepEqual(await all(first, sql, 0), [{g: 7, cnt: 10}]);
+        let before = await stats();
+        await all(second, "SET task_priority = 'low'");
+        await all(second, 'SET VARIABLE unrelated = 1');
+        await all(second, 'RESET task_priority');
+        assert.deepEqual(await all(first, sql, 0), [{g: 7, cnt: 10}]);
+        let after = await stats();
+        assert.equal(after.hits - before.hits, 1);
+        assert.equal(after.misses - before.misses, 0);
+        assert.equal(after.entries, before.entries);
+
+        // a global setting can change the plans of every connection
+        before = after;
+        await all(second, 'SET GLOBAL plan_cache_size = 100');
+        assert.deepEqual(await all(first, sql, 0), [{g: 7, cnt: 10}]);
+        after = await stats();
+        assert.equal(after.hits - before.hits, 0);
+        assert.equal(after.misses - before.misses, 1);
+    });
+
+    it('should not share plans with connections that have temporary tables', async function() {
+        await all(second, 'CREATE TEMPORARY TABLE t AS SELECT 1 AS i, 3 AS g');
+        assert.deepEqual(await all(second, sql, 0), [{g: 3, cnt: 1}]);
+        assert.deepEqual(await all(first, sql, 0), [{g: 7, cnt: 10}]);
+    });
+});
@@ -693,6 +693,75 @@ describe('prepare', function() {
 
         });
 
+        after(function(done) { db.close(done); });
+    });
+    describe('type-directed parameter binding', function() {
+        var db: sqlite3.Database;
+        before(function(done) {
+            db = new sqlite3.Database(':memory:', function() {
+                db.run("CREATE TABLE typed (b BIGINT, l DOUBLE[], a INTEGER[3], s STRUCT(x INTEGER, y VARCHAR), ts TIMESTAMP)", done);
+            });
+        });
+
+        it('should bind values to the expected parameter types', function(done) {
+            var stmt = db.prepare("INSERT INTO typed VALUES (?, ?, ?, ?, ?)", function(err: null | Error) {
+                if (err) return done(err);
+                stmt.run(BigInt("9007199254740993"), new Float64Array([1.5, 2.5]), new Int32Array([1, 2, 3]), {x: 42, y: 'hello'},
+                         new Date(Date.UTC(2020, 0, 1, 12, 30)), function(err: null | Error) {
+                    if (err) return done(err);
+                    db.all("SELECT * FROM typed", function(err: null | Error, rows: TableData) {
+                        if (err) return done(err);
+                        assert.equal(rows[0].b, BigInt("9007199254740993"));
+                        assert.deepEqual(rows[0].l, [1.5, 2.5]);
+                        assert.deepEqual(rows[0].a, [1, 2, 3]);
+                        assert.deepEqual(rows[0].s, {x: 42, y: 'hello'});
+                        assert.equal(rows[0].ts.getTime(), Date.UTC(2020, 0, 1, 12, 30));
+                        done();
+                    });
+                });
+            });
+        });
+
+        it('should infer nested types before the statement is prepared', function(done) {
+            db.all("SELECT ? AS b, ? AS l, ? AS s", BigInt("12345678901234"), [1, 2, 3], {x: 1, y: 'a'}, function(err: null | Error, rows: TableData) {
+                if (err) return done(err);
+                assert.equal(rows[0].b, BigInt("12345678901234"));
+                assert.deepEqual(rows[0].l, [1, 2, 3]);
+                assert.deepEqual(rows[0].s, {x: 1, y: 'a'});
+                done();
+            });
+        });
+
+        it('should bind to the expected types when running a statement right away', function(done) {
+            db.all("SELECT cardinality(?::MAP(VARCHAR, INTEGER))::INTEGER AS n, ?::DOUBLE[] AS l", {a: 1, b: 2}, new Int32Array([1, 2, 3]), function(err: null | Error, rows: TableData) {
+                if (err) return done(err);
+                assert.deepEqual(rows, [{n: 2, l: [1, 2, 3]}]);
+                done();
+            });
+        });
+
+        it('should bind named parameters from an object', function(done) {
+            var stmt = db.prepare("SELECT $a::INTEGER + $b::INTEGER AS sum, $name::VARCHAR AS name", function(err: null | Error) {
+                if (err) return done(err);
+                stmt.all({a: 40, b: 2, name: 'duck'}, function(err: null | Error, rows: TableData) {
+                    if (err) return done(err);
+                    assert.deepEqual(rows, [{sum: 42, name: 'duck'}]);
+                    done();
+                });
+            });
+        });
+
+        it('should still bind a struct to a single positional parameter', function(done) {
+            var stmt = db.prepare("SELECT ?::STRUCT(x INTEGER, y VARCHAR) AS s", function(err: null | Error) {
+                if (err) return done(err);
+                stmt.all({x: 7, y: 'z'}, function(err: null | Error, rows: TableData) {
+                    if (err) return done(err);
+                    assert.deepEqual(rows, [{s: {x: 7, y: 'z'}}]);
+                    done();
+                });
+            });
+        });
+
         after(function(done) { db.close(done); });
     });
 });
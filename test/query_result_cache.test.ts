@@ -0,0 +1,57 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+
+describe('query result cache', function() {
+    let db: duckdb.Database;
+    let conn: duckdb.Connection;
+    let writer: duckdb.Connection;
+    before(function(done) {
+        db = new duckdb.Database(':memory:', () => {
+            conn = new duckdb.Connection(db, () => {
+                writer = new duckdb.Connection(db, () => {
+                    conn.exec(`CREATE TABLE t AS SELECT range::INTEGER AS i FROM range(1000);
+                               SET enable_query_result_cache = true;`, done);
+                });
+            });
+        });
+    });
+
+    function all(c: duckdb.Connection, sql: string, ...params: any[]): Promise<duckdb.TableData> {
+        return new Promise((resolve, reject) => {
+            c.all(sql, ...params, (err: null | Error, rows: duckdb.TableData) => err ? reject(err) : resolve(rows));
+        });
+    }
+
+    async function stats(): Promise<{hits: number, misses: number}> {
+        const rows = await all(conn, 'SELECT hits::INTEGER AS hits, misses::INTEGER AS misses FROM duckdb_query_result_cache()');
+        return rows[0] as any;
+    }
+
+    it('should reuse the result of a repeated query', async function() {
+        const sql = 'SELECT sum(i)::INTEGER AS total FROM t WHERE i < ?';
+        const before = await stats();
+        assert.deepEqual(await all(conn, sql, 100), [{total: 4950}]);
+        assert.deepEqual(await all(conn, sql, 100), [{total: 4950}]);
+        assert.deepEqual(await all(conn, sql, 10), [{total: 45}]);
+        const after = await stats();
+        assert.equal(after.hits - before.hits, 1);
+        assert.equal(after.misses - before.misses, 2);
+    });
+
+    it('should not return results from before a committed write', async function() {
+        const sql = 'SELECT count(*)::INTEGER AS cnt FROM t';
+        assert.deepEqual(await all(conn, sql), [{cnt: 1000}]);
+        await all(writer, 'INSERT INTO t VALUES (1000)');
+        assert.deepEqual(await all(conn, sql), [{cnt: 1001}]);
+        await all(writer, 'DELETE FROM t WHERE i >= 500');
+        assert.deepEqual(await all(conn, sql), [{cnt: 500}]);
+    });
+
+    it('should not cache volatile queries', async function() {
+        const before = await stats();
+        await all(conn, 'SELECT random() AS r FROM t LIMIT 1');
+        await all(conn, 'SELECT random() AS r FROM t LIMIT 1');
+        const after = await stats();
+        assert.equal(after.hits, before.hits);
+    });
+});
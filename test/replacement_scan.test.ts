@@ -94,6 +94,91 @@ describe("replacement scan", () => {
     });
   });
 
+  describe("with cached replacement scan", () => {
+    let calls = 0;
+    const cachedScan = (table: string) => {
+      calls++;
+      if (table !== "points") {
+        return null;
+      }
+      return {
+        columns: {
+          id: new Int32Array([1, 2, 3]),
+          label: ["a", null, "c"],
+        },
+      };
+    };
+
+    before((done) => {
+      db = new sqlite3.Database(":memory:", () => {
+        db.registerReplacementScan(cachedScan, { cache: true }).then(done);
+      });
+    });
+
+    it("returns data from JS", (done) => {
+      db.all(
+        "SELECT id, label FROM points ORDER BY id",
+        function (err: null | Error, rows: TableData) {
+          expect(err).to.be.null;
+          expect(rows).to.deep.equal([
+            { id: 1, label: "a" },
+            { id: 2, label: null },
+            { id: 3, label: "c" },
+          ]);
+          done();
+        }
+      );
+    });
+
+    it("does not call into JS again for cached tables", (done) => {
+      calls = 0;
+      db.all(
+        "SELECT sum(id)::INTEGER AS s FROM points",
+        function (err: null | Error, rows: TableData) {
+          expect(err).to.be.null;
+          expect(rows[0].s).to.equal(6);
+          expect(calls).to.equal(0);
+          done();
+        }
+      );
+    });
+
+    it("calls into JS again after invalidation", (done) => {
+      calls = 0;
+      db.invalidateReplacementScans("points");
+      db.all(
+        "SELECT count(*)::INTEGER AS c FROM points",
+        function (err: null | Error, rows: TableData) {
+          expect(err).to.be.null;
+          expect(rows[0].c).to.equal(3);
+          expect(calls).to.equal(1);
+          done();
+        }
+      );
+    });
+
+    it("accepts batches returned by allColumnar", (done) => {
+      db.allColumnar(
+        "SELECT range::INTEGER AS v, range::VARCHAR AS s FROM range(5)",
+        function (err: null | Error, batches: sqlite3.ColumnarBatch[]) {
+          expect(err).to.be.null;
+          db.registerReplacementScan((table: string) =>
+            table === "copied" ? { batches } : null
+          ).then(() => {
+            db.all(
+              "SELECT sum(v)::INTEGER AS v, max(s) AS s FROM copied",
+              function (err: null | Error, rows: TableData) {
+                expect(err).to.be.null;
+                expect(rows).to.deep.equal([{ v: 10, s: "4" }]);
+                done();
+              }
+            );
+          });
+        }
+      );
+    });
+  });
+
   describe("with invalid replacement scan functions", () => {
     it("does not crash with bad return values", (done) => {
       db = new sqlite3.Database(":memory:", () => {
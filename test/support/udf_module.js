@@ -0,0 +1,13 @@
+// UDF module loaded by the worker threads of register_udf_module in udf.test.ts
+exports.fnv1a = function (str) {
+    var hash = 0x811c9dc5;
+    for (var i = 0; i < str.length; i++) {
+        hash ^= str.charCodeAt(i);
+        hash = Math.imul(hash, 0x01000193) >>> 0;
+    }
+    return hash | 0;
+};
+
+exports.fail = function () {
+    throw new Error('failing in a worker');
+};
@@ -0,0 +1,160 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+
+const udf = require('../lib/udf');
+
+// An asynchronous UDF whose calls only complete once the gate is opened: a DuckDB thread that evaluates it waits
+// in the call, so the number of pending calls is the number of threads executing the query
+class Gate {
+    pending = 0;
+    private opened = false;
+    private blocked: (() => void)[] = [];
+    private waiters: (() => void)[] = [];
+
+    register(conn: duckdb.Connection, name: string): Promise<void> {
+        const vectorized = udf.vectorize((i: number) => i);
+        return new Promise((resolve, reject) => {
+            (conn as any).register_udf_bulk(name, 'integer', (desc: any, complete: (err: null, ret: any) => void) => {
+                const finish = () => {
+                    this.pending--;
+                    vectorized(desc);
+                    complete(null, desc.ret);
+                };
+                this.pending++;
+                this.waiters.slice().forEach(waiter => waiter());
+                if (this.opened) {
+                    setImmediate(finish);
+                } else {
+                    this.blocked.push(finish);
+                }
+            }, (err: null | Error) => err ? reject(err) : resolve(), {async: true});
+        });
+    }
+
+    waitPending(count: number): Promise<void> {
+        return new Promise(resolve => {
+            const check = () => {
+                if (this.pending >= count) {
+                    this.waiters.splice(this.waiters.indexOf(check), 1);
+                    resolve();
+                }
+            };
+            this.waiters.push(check);
+            check();
+        });
+    }
+
+    open() {
+        this.opened = true;
+        this.blocked.splice(0).forEach(finish => finish());
+    }
+
+    close() {
+        this.opened = false;
+    }
+}
+
+describe('task priorities', function() {
+    let db: duckdb.Database;
+    let interactive: duckdb.Connection;
+    let batch: duckdb.Connection;
+    before(function(done) {
+        db = new duckdb.Database(':memory:', () => {
+            interactive = new duckdb.Connection(db, () => {
+                batch = new duckdb.Connection(db, () => {
+                    // three row groups: a scan of the table runs on up to three threads
+                    batch.exec('CREATE TABLE numbers AS SELECT range::INTEGER AS i FROM range(300000)', done);
+                });
+            });
+        });
+    });
+
+    after(function(done) {
+        db.exec('RESET threads', done);
+    });
+
+    function all(conn: duckdb.Connection, sql: string): Promise<duckdb.TableData> {
+        return new Promise((resolve, reject) => {
+            conn.all(sql, (err: null | Error, rows: duckdb.TableData) => err ? reject(err) : resolve(rows));
+        });
+    }
+
+    function exported(sql: string): Promise<void> {
+        return new Promise((resolve, reject) => {
+            db.exportStream(sql, {format: 'csv'}).on('error', reject).on('end', resolve).resume();
+        });
+    }
+
+    const sleep = (ms: number) => new Promise(resolve => setTimeout(resolve, ms));
+
+    it('should set the priority per connection', async function() {
+        await all(interactive, "SET task_priority = 'high'");
+        await all(batch, "SET task_priority = 'low'");
+        assert.deepEqual(await all(interactive, "SELECT upper(current_setting('task_priority')) AS p"), [{p: 'HIGH'}]);
+        assert.deepEqual(await all(batch, "SELECT upper(current_setting('task_priority')) AS p"), [{p: 'LOW'}]);
+        await all(batch, "RESET task_priority");
+    });
+
+    it('should reject unknown priorities', async function() {
+        await assert.rejects(all(interactive, "SET task_priority = 'urgent'"));
+    });
+
+    it('should cap the threads of a query, not of each of its pipelines', async function() {
+        await all(batch, 'SET threads = 4');
+        const gate = new Gate();
+        await gate.register(batch, 'gated');
+        // the two sides of the UNION ALL are pipelines that run at the same time
+        const sql = 'SELECT count(*)::INTEGER AS cnt FROM (SELECT gated(i) FROM numbers UNION ALL SELECT gated(i) FROM numbers)';
+
+        let query = all(batch, sql);
+        await gate.waitPending(3);
+        gate.open();
+        assert.deepEqual(await query, [{cnt: 600000}]);
+
+        // two threads for the first pipeline, and the one thread that every pipeline gets for the second
+        await all(batch, 'SET max_threads_per_query = 2');
+        gate.close();
+        query = all(batch, sql);
+        await gate.waitPending(3);
+        // a fourth thread would have joined by now
+        await sleep(200);
+        assert.equal(gate.pending, 3);
+        gate.open();
+        assert.deepEqual(await query, [{cnt: 600000}]);
+        await all(batch, 'RESET max_threads_per_query');
+    });
+
+    it('should hand a free thread to high priority work first', async function() {
+        // a single background thread, the other tasks run on the threads that started their queries
+        await all(batch, 'SET threads = 2');
+        const gates = {normal: new Gate(), low: new Gate(), high: new Gate()};
+        await gates.normal.register(batch, 'gated_normal');
+        await gates.low.register(batch, 'gated_low');
+        await gates.high.register(batch, 'gated_high');
+
+        // the threads are picked with weights 16:4:1, take the majority of a few rounds
+        const winners: string[] = [];
+        for (let round = 0; round < 5; round++) {
+            [gates.normal, gates.low, gates.high].forEach(gate => gate.close());
+            // exports run on threads of their own and read the priority from the global setting
+            const normal = exported('SELECT sum(gated_normal(i)) FROM numbers');
+            // the background thread is busy with the normal priority query
+            await gates.normal.waitPending(2);
+            await all(batch, "SET GLOBAL task_priority = 'low'");
+            const low = exported('SELECT sum(gated_low(i)) FROM numbers');
+            await gates.low.waitPending(1);
+            await all(batch, "RESET GLOBAL task_priority");
+            const high = all(interactive, 'SELECT sum(gated_high(i)) FROM numbers');
+            await gates.high.waitPending(1);
+
+            // both queries have a task queued for the background thread, which is freed now
+            gates.normal.open();
+            winners.push(await Promise.race([gates.low.waitPending(2).then(() => 'low'),
+                                             gates.high.waitPending(2).then(() => 'high')]));
+            gates.low.open();
+            gates.high.open();
+            await Promise.all([normal, low, high]);
+        }
+        assert.ok(winners.filter(winner => winner === 'high').length >= 3, winners.join(', '));
+    });
+});
@@ -0,0 +1,81 @@
+import * as duckdb from '..';
+import * as assert from 'assert';
+import * as helper from './support/helper';
+
+describe('top-n scan order', function() {
+    const filename = 'test/tmp/top_n_scan_order.parquet';
+    let db: duckdb.Database;
+    before(function(done) {
+        helper.ensureExists('test/tmp');
+        helper.deleteFile(filename);
+        db = new duckdb.Database(':memory:', () => {
+            // appended in ascending order: the largest values are in the last row groups
+            db.exec(`CREATE TABLE t AS SELECT range::BIGINT AS k, range % 7 AS v FROM range(1000000);
+                     COPY t TO '${filename}' (FORMAT parquet, ROW_GROUP_SIZE 100000);`, done);
+        });
+    });
+
+    after(function() {
+        helper.deleteFile(filename);
+    });
+
+    function all(sql: string): Promise<duckdb.TableData> {
+        return new Promise((resolve, reject) => {
+            db.all(sql, (err: null | Error, rows: duckdb.TableData) => err ? reject(err) : resolve(rows));
+        });
+    }
+
+    async function scanRows(sql: string): Promise<number> {
+        const rows = await all(`EXPLAIN (ANALYZE, FORMAT json) ${sql}`);
+        const scans: number[] = [];
+        const visit = (node: any) => {
+            if (node.extra_info && (node.extra_info.Table === 't' || node.extra_info.Function === 'READ_PARQUET')) {
+                scans.push(Number(node.operator_cardinality));
+            }
+            (node.children || []).forEach(visit);
+        };
+        visit(JSON.parse(rows[0].explain_value));
+        assert.equal(scans.length, 1);
+        return scans[0];
+    }
+
+    const queries = [
+        'SELECT k::INTEGER AS k FROM t ORDER BY k DESC LIMIT 3',
+        'SELECT k::INTEGER AS k FROM t WHERE v = 3 ORDER BY k LIMIT 3',
+        `SELECT k::INTEGER AS k FROM '${filename}' ORDER BY k DESC LIMIT 3`,
+        `SELECT k::INTEGER AS k FROM '${filename}' WHERE v = 3 ORDER BY k LIMIT 3`,
+    ];
+    const expected = [
+        [{k: 999999}, {k: 999998}, {k: 999997}],
+        [{k: 3}, {k: 10}, {k: 17}],
+        [{k: 999999}, {k: 999998}, {k: 999997}],
+        [{k: 3}, {k: 10}, {k: 17}],
+    ];
+
+    it('should return the same rows with and without reordering the scan', async function() {
+        for (const setting of ['true', 'false']) {
+            await all(`SET enable_top_n_scan_order = ${setting}`);
+            for (let i = 0; i < queries.length; i++) {
+                assert.deepEqual(await all(queries[i]), expected[i]);
+            }
+        }
+        await all('RESET enable_top_n_scan_order');
+    });
+
+    for (const i of [0, 2]) {
+        const source = i === 0 ? 'table' : 'parquet';
+        it(`should skip the row groups behind the boundary of the Top-N on a ${source}`, async function() {
+            // a single thread: the first row group scanned sets the boundary for all others
+            await all('SET threads = 1');
+            await all('SET enable_top_n_scan_order = false');
+            // in file order every row group holds larger values than the boundary so far
+            const unordered = await scanRows(queries[i]);
+            await all('RESET enable_top_n_scan_order');
+            // the last row group is scanned first, its values exclude all other row groups
+            const ordered = await scanRows(queries[i]);
+            await all('RESET threads');
+            assert.equal(unordered, 1000000);
+            assert.ok(ordered <= 200000, `${ordered} rows scanned with the scan order`);
+        });
+    }
+});
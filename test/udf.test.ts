@@ -229,5 +229,123 @@ describe('UDFs', function() {
             });
             db.unregister_udf("udf", done);
         });
+
+        it('list', function(done) {
+            db.register_udf("udf", "double", (l: number[]) => l.reduce((a, b) => a + (b ?? 0), 0));
+            db.all("SELECT udf(CASE WHEN x % 3 = 0 THEN [x::FLOAT, 0.5, NULL] ELSE [] END) v FROM range(2, 5) t(x) ORDER BY x", function(err: null | Error, rows: TableData) {
+                if (err) done(new Error('Query failed unexpectedly'));
+                assert.deepEqual(rows.map(r => r.v), [0, 3.5, 0]);
+            });
+            db.unregister_udf("udf", done);
+        });
+
+        it('list of structs', function(done) {
+            db.register_udf("udf", "varchar", (l: {k: string, n: number}[]) => l.map(e => e.k + e.n).join(','));
+            db.all("SELECT udf([{'k': 'a', 'n': 1}, {'k': 'b', 'n': 2}]) v", function(err: null | Error, rows: TableData) {
+                if (err) done(new Error('Query failed unexpectedly'));
+                assert.equal(rows[0].v, 'a1,b2');
+            });
+            db.unregister_udf("udf", done);
+        });
+
+        it('map', function(done) {
+            db.register_udf("udf", "varchar", (m: {key: string, value: number}[]) => m.map(e => e.key + '=' + e.value).join(','));
+            db.all("SELECT udf(MAP {'x': 1, 'y': 2}) v", function(err: null | Error, rows: TableData) {
+                if (err) done(new Error('Query failed unexpectedly'));
+                assert.equal(rows[0].v, 'x=1,y=2');
+            });
+            db.unregister_udf("udf", done);
+        });
+    });
+
+    describe('deterministic', function() {
+        let db: duckdb.Database;
+        before(function(done) {
+            db = new duckdb.Database(':memory:', done);
+        });
+
+        it('calls the function once per distinct argument', function(done) {
+            let calls = 0;
+            db.register_udf("label", "varchar", (i: number) => { calls++; return 'label' + i; }, {deterministic: true});
+            const sql = "SELECT count(DISTINCT label(i % 10)) cnt, min(label(i % 10)) lbl FROM range(100000) t(i)";
+            db.all(sql, function(err: null | Error, rows: TableData) {
+                if (err) return done(err);
+                assert.equal(rows[0].cnt, 10);
+                assert.equal(rows[0].lbl, 'label0');
+                assert.ok(calls < 1000);
+                const before = calls;
+                db.all(sql, function(err: null | Error) {
+                    if (err) return done(err);
+                    // every argument is memoized by now
+                    assert.equal(calls, before);
+                    db.unregister_udf("label", done);
+                });
+            });
+        });
+
+        it('tells apart argument combinations within a vector', function(done) {
+            let calls = 0;
+            db.register_udf("pair", "varchar", (a: number, b: null | string) => { calls++; return a + ':' + b; }, {deterministic: true});
+            db.all("SELECT i::INTEGER i, pair((i % 3)::INTEGER, CASE WHEN i % 2 = 0 THEN 'x' END) p FROM range(1000) t(i) ORDER BY i", function(err: null | Error, rows: TableData) {
+                if (err) return done(err);
+                for (const row of rows) {
+                    assert.equal(row.p, (row.i % 3) + ':' + (row.i % 2 === 0 ? 'x' : null));
+                }
+                assert.equal(calls, 6);
+                db.unregister_udf("pair", done);
+            });
+        });
+
+        it('returns the right result for every row when the arguments outnumber the cache', function(done) {
+            db.register_udf("double_it", "integer", (i: number) => i * 2, {deterministic: true, cacheSize: 100});
+            db.all("SELECT i::INTEGER i, double_it(i::INTEGER) d FROM range(10000) t(i) ORDER BY i", function(err: null | Error, rows: TableData) {
+                if (err) return done(err);
+                assert.equal(rows.length, 10000);
+                for (const row of rows) {
+                    assert.equal(row.d, row.i * 2);
+                }
+                db.unregister_udf("double_it", done);
+            });
+        });
+
+        it('keeps calling other functions for every row', function(done) {
+            db.register_udf("rnd", "double", () => Math.random());
+            db.all("SELECT count(DISTINCT rnd()) cnt FROM range(100)", function(err: null | Error, rows: TableData) {
+                if (err) return done(err);
+                assert.equal(Number(rows[0].cnt), 100);
+                db.unregister_udf("rnd", done);
+            });
+        });
+    });
+
+    describe('worker threads', function() {
+        let db: duckdb.Database;
+        before(function(done) {
+            db = new duckdb.Database(':memory:', done);
+        });
+
+        const udfModule = require.resolve('./support/udf_module.js');
+        const fnv1a = require(udfModule).fnv1a;
+
+        it('evaluates vectors in the worker pool', function(done) {
+            db.register_udf_module("hash", "integer", udfModule, {exportName: 'fnv1a', threads: 2});
+            db.all("SELECT i, hash('key' || i) h FROM range(10000) t(i) ORDER BY i", function(err: null | Error, rows: TableData) {
+                if (err) return done(err);
+                assert.equal(rows.length, 10000);
+                for (const row of rows) {
+                    assert.equal(row.h, fnv1a('key' + row.i));
+                }
+                db.unregister_udf("hash", done);
+            });
+        });
+
+        it('reports errors thrown in workers', function(done) {
+            db.register_udf_module("fail", "integer", udfModule, {exportName: 'fail', threads: 1});
+            db.all("SELECT fail(i) FROM range(10) t(i)", function(err: null | Error) {
+                assert.ok(err);
+                assert.ok(err!.message.includes('failing in a worker'));
+                db.unregister_udf("fail", done);
+            });
+        });
     });
 });